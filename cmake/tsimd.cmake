@@ -22,6 +22,8 @@
 ## DEALINGS IN THE SOFTWARE.                                                  ##
 ## ========================================================================== ##
 
+include(CMakeParseArguments)
+
 ## CMAKE_BUILD_TYPE setup macro ##
 
 macro(tsimd_setup_build_type)
@@ -78,4 +80,71 @@ macro(tsimd_configure_compiler)
   endif()
 endmacro()
 
+## Runtime dispatch macro ##
+
+# Compiles each of SOURCES once per ISA listed in ISAS (SSE4, AVX, AVX2,
+# AVX512KNL, AVX512SKX) and adds them to the given target. Each copy is built
+# with TSIMD_DISPATCH_TARGET set to the lowercase ISA name, and the target gets
+# TSIMD_DISPATCH_HAS_[ISA] for every variant, which is what TSIMD_DISPATCH()
+# (tsimd/detail/dispatch.h) uses to build its table.
+#
+# NOTE: TSIMD_BUILD_ISA should be the lowest ISA shipped, as the global ISA
+#       flags apply to every source: ISAs it cannot be lowered to are skipped
+function(tsimd_add_dispatch_sources TARGET_NAME)
+  cmake_parse_arguments(DISPATCH "" "" "ISAS;SOURCES" ${ARGN})
+
+  if (TSIMD_BUILD_ISA STREQUAL "AVX512SKX")
+    set(COMPATIBLE_ISAS AVX512SKX)
+  elseif (TSIMD_BUILD_ISA STREQUAL "AVX512KNL")
+    set(COMPATIBLE_ISAS AVX512KNL)
+  elseif (TSIMD_BUILD_ISA STREQUAL "AVX2")
+    set(COMPATIBLE_ISAS AVX2 AVX512KNL AVX512SKX)
+  elseif (TSIMD_BUILD_ISA STREQUAL "AVX")
+    set(COMPATIBLE_ISAS AVX AVX2 AVX512KNL AVX512SKX)
+  else()
+    set(COMPATIBLE_ISAS SSE4 AVX AVX2 AVX512KNL AVX512SKX)
+  endif()
+
+  foreach(ISA ${DISPATCH_ISAS})
+    string(TOUPPER ${ISA} ISA)
+    string(TOLOWER ${ISA} ISA_NAME)
+
+    if (ISA STREQUAL "SSE4")
+      set(DISPATCH_FLAGS ${FLAGS_SSE42})
+    else()
+      set(DISPATCH_FLAGS ${FLAGS_${ISA}})
+    endif()
+
+    list(FIND COMPATIBLE_ISAS ${ISA} ISA_INDEX)
+    if (ISA_INDEX EQUAL -1)
+      message(STATUS "${TARGET_NAME}: skipping ${ISA} variant, "
+                     "TSIMD_BUILD_ISA is ${TSIMD_BUILD_ISA}")
+    elseif (NOT DISPATCH_FLAGS)
+      message(STATUS "${TARGET_NAME}: skipping ${ISA} variant, "
+                     "not supported by this compiler")
+    else()
+      foreach(src ${DISPATCH_SOURCES})
+        get_filename_component(SRC_PATH ${src} ABSOLUTE)
+        get_filename_component(SRC_NAME ${src} NAME_WE)
+
+        set(DISPATCH_DIR ${CMAKE_CURRENT_BINARY_DIR}/${TARGET_NAME}_dispatch)
+        set(DISPATCH_SRC ${DISPATCH_DIR}/${SRC_NAME}_${ISA_NAME}.cpp)
+
+        # only touch the generated source when it changes
+        file(WRITE ${DISPATCH_SRC}.in "#include \"${SRC_PATH}\"\n")
+        configure_file(${DISPATCH_SRC}.in ${DISPATCH_SRC} COPYONLY)
+
+        set_source_files_properties(${DISPATCH_SRC} PROPERTIES
+          COMPILE_FLAGS "${DISPATCH_FLAGS}"
+          COMPILE_DEFINITIONS TSIMD_DISPATCH_TARGET=${ISA_NAME})
+
+        target_sources(${TARGET_NAME} PRIVATE ${DISPATCH_SRC})
+      endforeach()
+
+      target_compile_definitions(${TARGET_NAME} PRIVATE
+                                 TSIMD_DISPATCH_HAS_${ISA})
+    endif()
+  endforeach()
+endfunction()
+
 include(clang-format)
@@ -0,0 +1,134 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Intel Corporation                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "../mandelbrot/pico_bench.h"
+#include "tsimd/tsimd.h"
+
+// scalar version /////////////////////////////////////////////////////////////
+
+namespace scalar {
+
+  void histogram(const float *samples, int count, int bins, int hist[])
+  {
+    for (int i = 0; i < count; ++i)
+      hist[int(samples[i] * bins)]++;
+  }
+
+}  // namespace scalar
+
+// tsimd version //////////////////////////////////////////////////////////////
+
+namespace tsimd {
+
+  template <int W>
+  void histogram(const float *samples, int count, int bins, int hist[])
+  {
+    const vintn<W> one(1);
+
+    int i = 0;
+
+    // NOTE: scatter_add() merges lanes falling into the same bin before
+    //       updating memory, so a pack may hit any bin any number of times
+    for (; i + W <= count; i += W) {
+      const vfloatn<W> x = loadu<vfloatn<W>>(samples + i);
+      const vintn<W> bin(x * float(bins));
+      scatter_add(one, hist, bin);
+    }
+
+    for (; i < count; ++i)
+      hist[int(samples[i] * bins)]++;
+  }
+
+}  // namespace tsimd
+
+int main()
+{
+  using namespace std::chrono;
+
+  const int count = 1 << 22;
+
+  std::vector<float> samples(count);
+
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<float> dist(0.f, 1.f);
+  std::generate(samples.begin(), samples.end(), [&]() { return dist(rng); });
+
+  auto bencher = pico_bench::Benchmarker<microseconds>{64, seconds{10}};
+
+  std::cout << "TSIMD_DEFAULT_WIDTH == " << TSIMD_DEFAULT_WIDTH << '\n' << '\n';
+
+  std::cout << "starting benchmarks (results in 'us')... " << '\n';
+
+  // NOTE: few bins means most lanes of a pack collide with each other, many
+  //       bins means collisions are rare
+
+  for (int bins : {16, 4096}) {
+    std::vector<int> expected(bins, 0);
+    std::vector<int> hist(bins, 0);
+
+    using histogram_fcn = void (*)(const float *, int, int, int[]);
+
+    auto run = [&](const char *name, histogram_fcn fcn) {
+      auto stats = bencher([&]() {
+        std::fill(hist.begin(), hist.end(), 0);
+        fcn(samples.data(), count, bins, hist.data());
+      });
+
+      std::cout << '\n' << name << " (" << bins << " bins) " << stats << '\n';
+
+      if (hist != expected)
+        std::cout << "--> ERROR: " << name << " histogram is incorrect!\n";
+
+      return stats.min().count();
+    };
+
+    scalar::histogram(samples.data(), count, bins, expected.data());
+
+    const float scalar_min  = run("scalar", scalar::histogram);
+    const float tsimd4_min  = run("tsimd_4", tsimd::histogram<4>);
+    const float tsimd8_min  = run("tsimd_8", tsimd::histogram<8>);
+    const float tsimd16_min = run("tsimd_16", tsimd::histogram<16>);
+
+    std::cout << '\n' << "Conclusions (" << bins << " bins): " << '\n';
+
+    std::cout << '\n'
+              << "--> tsimd_4 was " << scalar_min / tsimd4_min
+              << "x the speed of scalar";
+
+    std::cout << '\n'
+              << "--> tsimd_8 was " << scalar_min / tsimd8_min
+              << "x the speed of scalar";
+
+    std::cout << '\n'
+              << "--> tsimd_16 was " << scalar_min / tsimd16_min
+              << "x the speed of scalar" << '\n';
+  }
+
+  return 0;
+}
@@ -22,6 +22,7 @@
 // DEALINGS IN THE SOFTWARE.                                                  //
 // ========================================================================== //
 
+#include <array>
 #include <cstdio>
 #include <iostream>
 #include <string>
@@ -120,9 +121,16 @@ namespace tsimd {
         int base_index = (j * width + i);
         auto result    = mandel(active, x, y, maxIters);
 
-        tsimd::store(result, output + base_index, active);
+        // NOTE: the image is written once and not read back here, so
+        //       full rows of pixels bypass the caches
+        if (tsimd::all(active))
+          tsimd::stream_store(result, output + base_index);
+        else
+          tsimd::store(result, output + base_index, active);
       }
     }
+
+    tsimd::stream_fence();
   }
 
 } // namespace tsimd
@@ -316,7 +324,9 @@ int main()
   const float y1            = 1;
 
   const int maxIters = 256;
-  std::vector<int> buf(width * height);
+  // NOTE: tsimd::store() requires aligned memory, so keep the output buffer
+  //       aligned for the widest pack below
+  static TSIMD_ALIGN(64) std::array<int, width * height> buf;
 
   auto bencher = pico_bench::Benchmarker<milliseconds>{64, seconds{10}};
 
@@ -408,6 +418,34 @@ int main()
 
   writePPM("mandelbrot_tsimd16.ppm", width, height, buf.data());
 
+  // tsimd_32 run ////////////////////////////////////////////////////////////
+
+  std::fill(buf.begin(), buf.end(), 0);
+
+  stats = bencher([&]() {
+    tsimd::mandelbrot<32>(x0, y0, x1, y1, width, height, maxIters, buf.data());
+  });
+
+  const float tsimd32_min = stats.min().count();
+
+  std::cout << '\n' << "tsimd_32 " << stats << '\n';
+
+  writePPM("mandelbrot_tsimd32.ppm", width, height, buf.data());
+
+  // tsimd_64 run ////////////////////////////////////////////////////////////
+
+  std::fill(buf.begin(), buf.end(), 0);
+
+  stats = bencher([&]() {
+    tsimd::mandelbrot<64>(x0, y0, x1, y1, width, height, maxIters, buf.data());
+  });
+
+  const float tsimd64_min = stats.min().count();
+
+  std::cout << '\n' << "tsimd_64 " << stats << '\n';
+
+  writePPM("mandelbrot_tsimd64.ppm", width, height, buf.data());
+
   // embree run ///////////////////////////////////////////////////////////////
 
 #ifdef TSIMD_ENABLE_EMBREE
@@ -576,6 +614,30 @@ int main()
             << "--> tsimd16 was " << tsimd8_min / tsimd16_min
             << "x the speed of tsimd_8" << '\n';
 
+  // tsimd32 //
+
+  std::cout << '\n'
+            << "--> tsimd32 was " << scalar_min / tsimd32_min
+            << "x the speed of scalar";
+
+  std::cout << '\n'
+            << "--> tsimd32 was " << tsimd16_min / tsimd32_min
+            << "x the speed of tsimd_16" << '\n';
+
+  // tsimd64 //
+
+  std::cout << '\n'
+            << "--> tsimd64 was " << scalar_min / tsimd64_min
+            << "x the speed of scalar";
+
+  std::cout << '\n'
+            << "--> tsimd64 was " << tsimd16_min / tsimd64_min
+            << "x the speed of tsimd_16";
+
+  std::cout << '\n'
+            << "--> tsimd64 was " << tsimd32_min / tsimd64_min
+            << "x the speed of tsimd_32" << '\n';
+
   // embree //
 
 #ifdef TSIMD_ENABLE_EMBREE
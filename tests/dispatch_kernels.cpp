@@ -0,0 +1,51 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Intel Corporation                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+// NOTE: this file is compiled once per ISA, see tsimd_add_dispatch_sources()
+
+#include "dispatch_kernels.h"
+
+namespace kernels {
+  namespace TSIMD_DISPATCH_TARGET {
+
+    int saxpy(float a, const float *x, float *y, int n)
+    {
+      using tsimd::vfloat;
+
+      int i = 0;
+
+      for (; i + vfloat::static_size <= n; i += vfloat::static_size) {
+        const vfloat vx = tsimd::load<vfloat>(x + i);
+        const vfloat vy = tsimd::load<vfloat>(y + i);
+        tsimd::store(a * vx + vy, y + i);
+      }
+
+      for (; i < n; ++i)
+        y[i] = a * x[i] + y[i];
+
+      return vfloat::static_size;
+    }
+
+  }  // namespace TSIMD_DISPATCH_TARGET
+}  // namespace kernels
@@ -0,0 +1,80 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Intel Corporation                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+#include "catch/catch.hpp"
+
+#include "dispatch_kernels.h"
+
+#include <array>
+
+TEST_CASE("dispatch picks the best supported variant", "[dispatch]")
+{
+  const tsimd::isa target = kernels::saxpy.target();
+
+  CHECK(tsimd::cpu_supports(target));
+
+  const std::array<tsimd::isa, 5> isas = {{tsimd::isa::sse4,
+                                           tsimd::isa::avx,
+                                           tsimd::isa::avx2,
+                                           tsimd::isa::avx512knl,
+                                           tsimd::isa::avx512skx}};
+
+  // NOTE: every variant compiled in that is above the target must be one this
+  //       CPU can't run
+  const auto variants = kernels::saxpy_dispatch_variants::variants();
+  for (auto i : isas) {
+    if (int(i) > int(target) && variants[int(i)] != nullptr)
+      CHECK(!tsimd::cpu_supports(i));
+  }
+
+  INFO("dispatched to " << tsimd::isa_name(target));
+  CHECK(variants[int(target)] != nullptr);
+}
+
+TEST_CASE("dispatched kernel results", "[dispatch]")
+{
+  const int n = 67;
+
+  TSIMD_ALIGN(64) std::array<float, n> x;
+  TSIMD_ALIGN(64) std::array<float, n> y;
+
+  for (int i = 0; i < n; ++i) {
+    x[i] = float(i);
+    y[i] = 1.f;
+  }
+
+  const int width = kernels::saxpy(2.f, x.data(), y.data(), n);
+
+  for (int i = 0; i < n; ++i)
+    CHECK(y[i] == 2.f * i + 1.f);
+
+  const tsimd::isa target = kernels::saxpy.target();
+
+  if (target == tsimd::isa::avx512knl || target == tsimd::isa::avx512skx)
+    CHECK(width == 16);
+  else if (target == tsimd::isa::avx || target == tsimd::isa::avx2)
+    CHECK(width == 8);
+  else
+    CHECK(width == 4);
+}
@@ -27,6 +27,7 @@
 #include "tsimd/tsimd.h"
 
 #include <algorithm>
+#include <cstddef>
 #include <numeric>
 #include <random>
 
@@ -42,15 +43,29 @@
 using bool_type  = tsimd::bool64_t;
 using float_type = double;
 using int_type   = long long;
+using uint_type  = unsigned long long;
 #else
 using bool_type  = tsimd::bool32_t;
 using float_type = float;
 using int_type   = int;
+using uint_type  = unsigned int;
 #endif
 
 using vbool  = tsimd::pack<bool_type, TEST_WIDTH>;
 using vfloat = tsimd::pack<float_type, TEST_WIDTH>;
 using vint   = tsimd::pack<int_type, TEST_WIDTH>;
+using vuint  = tsimd::pack<uint_type, TEST_WIDTH>;
+
+// NOTE: 8/16-bit packs fill the same register as the 32-bit ones
+#define TEST_SMALL_INTS \
+  (TEST_WIDTH > 1 && TEST_WIDTH <= 16 && !TEST_DOUBLE_PRECISION)
+
+#if TEST_SMALL_INTS
+using vschar  = tsimd::pack<signed char, TEST_WIDTH * 4>;
+using vuchar  = tsimd::pack<unsigned char, TEST_WIDTH * 4>;
+using vshort  = tsimd::pack<short, TEST_WIDTH * 2>;
+using vushort = tsimd::pack<unsigned short, TEST_WIDTH * 2>;
+#endif
 
 /* TODO: add tests for -->
  *         - operator<<()
@@ -84,8 +99,146 @@ TEST_CASE("cast construction", "[member_functions]")
   REQUIRE(tsimd::all(v16 == test16));
 }
 
+TEST_CASE("unsigned conversions", "[member_functions]")
+{
+  const uint_type big_u = (uint_type(3) << (sizeof(uint_type) * 8 - 2));
+
+  vuint u;
+
+  for (int i = 0; i < TEST_WIDTH; ++i)
+    u[i] = (i % 2) ? big_u : uint_type(i);
+
+  vfloat f(u);
+
+  for (int i = 0; i < TEST_WIDTH; ++i)
+    REQUIRE(f[i] == float_type(u[i]));
+
+  vuint u2(f);
+
+  for (int i = 0; i < TEST_WIDTH; ++i)
+    REQUIRE(u2[i] == u[i]);
+}
+
+TEST_CASE("native intrinsic types", "[member_functions]")
+{
+#if defined(__AVX__)
+  REQUIRE(tsimd::traits::simd_type_is_native<double, 4>::value);
+  REQUIRE(tsimd::traits::simd_type_is_native<long long, 4>::value);
+  REQUIRE(tsimd::traits::simd_type_is_native<tsimd::bool64_t, 4>::value);
+#endif
+#if defined(__SSE__)
+  REQUIRE(tsimd::traits::simd_type_is_native<float, 4>::value);
+  REQUIRE(tsimd::traits::simd_type_is_native<int, 4>::value);
+#endif
+#if defined(__AVX512F__)
+  REQUIRE(tsimd::traits::simd_type_is_native<double, 8>::value);
+  REQUIRE(tsimd::traits::simd_type_is_native<long long, 8>::value);
+  REQUIRE(tsimd::traits::is_bitmask<tsimd::bool64_t, 8>::value);
+  REQUIRE(tsimd::traits::is_bitmask<tsimd::bool32_t, 16>::value);
+#endif
+#if defined(__AVX512VL__)
+  REQUIRE(tsimd::traits::is_bitmask<tsimd::bool32_t, 4>::value);
+  REQUIRE(tsimd::traits::is_bitmask<tsimd::bool32_t, 8>::value);
+  REQUIRE(tsimd::traits::is_bitmask<tsimd::bool64_t, 4>::value);
+#endif
+  REQUIRE(!tsimd::traits::simd_type_is_native<float, 2>::value);
+}
+
+TEST_CASE("mask lane access", "[member_functions]")
+{
+  vbool m(false);
+
+  for (int i = 0; i < TEST_WIDTH; ++i)
+    m[i] = (i % 2) == 1;
+
+  const vbool cm = m;
+
+  for (int i = 0; i < TEST_WIDTH; ++i) {
+    REQUIRE(bool(m[i]) == ((i % 2) == 1));
+    REQUIRE(bool(cm[i]) == ((i % 2) == 1));
+  }
+
+  REQUIRE(tsimd::all(vbool(true)));
+  REQUIRE(tsimd::none(vbool(false)));
+}
+
 // pack<> arithmetic operators ////////////////////////////////////////////////
 
+TEST_CASE("per-lane arithmetic", "[arithmetic_operators]")
+{
+  vfloat f1, f2;
+  vint i1, i2;
+
+  for (int i = 0; i < TEST_WIDTH; ++i) {
+    f1[i] = float_type(i + 1);
+    f2[i] = float_type(0.5 * (i + 3));
+    i1[i] = int_type(i + 1) * 7;
+    i2[i] = int_type(i - 2) * 3;
+  }
+
+  const vfloat fsum  = f1 + f2;
+  const vfloat fdiff = f1 - f2;
+  const vfloat fprod = f1 * f2;
+  const vfloat fquot = f1 / f2;
+
+  const vint isum  = i1 + i2;
+  const vint idiff = i1 - i2;
+  const vint iprod = i1 * i2;
+
+  for (int i = 0; i < TEST_WIDTH; ++i) {
+    REQUIRE(fsum[i] == f1[i] + f2[i]);
+    REQUIRE(fdiff[i] == f1[i] - f2[i]);
+    REQUIRE(fprod[i] == f1[i] * f2[i]);
+    REQUIRE(fquot[i] == f1[i] / f2[i]);
+    REQUIRE(isum[i] == i1[i] + i2[i]);
+    REQUIRE(idiff[i] == i1[i] - i2[i]);
+    REQUIRE(iprod[i] == i1[i] * i2[i]);
+  }
+
+#if TEST_DOUBLE_PRECISION
+  // make sure the upper 32 bits of 64-bit products are carried
+  const vint big(0x100000003LL);
+  const vint wide = big * i1;
+  for (int i = 0; i < TEST_WIDTH; ++i)
+    REQUIRE(wide[i] == 0x100000003LL * i1[i]);
+#endif
+}
+
+TEST_CASE("unsigned arithmetic", "[arithmetic_operators]")
+{
+  const uint_type max_u = ~uint_type(0);
+
+  vuint v1(max_u);
+  vuint v2(2);
+
+  REQUIRE(tsimd::all((v1 + v2) == vuint(1)));
+  REQUIRE(tsimd::all((v2 - v1) == vuint(3)));
+  REQUIRE(tsimd::all((v1 * v2) == vuint(max_u - 1)));
+  REQUIRE(tsimd::all((v1 / v2) == vuint(max_u / 2)));
+}
+
+#if TEST_SMALL_INTS
+TEST_CASE("8/16-bit arithmetic", "[arithmetic_operators]")
+{
+  vschar c1(100);
+  vschar c2(-7);
+
+  REQUIRE(tsimd::all((c1 + c1) == vschar(-56)));
+  REQUIRE(tsimd::all((c2 - c1) == vschar(-107)));
+  REQUIRE(tsimd::all((c1 * c2) == vschar(68)));
+
+  vuchar u1(250);
+  REQUIRE(tsimd::all((u1 + vuchar(10)) == vuchar(4)));
+  REQUIRE(tsimd::all((u1 * vuchar(3)) == vuchar(238)));
+
+  vshort s1(-300);
+  vushort us1(60000);
+
+  REQUIRE(tsimd::all((s1 * s1) == vshort(24464)));
+  REQUIRE(tsimd::all((us1 + us1) == vushort(54464)));
+}
+#endif
+
 TEST_CASE("binary operator+()", "[arithmetic_operators]")
 {
   vfloat v1(1.f), v2(2.f);
@@ -236,6 +389,25 @@ TEST_CASE("binary operator>>()", "[bitwise_operators]")
   REQUIRE(tsimd::all((4 >> v1) == vint(1)));
 }
 
+TEST_CASE("unsigned operator>>()", "[bitwise_operators]")
+{
+  const uint_type max_u = ~uint_type(0);
+
+  vuint v(max_u);
+  vuint shift;
+
+  // NOTE: wide packs have more lanes than bits in each element
+  for (int i = 0; i < TEST_WIDTH; ++i)
+    shift[i] = uint_type(i % (8 * sizeof(uint_type)));
+
+  const vuint result = v >> shift;
+
+  for (int i = 0; i < TEST_WIDTH; ++i)
+    REQUIRE(result[i] == (max_u >> shift[i]));
+
+  REQUIRE(tsimd::all((v >> 1) == vuint(max_u / 2)));
+}
+
 TEST_CASE("binary operator^()", "[bitwise_operators]")
 {
   vint v1(1);
@@ -322,6 +494,103 @@ TEST_CASE("binary operator>=()", "[logic_operators]")
   REQUIRE(tsimd::all(v1 >= 2));
 }
 
+TEST_CASE("unsigned comparisons", "[logic_operators]")
+{
+  vuint small(1);
+  vuint big(~uint_type(0) - 1);
+
+  REQUIRE(tsimd::all(small < big));
+  REQUIRE(tsimd::all(small <= big));
+  REQUIRE(tsimd::all(big > small));
+  REQUIRE(tsimd::all(big >= small));
+  REQUIRE(tsimd::none(big < small));
+  REQUIRE(tsimd::all(big == big));
+  REQUIRE(tsimd::all(big != small));
+  REQUIRE(tsimd::all(tsimd::select(small < big, big, small) == big));
+}
+
+#if TEST_SMALL_INTS
+TEST_CASE("8/16-bit comparisons", "[logic_operators]")
+{
+  vschar c;
+  vuchar u;
+
+  for (int i = 0; i < vschar::static_size; ++i) {
+    c[i] = i % 2 ? -1 : 1;
+    u[i] = i % 2 ? 200 : 100;
+  }
+
+  auto c_lt = c < vschar(0);
+  auto u_gt = u > vuchar(150);
+
+  for (int i = 0; i < vschar::static_size; ++i) {
+    REQUIRE(bool(c_lt[i]) == (i % 2 == 1));
+    REQUIRE(bool(u_gt[i]) == (i % 2 == 1));
+  }
+
+  REQUIRE(tsimd::all(c_lt == u_gt));
+  REQUIRE(tsimd::all((u <= vuchar(200)) & (u >= vuchar(100))));
+  REQUIRE(tsimd::none(!(c_lt | !u_gt)));
+
+  auto sel = tsimd::select(u_gt, u, vuchar(7));
+  REQUIRE(sel[0] == 7);
+  REQUIRE(sel[1] == 200);
+
+  vushort us(40000);
+  REQUIRE(tsimd::all(us > vushort(1)));
+  REQUIRE(tsimd::all(vshort(-2) < vshort(1)));
+  REQUIRE(tsimd::any(vshort(3) == vshort(3)));
+}
+#endif
+
+TEST_CASE("per-lane comparisons", "[logic_operators]")
+{
+  vfloat f1, f2;
+  vint i1, i2;
+
+  for (int i = 0; i < TEST_WIDTH; ++i) {
+    f1[i] = float_type(i % 3);
+    f2[i] = float_type(1);
+    i1[i] = int_type(i % 3) - 1;
+    i2[i] = int_type(0);
+  }
+
+  const vbool feq = f1 == f2;
+  const vbool flt = f1 < f2;
+  const vbool fgt = f1 > f2;
+  const vbool fle = f1 <= f2;
+  const vbool fge = f1 >= f2;
+
+  const vbool ieq = i1 == i2;
+  const vbool ilt = i1 < i2;
+  const vbool igt = i1 > i2;
+  const vbool ile = i1 <= i2;
+  const vbool ige = i1 >= i2;
+
+  const vbool not_ieq = !ieq;
+  const vbool both    = flt & ilt;
+  const vbool either  = flt | ilt;
+
+  for (int i = 0; i < TEST_WIDTH; ++i) {
+    REQUIRE(bool(feq[i]) == (f1[i] == f2[i]));
+    REQUIRE(bool(flt[i]) == (f1[i] < f2[i]));
+    REQUIRE(bool(fgt[i]) == (f1[i] > f2[i]));
+    REQUIRE(bool(fle[i]) == (f1[i] <= f2[i]));
+    REQUIRE(bool(fge[i]) == (f1[i] >= f2[i]));
+    REQUIRE(bool(ieq[i]) == (i1[i] == i2[i]));
+    REQUIRE(bool(ilt[i]) == (i1[i] < i2[i]));
+    REQUIRE(bool(igt[i]) == (i1[i] > i2[i]));
+    REQUIRE(bool(ile[i]) == (i1[i] <= i2[i]));
+    REQUIRE(bool(ige[i]) == (i1[i] >= i2[i]));
+    REQUIRE(bool(not_ieq[i]) == (i1[i] != i2[i]));
+    REQUIRE(bool(both[i]) == (f1[i] < f2[i] && i1[i] < i2[i]));
+    REQUIRE(bool(either[i]) == (f1[i] < f2[i] || i1[i] < i2[i]));
+  }
+
+  REQUIRE(tsimd::all(ieq == ieq));
+  REQUIRE(tsimd::none(ieq == not_ieq));
+}
+
 TEST_CASE("binary operator&&()", "[logic_operators]")
 {
   vbool m1(true);
@@ -345,6 +614,33 @@ TEST_CASE("unary operator!()", "[logic_operators]")
   REQUIRE(tsimd::all(!v == vbool(false)));
 }
 
+TEST_CASE("per-lane mask logic", "[logic_operators]")
+{
+  vbool m1(false);
+  vbool m2(false);
+
+  for (int i = 0; i < TEST_WIDTH; ++i) {
+    m1[i] = (i % 2) == 1;
+    m2[i] = (i % 3) == 0;
+  }
+
+  const vbool m_not = !m1;
+  const vbool m_eq  = (m1 == m2);
+  const vbool m_and = m1 & m2;
+  const vbool m_or  = m1 | m2;
+
+  for (int i = 0; i < TEST_WIDTH; ++i) {
+    REQUIRE(bool(m_not[i]) == !bool(m1[i]));
+    REQUIRE(bool(m_eq[i]) == (bool(m1[i]) == bool(m2[i])));
+    REQUIRE(bool(m_and[i]) == (bool(m1[i]) && bool(m2[i])));
+    REQUIRE(bool(m_or[i]) == (bool(m1[i]) || bool(m2[i])));
+  }
+
+  REQUIRE(tsimd::all(m1 | m_not));
+  REQUIRE(tsimd::none(m1 & m_not));
+  REQUIRE(tsimd::all(m_not == !m1));
+}
+
 TEST_CASE("unary operator-()", "[logic_operators]")
 {
   vint v1(2);
@@ -374,6 +670,39 @@ TEST_CASE("floor()", "[math_functions]")
   REQUIRE(tsimd::all(tsimd::near_equal(tsimd::floor(v), 1.f)));
 }
 
+TEST_CASE("fma()", "[math_functions]")
+{
+  vfloat a, b, c;
+
+  for (int i = 0; i < TEST_WIDTH; ++i) {
+    a[i] = float_type(i) - float_type(2);
+    b[i] = float_type(3) + float_type(i);
+    c[i] = float_type(1) - float_type(i);
+  }
+
+  const auto r1 = tsimd::fma(a, b, c);
+  const auto r2 = tsimd::fms(a, b, c);
+  const auto r3 = tsimd::fnma(a, b, c);
+  const auto r4 = tsimd::fnms(a, b, c);
+
+  for (int i = 0; i < TEST_WIDTH; ++i) {
+    REQUIRE(r1[i] == a[i] * b[i] + c[i]);
+    REQUIRE(r2[i] == a[i] * b[i] - c[i]);
+    REQUIRE(r3[i] == -(a[i] * b[i]) + c[i]);
+    REQUIRE(r4[i] == -(a[i] * b[i]) - c[i]);
+  }
+
+  REQUIRE(tsimd::all(tsimd::fma(a, 2.f, 1.f) == a * 2.f + 1.f));
+
+#if defined(__FMA__)
+  // a * a - 1 with a = 1 + eps is only exact with a single rounding
+  const int eps_exp = TEST_DOUBLE_PRECISION ? -27 : -12;
+  const float_type eps = std::ldexp(float_type(1), eps_exp);
+  const vfloat x(float_type(1) + eps);
+  REQUIRE(tsimd::all(tsimd::fms(x, x, vfloat(1.f)) == eps * 2 + eps * eps));
+#endif
+}
+
 TEST_CASE("min()", "[math_functions]")
 {
   vfloat v1(1.f);
@@ -396,6 +725,90 @@ TEST_CASE("max()", "[math_functions]")
   REQUIRE(tsimd::all(tsimd::max(v3, v4) == 2));
 }
 
+TEST_CASE("unsigned min()/max()", "[math_functions]")
+{
+  vuint small(1);
+  vuint big(~uint_type(0) - 1);
+
+  REQUIRE(tsimd::all(tsimd::min(small, big) == small));
+  REQUIRE(tsimd::all(tsimd::max(small, big) == big));
+}
+
+#if !TEST_DOUBLE_PRECISION
+TEST_CASE("mul_wide()", "[math_functions]")
+{
+  using vullong = tsimd::pack<unsigned long long, TEST_WIDTH>;
+  using vllong  = tsimd::pack<long long, TEST_WIDTH>;
+
+  vuint u1(0xFFFFFFFFu);
+  vuint u2(3);
+  REQUIRE(tsimd::all(tsimd::mul_wide(u1, u2) == vullong(0x2FFFFFFFDull)));
+
+  vint i1(-3);
+  vint i2(1 << 30);
+  REQUIRE(tsimd::all(tsimd::mul_wide(i1, i2) == vllong(-(3ll << 30))));
+}
+
+#if TEST_SMALL_INTS
+TEST_CASE("8/16-bit saturating math", "[math_functions]")
+{
+  REQUIRE(tsimd::all(tsimd::adds(vschar(100), vschar(100)) == vschar(127)));
+  REQUIRE(tsimd::all(tsimd::subs(vschar(-100), vschar(100)) == vschar(-128)));
+  REQUIRE(tsimd::all(tsimd::adds(vuchar(200), vuchar(100)) == vuchar(255)));
+  REQUIRE(tsimd::all(tsimd::subs(vuchar(10), vuchar(20)) == vuchar(0)));
+  REQUIRE(tsimd::all(tsimd::adds(vshort(30000), vshort(30000)) == 32767));
+  REQUIRE(tsimd::all(tsimd::subs(vushort(5), vushort(6)) == vushort(0)));
+
+  REQUIRE(tsimd::all(tsimd::avg(vuchar(1), vuchar(2)) == vuchar(2)));
+  REQUIRE(tsimd::all(tsimd::avg(vushort(65535), vushort(0)) == 32768));
+
+  REQUIRE(tsimd::all(tsimd::mulhi(vshort(-16384), vshort(8)) == vshort(-2)));
+  REQUIRE(tsimd::all(tsimd::mulhi(vushort(65535), vushort(65535)) == 65534));
+
+  REQUIRE(tsimd::all(tsimd::min(vschar(-5), vschar(3)) == vschar(-5)));
+  REQUIRE(tsimd::all(tsimd::max(vuchar(5), vuchar(250)) == vuchar(250)));
+  REQUIRE(tsimd::all(tsimd::min(vushort(40000), vushort(3)) == vushort(3)));
+  REQUIRE(tsimd::all(tsimd::max(vshort(-5), vshort(3)) == vshort(3)));
+}
+
+TEST_CASE("packs()/unpack_lo()/unpack_hi()", "[math_functions]")
+{
+  vshort a, b;
+
+  for (int i = 0; i < vshort::static_size; ++i) {
+    a[i] = i - 200;
+    b[i] = i + 200;
+  }
+
+  auto c = tsimd::packs(a, b);
+  auto u = tsimd::packus(a, b);
+
+  for (int i = 0; i < vshort::static_size; ++i) {
+    REQUIRE(c[i] == -128);
+    REQUIRE(c[vshort::static_size + i] == 127);
+    REQUIRE(u[i] == 0);
+    REQUIRE(u[vshort::static_size + i] == 200 + i);
+  }
+
+  vschar s;
+
+  for (int i = 0; i < vschar::static_size; ++i)
+    s[i] = i - 64;
+
+  auto lo = tsimd::unpack_lo(s);
+  auto hi = tsimd::unpack_hi(s);
+
+  for (int i = 0; i < vshort::static_size; ++i) {
+    REQUIRE(lo[i] == i - 64);
+    REQUIRE(hi[i] == vshort::static_size + i - 64);
+  }
+
+  auto ulo = tsimd::unpack_lo(tsimd::reinterpret_elements_as<unsigned char>(s));
+  REQUIRE(ulo[0] == 192);
+}
+#endif
+#endif
+
 TEST_CASE("sqrt()", "[math_functions]")
 {
   vfloat v1(4.f);
@@ -403,6 +816,41 @@ TEST_CASE("sqrt()", "[math_functions]")
   REQUIRE(tsimd::all(tsimd::near_equal(v1, 2.f)));
 }
 
+TEST_CASE("per-lane math", "[math_functions]")
+{
+  vfloat f1, f2;
+  vint i1, i2;
+
+  for (int i = 0; i < TEST_WIDTH; ++i) {
+    f1[i] = float_type(i) * float_type(1.25) - float_type(2);
+    f2[i] = float_type(1) - float_type(i);
+    i1[i] = int_type(i) * 5 - 7;
+    i2[i] = int_type(3) - int_type(i);
+  }
+
+  const vfloat fabs_  = tsimd::abs(f1);
+  const vfloat ffloor = tsimd::floor(f1);
+  const vfloat fceil  = tsimd::ceil(f1);
+  const vfloat fmin   = tsimd::min(f1, f2);
+  const vfloat fmax   = tsimd::max(f1, f2);
+  const vfloat fsqrt  = tsimd::sqrt(fabs_);
+  const vint iabs     = tsimd::abs(i1);
+  const vint imin     = tsimd::min(i1, i2);
+  const vint imax     = tsimd::max(i1, i2);
+
+  for (int i = 0; i < TEST_WIDTH; ++i) {
+    REQUIRE(fabs_[i] == std::abs(f1[i]));
+    REQUIRE(ffloor[i] == std::floor(f1[i]));
+    REQUIRE(fceil[i] == std::ceil(f1[i]));
+    REQUIRE(fmin[i] == std::min(f1[i], f2[i]));
+    REQUIRE(fmax[i] == std::max(f1[i], f2[i]));
+    REQUIRE(fsqrt[i] == std::sqrt(std::abs(f1[i])));
+    REQUIRE(iabs[i] == std::abs(i1[i]));
+    REQUIRE(imin[i] == std::min(i1[i], i2[i]));
+    REQUIRE(imax[i] == std::max(i1[i], i2[i]));
+  }
+}
+
 TEST_CASE("sin()", "[math_functions]")
 {
   vfloat v1(4.f);
@@ -552,6 +1000,32 @@ TEST_CASE("select()", "[algorithms]")
   }
 }
 
+TEST_CASE("per-lane select()", "[algorithms]")
+{
+  vbool m;
+  vfloat f1, f2;
+  vint i1, i2;
+
+  for (int i = 0; i < TEST_WIDTH; ++i) {
+    m[i]  = (i % 3) == 1;
+    f1[i] = float_type(i);
+    f2[i] = -float_type(i);
+    i1[i] = int_type(i);
+    i2[i] = -int_type(i) - 1;
+  }
+
+  const vfloat fr = tsimd::select(m, f1, f2);
+  const vint ir   = tsimd::select(m, i1, i2);
+
+  for (int i = 0; i < TEST_WIDTH; ++i) {
+    REQUIRE(fr[i] == (m[i] ? f1[i] : f2[i]));
+    REQUIRE(ir[i] == (m[i] ? i1[i] : i2[i]));
+  }
+
+  REQUIRE(tsimd::any(m) == (TEST_WIDTH > 1));
+  REQUIRE(!tsimd::all(m));
+}
+
 TEST_CASE("near_equal()", "[algorithms]")
 {
   vfloat v1(1.f);
@@ -564,20 +1038,377 @@ TEST_CASE("near_equal()", "[algorithms]")
   REQUIRE(tsimd::none(tsimd::near_equal(v1, v2, vfloat::value_t(0.11))));
 }
 
+TEST_CASE("reduce()", "[algorithms]")
+{
+  vbool m;
+  vfloat f, fm;
+  vint i1, im;
+  vuint u1;
+
+  float_type fsum = 0, fmsum = 0, fmprod = 1;
+  int_type imin = 0, imax = 0;
+  int_type immax = std::numeric_limits<int_type>::lowest();
+
+  for (int i = 0; i < TEST_WIDTH; ++i) {
+    m[i]  = (i % 3) == 1;
+    f[i]  = float_type(i + 1);
+    fm[i] = (i % 8) == 0 ? float_type(2) : float_type(1);
+    i1[i] = int_type((i * 5) % TEST_WIDTH) - TEST_WIDTH / 2;
+    im[i] = (i % 8) == 0 ? int_type(2) : int_type(1);
+    u1[i] = uint_type((i * 5) % TEST_WIDTH) + 1;
+
+    fsum += f[i];
+    imin = std::min(imin, int_type(i1[i]));
+    imax = std::max(imax, int_type(i1[i]));
+
+    if (m[i]) {
+      fmsum += f[i];
+      fmprod *= fm[i];
+      immax = std::max(immax, int_type(i1[i]));
+    }
+  }
+
+  const int num_twos = (TEST_WIDTH + 7) / 8;
+
+  REQUIRE(tsimd::reduce_add(f) == fsum);
+  REQUIRE(tsimd::reduce_mul(fm) == float_type(1 << num_twos));
+  REQUIRE(tsimd::reduce_min(f) == float_type(1));
+  REQUIRE(tsimd::reduce_max(f) == float_type(TEST_WIDTH));
+
+  REQUIRE(tsimd::reduce_add(i1) == -(TEST_WIDTH / 2));
+  REQUIRE(tsimd::reduce_mul(im) == int_type(1 << num_twos));
+  REQUIRE(tsimd::reduce_min(i1) == imin);
+  REQUIRE(tsimd::reduce_max(i1) == imax);
+
+  REQUIRE(tsimd::reduce_add(u1) ==
+          uint_type(TEST_WIDTH * (TEST_WIDTH + 1) / 2));
+  REQUIRE(tsimd::reduce_min(u1) == uint_type(1));
+  REQUIRE(tsimd::reduce_max(u1) == uint_type(TEST_WIDTH));
+
+  REQUIRE(tsimd::reduce_add(m, f) == fmsum);
+  REQUIRE(tsimd::reduce_max(m, i1) == immax);
+  REQUIRE(tsimd::reduce_mul(m, fm) == fmprod);
+
+  const vbool none(false);
+
+  REQUIRE(tsimd::reduce_add(none, f) == float_type(0));
+  REQUIRE(tsimd::reduce_min(none, i1) ==
+          std::numeric_limits<int_type>::max());
+  REQUIRE(tsimd::reduce_max(none, u1) == uint_type(0));
+
+#if TEST_SMALL_INTS
+  vschar c;
+  vushort s;
+  int csum = 0, smax = 0;
+
+  for (int i = 0; i < vschar::static_size; ++i) {
+    c[i] = static_cast<signed char>((i % 5) - 2);
+    csum += c[i];
+  }
+
+  for (int i = 0; i < vushort::static_size; ++i) {
+    s[i] = static_cast<unsigned short>((i * 7919) % 60000);
+    smax = std::max(smax, int(s[i]));
+  }
+
+  REQUIRE(tsimd::reduce_add(c) == static_cast<signed char>(csum));
+  REQUIRE(tsimd::reduce_min(c) == -2);
+  REQUIRE(tsimd::reduce_max(c) == 2);
+  REQUIRE(tsimd::reduce_max(s) == smax);
+  REQUIRE(tsimd::reduce_min(s) == 0);
+#endif
+}
+
+TEST_CASE("compress()/compress_store()/expand_load()", "[algorithms]")
+{
+  vbool m;
+  vfloat f;
+  vuint u;
+
+  for (int i = 0; i < TEST_WIDTH; ++i) {
+    m[i] = (i % 3) != 1;
+    f[i] = float_type(i) + float_type(0.5);
+    u[i] = uint_type(i) * 3 + 1;
+  }
+
+  const vfloat fc = tsimd::compress(m, f);
+  const vuint uc  = tsimd::compress(m, u);
+
+  std::array<float_type, TEST_WIDTH + 1> fbuf;
+  fbuf.fill(float_type(-1));
+
+  const int n = tsimd::compress_store(m, f, fbuf.data());
+
+  int k = 0;
+  for (int i = 0; i < TEST_WIDTH; ++i) {
+    if (m[i]) {
+      REQUIRE(fc[k] == f[i]);
+      REQUIRE(uc[k] == u[i]);
+      REQUIRE(fbuf[k] == f[i]);
+      k++;
+    }
+  }
+
+  REQUIRE(n == k);
+  REQUIRE(fbuf[n] == float_type(-1));
+
+  for (int i = n; i < TEST_WIDTH; ++i) {
+    REQUIRE(fc[i] == float_type(0));
+    REQUIRE(uc[i] == uint_type(0));
+  }
+
+  const vfloat fe = tsimd::expand_load(m, fbuf.data());
+  REQUIRE(tsimd::all(fe == tsimd::select(m, f, vfloat(0))));
+
+  const vbool none(false);
+  const vbool all_on(true);
+
+  REQUIRE(tsimd::compress_store(none, f, fbuf.data()) == 0);
+  REQUIRE(tsimd::all(tsimd::compress(none, f) == float_type(0)));
+  REQUIRE(tsimd::all(tsimd::compress(all_on, u) == u));
+
+#if TEST_SMALL_INTS
+  vshort s;
+  tsimd::mask<short, TEST_WIDTH * 2> ms;
+  std::array<short, TEST_WIDTH * 2> sbuf;
+
+  for (int i = 0; i < vshort::static_size; ++i) {
+    s[i]  = static_cast<short>(i * 100 - 50);
+    ms[i] = (i % 4) == 2;
+  }
+
+  const int ns = tsimd::compress_store(ms, s, sbuf.data());
+  REQUIRE(ns == vshort::static_size / 4);
+
+  for (int i = 0; i < ns; ++i)
+    REQUIRE(sbuf[i] == s[i * 4 + 2]);
+#endif
+}
+
+TEST_CASE("inclusive_scan()/exclusive_scan()/segmented_inclusive_scan()",
+          "[algorithms]")
+{
+  vbool m;
+  vbool heads;
+  vfloat f;
+  vint v;
+
+  // NOTE: small integer values keep float sums exact in any summation order
+
+  for (int i = 0; i < TEST_WIDTH; ++i) {
+    m[i]     = (i % 3) != 0;
+    heads[i] = (i % 5) == 2;
+    f[i]     = float_type(i % 4 + 1);
+    v[i]     = int_type(i % 7) - 2;
+  }
+
+  const vfloat fi = tsimd::inclusive_scan(f);
+  const vfloat fe = tsimd::exclusive_scan(f);
+  const vfloat fm = tsimd::inclusive_scan(m, f);
+  const vint vi   = tsimd::inclusive_scan(v);
+  const vint vs   = tsimd::segmented_inclusive_scan(heads, v);
+
+  float_type fcarry  = float_type(10);
+  float_type fecarry = float_type(10);
+  int_type scarry    = int_type(10);
+
+  const vfloat fic = tsimd::inclusive_scan(f, fcarry);
+  const vfloat fec = tsimd::exclusive_scan(f, fecarry);
+  const vint vsc   = tsimd::segmented_inclusive_scan(heads, v, scarry);
+
+  float_type fsum  = 0;
+  float_type fmsum = 0;
+  int_type vsum    = 0;
+  int_type ssum    = 0;
+  int_type scsum   = int_type(10);
+
+  for (int i = 0; i < TEST_WIDTH; ++i) {
+    REQUIRE(fe[i] == fsum);
+    REQUIRE(fec[i] == fsum + float_type(10));
+
+    fsum += f[i];
+    vsum += v[i];
+
+    if (m[i])
+      fmsum += f[i];
+
+    if (heads[i]) {
+      ssum  = 0;
+      scsum = 0;
+    }
+
+    ssum += v[i];
+    scsum += v[i];
+
+    REQUIRE(fi[i] == fsum);
+    REQUIRE(fic[i] == fsum + float_type(10));
+    REQUIRE(fm[i] == fmsum);
+    REQUIRE(vi[i] == vsum);
+    REQUIRE(vs[i] == ssum);
+    REQUIRE(vsc[i] == scsum);
+  }
+
+  REQUIRE(fcarry == fsum + float_type(10));
+  REQUIRE(fecarry == fsum + float_type(10));
+  REQUIRE(scarry == scsum);
+}
+
 // pack<> memory operations ///////////////////////////////////////////////////
 
 TEST_CASE("unmasked load()", "[memory_operations]")
 {
-  TSIMD_ALIGN(32) std::array<int_type, vint::static_size> values;
+  TSIMD_ALIGN(64) std::array<int_type, vint::static_size> values;
   std::fill(values.begin(), values.end(), 5);
 
   auto v1 = tsimd::load<vint>(values.data());
   REQUIRE(tsimd::all(v1 == 5));
 }
 
+TEST_CASE("unsigned load()/store()", "[memory_operations]")
+{
+  TSIMD_ALIGN(64) std::array<uint_type, vuint::static_size> values;
+  std::fill(values.begin(), values.end(), ~uint_type(0));
+
+  auto v1 = tsimd::load<vuint>(values.data());
+  REQUIRE(tsimd::all(v1 == ~uint_type(0)));
+
+  tsimd::store(v1 - 1, values.data());
+  REQUIRE(values[0] == ~uint_type(0) - 1);
+}
+
+#if TEST_SMALL_INTS
+TEST_CASE("8/16-bit load()/store()", "[memory_operations]")
+{
+  TSIMD_ALIGN(64) std::array<signed char, vschar::static_size> bytes;
+  TSIMD_ALIGN(64) std::array<unsigned short, vushort::static_size> words;
+
+  std::iota(bytes.begin(), bytes.end(), -10);
+  std::iota(words.begin(), words.end(), 60000);
+
+  auto c = tsimd::load<vschar>(bytes.data());
+  auto w = tsimd::load<vushort>(words.data());
+
+  REQUIRE(c[0] == -10);
+  REQUIRE(w[1] == 60001);
+
+  tsimd::store(c + vschar(1), bytes.data(), c < vschar(0));
+  tsimd::store(w + vushort(1), words.data());
+
+  REQUIRE(bytes[0] == -9);
+  REQUIRE(bytes[10] == 0);
+  REQUIRE(bytes[11] == 1);
+  REQUIRE(words[0] == 60001);
+}
+#endif
+
+#if !TEST_DOUBLE_PRECISION
+TEST_CASE("half_t load()/store()/gather()", "[memory_operations]")
+{
+  std::array<tsimd::half_t, 2 * TEST_WIDTH + 1> halves;
+
+  for (int i = 0; i < 2 * TEST_WIDTH + 1; ++i)
+    halves[i] = float(i) * 0.25f;
+
+  // NOTE: offset by one element to exercise unaligned half_t access
+  tsimd::half_t *h = halves.data() + 1;
+
+  const vfloat f = tsimd::load<vfloat>(h);
+
+  for (int i = 0; i < TEST_WIDTH; ++i)
+    REQUIRE(f[i] == float(i + 1) * 0.25f);
+
+  vbool m;
+  vint offset;
+
+  for (int i = 0; i < TEST_WIDTH; ++i) {
+    m[i]      = (i % 2) == 0;
+    offset[i] = (i * 3) % (2 * TEST_WIDTH);
+  }
+
+  const vfloat fm = tsimd::load<vfloat>(h, m);
+  const vfloat g  = tsimd::gather<vfloat>(halves.data(), offset);
+  const vfloat gm = tsimd::gather<vfloat>(halves.data(), offset, m);
+
+  for (int i = 0; i < TEST_WIDTH; ++i) {
+    REQUIRE(fm[i] == (m[i] ? f[i] : 0.f));
+    REQUIRE(g[i] == float(offset[i]) * 0.25f);
+    REQUIRE(gm[i] == (m[i] ? g[i] : 0.f));
+  }
+
+  tsimd::store(f + vfloat(1.f), h, m);
+  tsimd::store(f, h + TEST_WIDTH);
+
+  for (int i = 0; i < TEST_WIDTH; ++i) {
+    REQUIRE(float(h[i]) == f[i] + (m[i] ? 1.f : 0.f));
+    REQUIRE(float(h[TEST_WIDTH + i]) == f[i]);
+  }
+
+  REQUIRE(float(halves[0]) == 0.f);
+}
+
+TEST_CASE("half_t rounding and convert_buffer()", "[memory_operations]")
+{
+  REQUIRE(tsimd::half_t(65504.f).bits == 0x7BFF);
+  REQUIRE(tsimd::half_t(65520.f).bits == 0x7C00);
+  REQUIRE(tsimd::half_t(1.f + 1.f / 2048).bits == 0x3C00);
+  REQUIRE(tsimd::half_t(1.f + 3.f / 2048).bits == 0x3C02);
+  REQUIRE(tsimd::half_t(5.9604645e-8f).bits == 0x0001);
+  REQUIRE(float(tsimd::half_t(-2.5f)) == -2.5f);
+
+  std::array<float, 37> in, out;
+  std::array<tsimd::half_t, 37> halves;
+
+  for (size_t i = 0; i < in.size(); ++i)
+    in[i] = float(i) - 18.5f;
+
+  tsimd::convert_buffer(in.data(), halves.data(), in.size());
+  tsimd::convert_buffer(halves.data(), out.data(), in.size());
+
+  REQUIRE(in == out);
+}
+
+TEST_CASE("bfloat16_t load()/store()/dpbf16()", "[memory_operations]")
+{
+  REQUIRE(tsimd::bfloat16_t(1.f).bits == 0x3F80);
+  REQUIRE(tsimd::bfloat16_t(1.f + 1.f / 256).bits == 0x3F80);
+  REQUIRE(tsimd::bfloat16_t(1.f + 3.f / 256).bits == 0x3F82);
+  REQUIRE(tsimd::bfloat16_t(-3.5f).bits == 0xC060);
+
+  std::array<tsimd::bfloat16_t, 2 * TEST_WIDTH + 1> a, b;
+
+  for (int i = 0; i < 2 * TEST_WIDTH + 1; ++i) {
+    a[i] = float(i) - 3.f;
+    b[i] = float(i % 5) * 0.5f;
+  }
+
+  const vfloat f = tsimd::load<vfloat>(a.data() + 1);
+
+  for (int i = 0; i < TEST_WIDTH; ++i)
+    REQUIRE(f[i] == float(i) - 2.f);
+
+  vfloat r;
+
+  for (int i = 0; i < TEST_WIDTH; ++i)
+    r[i] = 1.f + float(i) / 128;
+
+  tsimd::store(r, b.data() + 1);
+
+  for (int i = 0; i < TEST_WIDTH; ++i)
+    REQUIRE(b[i + 1].bits == tsimd::bfloat16_t(r[i]).bits);
+
+  const vfloat acc = tsimd::dpbf16(vfloat(1.f), a.data(), b.data());
+
+  for (int i = 0; i < TEST_WIDTH; ++i) {
+    const float expected = 1.f + float(a[2 * i + 1]) * float(b[2 * i + 1]) +
+                           float(a[2 * i]) * float(b[2 * i]);
+    REQUIRE(acc[i] == expected);
+  }
+}
+#endif
+
 TEST_CASE("masked load()", "[memory_operations]")
 {
-  TSIMD_ALIGN(32) std::array<int_type, vint::static_size> values;
+  TSIMD_ALIGN(64) std::array<int_type, vint::static_size> values;
   std::fill(values.begin(), values.end(), 5);
 
   vbool m(true);
@@ -592,9 +1423,68 @@ TEST_CASE("masked load()", "[memory_operations]")
   REQUIRE(tsimd::all(v1 == expected));
 }
 
+TEST_CASE("masked store()", "[memory_operations]")
+{
+  TSIMD_ALIGN(64) std::array<float_type, vfloat::static_size> fvalues;
+  TSIMD_ALIGN(64) std::array<int_type, vint::static_size> ivalues;
+  std::fill(fvalues.begin(), fvalues.end(), float_type(-1));
+  std::fill(ivalues.begin(), ivalues.end(), int_type(-1));
+
+  vbool m;
+  vfloat f;
+  vint v;
+
+  for (int i = 0; i < TEST_WIDTH; ++i) {
+    m[i] = (i % 2) == 0;
+    f[i] = float_type(i);
+    v[i] = int_type(i);
+  }
+
+  tsimd::store(f, fvalues.data(), m);
+  tsimd::store(v, ivalues.data(), m);
+
+  for (int i = 0; i < TEST_WIDTH; ++i) {
+    REQUIRE(fvalues[i] == (m[i] ? float_type(i) : float_type(-1)));
+    REQUIRE(ivalues[i] == (m[i] ? int_type(i) : int_type(-1)));
+  }
+
+  const vfloat lf = tsimd::load<vfloat>(fvalues.data());
+  const vint lv   = tsimd::load<vint>(ivalues.data(), m);
+
+  for (int i = 0; i < TEST_WIDTH; ++i) {
+    REQUIRE(lf[i] == fvalues[i]);
+    if (m[i])
+      REQUIRE(lv[i] == int_type(i));
+  }
+
+#if TEST_SMALL_INTS
+  TSIMD_ALIGN(64) std::array<short, vshort::static_size> svalues;
+  std::fill(svalues.begin(), svalues.end(), short(-1));
+
+  tsimd::mask<short, vshort::static_size> ms;
+  vshort s;
+
+  for (int i = 0; i < vshort::static_size; ++i) {
+    ms[i] = (i % 3) == 1;
+    s[i]  = short(i);
+  }
+
+  tsimd::store(s, svalues.data(), ms);
+
+  for (int i = 0; i < vshort::static_size; ++i)
+    REQUIRE(svalues[i] == (ms[i] ? short(i) : short(-1)));
+
+  const vshort ls = tsimd::load<vshort>(svalues.data(), ms);
+
+  for (int i = 0; i < vshort::static_size; ++i)
+    if (ms[i])
+      REQUIRE(ls[i] == short(i));
+#endif
+}
+
 TEST_CASE("unmasked gather()", "[memory_operations]")
 {
-  TSIMD_ALIGN(32) std::array<int_type, vint::static_size> values;
+  TSIMD_ALIGN(64) std::array<int_type, vint::static_size> values;
   std::fill(values.begin(), values.end(), 4);
 
   vint offset;
@@ -605,9 +1495,55 @@ TEST_CASE("unmasked gather()", "[memory_operations]")
   REQUIRE(tsimd::all(result == 4));
 }
 
+TEST_CASE("per-lane gather()", "[memory_operations]")
+{
+  TSIMD_ALIGN(64) std::array<float_type, 2 * TEST_WIDTH> fvalues;
+  TSIMD_ALIGN(64) std::array<int_type, 2 * TEST_WIDTH> ivalues;
+
+  for (int i = 0; i < 2 * TEST_WIDTH; ++i) {
+    fvalues[i] = float_type(i) + float_type(0.5);
+    ivalues[i] = int_type(i) * 3;
+  }
+
+  vint offset;
+  vbool m;
+
+  for (int i = 0; i < TEST_WIDTH; ++i) {
+    offset[i] = int_type((i * 5) % (2 * TEST_WIDTH));
+    m[i]      = (i % 3) != 1;
+  }
+
+  const vfloat f  = tsimd::gather<vfloat>(fvalues.data(), offset);
+  const vint v    = tsimd::gather<vint>(ivalues.data(), offset);
+  const vfloat fm = tsimd::gather<vfloat>(fvalues.data(), offset, m);
+  const vint vm   = tsimd::gather<vint>(ivalues.data(), offset, m);
+
+  for (int i = 0; i < TEST_WIDTH; ++i) {
+    REQUIRE(f[i] == fvalues[offset[i]]);
+    REQUIRE(v[i] == ivalues[offset[i]]);
+    if (m[i]) {
+      REQUIRE(fm[i] == fvalues[offset[i]]);
+      REQUIRE(vm[i] == ivalues[offset[i]]);
+    }
+  }
+
+#if TEST_DOUBLE_PRECISION
+  // 64-bit element packs also take 32-bit offsets
+  tsimd::pack<int, TEST_WIDTH> offset32;
+
+  for (int i = 0; i < TEST_WIDTH; ++i)
+    offset32[i] = int(offset[i]);
+
+  const vfloat f32 = tsimd::gather<vfloat>(fvalues.data(), offset32);
+
+  for (int i = 0; i < TEST_WIDTH; ++i)
+    REQUIRE(f32[i] == fvalues[offset[i]]);
+#endif
+}
+
 TEST_CASE("unmasked store()", "[memory_operations]")
 {
-  TSIMD_ALIGN(32) std::array<int_type, vint::static_size> values;
+  TSIMD_ALIGN(64) std::array<int_type, vint::static_size> values;
 
   vint v1(7);
 
@@ -619,7 +1555,7 @@ TEST_CASE("unmasked store()", "[memory_operations]")
 
 TEST_CASE("unmasked scatter()", "[memory_operations]")
 {
-  TSIMD_ALIGN(32) std::array<int_type, vint::static_size> values;
+  TSIMD_ALIGN(64) std::array<int_type, vint::static_size> values;
 
   vint v1(5);
 
@@ -632,7 +1568,282 @@ TEST_CASE("unmasked scatter()", "[memory_operations]")
       values.begin(), values.end(), [](int_type v) { REQUIRE(v == 5); });
 }
 
+TEST_CASE("per-lane scatter()", "[memory_operations]")
+{
+  TSIMD_ALIGN(64) std::array<float_type, 2 * TEST_WIDTH> fvalues;
+  TSIMD_ALIGN(64) std::array<int_type, 2 * TEST_WIDTH> ivalues;
+  std::fill(fvalues.begin(), fvalues.end(), float_type(-1));
+  std::fill(ivalues.begin(), ivalues.end(), int_type(-1));
+
+  vfloat f;
+  vint v;
+  vint offset;
+  vbool m;
+
+  for (int i = 0; i < TEST_WIDTH; ++i) {
+    f[i]      = float_type(i) * float_type(2);
+    v[i]      = int_type(i) + 10;
+    offset[i] = int_type(2 * (TEST_WIDTH - 1 - i));
+    m[i]      = (i % 2) == 0;
+  }
+
+  tsimd::scatter(f, fvalues.data(), offset);
+  tsimd::scatter(v, ivalues.data(), offset, m);
+
+  for (int i = 0; i < TEST_WIDTH; ++i) {
+    REQUIRE(fvalues[offset[i]] == f[i]);
+    REQUIRE(ivalues[offset[i]] == (m[i] ? v[i] : int_type(-1)));
+  }
+}
+
+TEST_CASE("scaled gather()/scatter()", "[memory_operations]")
+{
+  struct item
+  {
+    float_type value;
+    int_type key;
+  };
+
+  std::array<item, 2 * TEST_WIDTH> items;
+
+  for (int i = 0; i < 2 * TEST_WIDTH; ++i) {
+    items[i].value = float_type(i) * float_type(0.25);
+    items[i].key   = int_type(i) * 7;
+  }
+
+  tsimd::pack<long long, TEST_WIDTH> index64;
+  tsimd::pack<unsigned int, TEST_WIDTH> index32;
+  vint bytes;
+  vbool m;
+
+  for (int i = 0; i < TEST_WIDTH; ++i) {
+    const int idx = (3 * i + 1) % (2 * TEST_WIDTH);
+    index64[i]    = 2 * idx;
+    index32[i]    = 2 * idx + 1;
+    bytes[i]      = int_type(idx * sizeof(item) + offsetof(item, key));
+    m[i]          = (i % 3) != 2;
+  }
+
+  // NOTE: 64-bit and unsigned offsets counting fields, byte offsets of keys
+
+  const vfloat values = tsimd::gather<vfloat>(items.data(), index64);
+  const vint keys     = tsimd::gather<vint>(items.data(), index32);
+  const vint mkeys    = tsimd::gather<vint, 1>(items.data(), bytes, m);
+
+  for (int i = 0; i < TEST_WIDTH; ++i) {
+    const int idx = (3 * i + 1) % (2 * TEST_WIDTH);
+    REQUIRE(values[i] == items[idx].value);
+    REQUIRE(keys[i] == items[idx].key);
+    REQUIRE(mkeys[i] == (m[i] ? items[idx].key : int_type(0)));
+  }
+
+  tsimd::scatter<1>(-keys, items.data(), bytes, m);
+  tsimd::scatter<sizeof(float_type)>(values + 1, items.data(), index64);
+
+  for (int i = 0; i < TEST_WIDTH; ++i) {
+    const int idx = (3 * i + 1) % (2 * TEST_WIDTH);
+    REQUIRE(items[idx].value == values[i] + 1);
+    REQUIRE(items[idx].key == (m[i] ? -keys[i] : keys[i]));
+  }
+}
+
+TEST_CASE("scatter_add()/scatter_min()/scatter_max()", "[memory_operations]")
+{
+  constexpr int bins = 3;
+
+  std::array<float_type, bins> sum, lo, hi, sum_ref, lo_ref, hi_ref;
+  std::array<int_type, bins> count, count_ref;
+
+  sum.fill(0);
+  lo.fill(100);
+  hi.fill(-100);
+  count.fill(0);
+  sum_ref   = sum;
+  lo_ref    = lo;
+  hi_ref    = hi;
+  count_ref = count;
+
+  vfloat v;
+  vint offset;
+  vbool m;
+
+  // NOTE: few bins, so most lanes collide with others
+  for (int i = 0; i < TEST_WIDTH; ++i) {
+    v[i]      = float_type((i * 7) % 11) - 4;
+    offset[i] = int_type((i * i) % bins);
+    m[i]      = (i % 4) != 3;
+  }
+
+  for (int pass = 0; pass < 2; ++pass) {
+    tsimd::scatter_add(v, sum.data(), offset);
+    tsimd::scatter_min(v, lo.data(), offset, m);
+    tsimd::scatter_max(v, hi.data(), offset);
+    tsimd::scatter_add(vint(1), count.data(), offset, m);
+
+    for (int i = 0; i < TEST_WIDTH; ++i) {
+      const int bin = offset[i];
+      sum_ref[bin] += v[i];
+      hi_ref[bin] = std::max(hi_ref[bin], v[i]);
+      if (m[i]) {
+        lo_ref[bin] = std::min(lo_ref[bin], v[i]);
+        count_ref[bin]++;
+      }
+    }
+  }
+
+  for (int b = 0; b < bins; ++b) {
+    REQUIRE(sum[b] == sum_ref[b]);
+    REQUIRE(lo[b] == lo_ref[b]);
+    REQUIRE(hi[b] == hi_ref[b]);
+    REQUIRE(count[b] == count_ref[b]);
+  }
+
+#if TEST_DOUBLE_PRECISION
+  // 64-bit elements also take 32-bit offsets
+  tsimd::pack<int, TEST_WIDTH> offset32;
+
+  for (int i = 0; i < TEST_WIDTH; ++i)
+    offset32[i] = int(offset[i]);
+
+  std::array<float_type, bins> sum32;
+  sum32.fill(0);
+
+  tsimd::scatter_add(v, sum32.data(), offset32);
+  tsimd::scatter_add(v, sum32.data(), offset32);
+
+  for (int b = 0; b < bins; ++b)
+    REQUIRE(sum32[b] == sum_ref[b]);
+#endif
+}
+
 #if !TEST_DOUBLE_PRECISION
+TEST_CASE("loadu()/storeu()", "[memory_operations]")
+{
+  std::array<float_type, TEST_WIDTH + 2> fbuf;
+  std::array<int_type, TEST_WIDTH + 2> ibuf;
+
+  for (int i = 0; i < TEST_WIDTH + 2; ++i) {
+    fbuf[i] = float_type(i) + float_type(0.5);
+    ibuf[i] = int_type(i) - 3;
+  }
+
+  // NOTE: one element past an aligned start is misaligned for every width
+
+  const vfloat lf = tsimd::loadu<vfloat>(fbuf.data() + 1);
+  const vint li   = tsimd::loadu<vint>(ibuf.data() + 1);
+
+  for (int i = 0; i < TEST_WIDTH; ++i) {
+    REQUIRE(lf[i] == fbuf[i + 1]);
+    REQUIRE(li[i] == ibuf[i + 1]);
+  }
+
+  fbuf.fill(float_type(-1));
+  ibuf.fill(int_type(-1));
+
+  tsimd::storeu(lf + float_type(1), fbuf.data() + 1);
+  tsimd::storeu(li * 2, ibuf.data() + 1);
+
+  REQUIRE(fbuf.front() == float_type(-1));
+  REQUIRE(fbuf.back() == float_type(-1));
+  REQUIRE(ibuf.front() == int_type(-1));
+  REQUIRE(ibuf.back() == int_type(-1));
+
+  for (int i = 0; i < TEST_WIDTH; ++i) {
+    REQUIRE(fbuf[i + 1] == lf[i] + float_type(1));
+    REQUIRE(ibuf[i + 1] == li[i] * 2);
+  }
+
+#if TEST_SMALL_INTS
+  std::array<short, TEST_WIDTH * 2 + 1> sbuf;
+  std::iota(sbuf.begin(), sbuf.end(), short(0));
+
+  const vshort ls = tsimd::loadu<vshort>(sbuf.data() + 1);
+  tsimd::storeu(ls + short(1), sbuf.data());
+
+  for (int i = 0; i < vshort::static_size; ++i) {
+    REQUIRE(ls[i] == short(i + 1));
+    REQUIRE(sbuf[i] == short(i + 2));
+  }
+#endif
+}
+
+TEST_CASE("stream_load()/stream_store()/prefetch()", "[memory_operations]")
+{
+  TSIMD_ALIGN(64) std::array<float_type, TEST_WIDTH> fbuf;
+  TSIMD_ALIGN(64) std::array<int_type, TEST_WIDTH> ibuf;
+
+  for (int i = 0; i < TEST_WIDTH; ++i) {
+    fbuf[i] = float_type(i) * 2;
+    ibuf[i] = int_type(i) + 11;
+  }
+
+  tsimd::prefetch(fbuf.data());
+  tsimd::prefetch<tsimd::prefetch_hint::nta>(ibuf.data());
+
+  const vfloat lf = tsimd::stream_load<vfloat>(fbuf.data());
+  const vint li   = tsimd::stream_load<vint>(ibuf.data());
+
+  for (int i = 0; i < TEST_WIDTH; ++i) {
+    REQUIRE(lf[i] == fbuf[i]);
+    REQUIRE(li[i] == ibuf[i]);
+  }
+
+  tsimd::stream_store(lf + float_type(1), fbuf.data());
+  tsimd::stream_store(li - 1, ibuf.data());
+  tsimd::stream_fence();
+
+  for (int i = 0; i < TEST_WIDTH; ++i) {
+    REQUIRE(fbuf[i] == lf[i] + float_type(1));
+    REQUIRE(ibuf[i] == li[i] - 1);
+  }
+}
+
+TEST_CASE("load_aos()/store_aos()", "[memory_operations]")
+{
+  std::array<float_type, 4 * TEST_WIDTH + 2> fbuf;
+  std::array<int_type, 3 * TEST_WIDTH + 2> ibuf;
+
+  for (int i = 0; i < int(fbuf.size()); ++i)
+    fbuf[i] = float_type(i);
+
+  for (int i = 0; i < int(ibuf.size()); ++i)
+    ibuf[i] = int_type(i) - 7;
+
+  // NOTE: offset by one element, records don't need to be aligned
+
+  vfloat rgba[4];
+  vint xyz[3];
+
+  tsimd::load_aos(fbuf.data() + 1, rgba);
+  tsimd::load_aos(ibuf.data() + 1, xyz);
+
+  for (int i = 0; i < TEST_WIDTH; ++i) {
+    for (int c = 0; c < 4; ++c)
+      REQUIRE(rgba[c][i] == fbuf[1 + i * 4 + c]);
+    for (int c = 0; c < 3; ++c)
+      REQUIRE(xyz[c][i] == ibuf[1 + i * 3 + c]);
+  }
+
+  std::array<float_type, 4 * TEST_WIDTH + 2> fout;
+  std::array<int_type, 3 * TEST_WIDTH + 2> iout;
+  fout.fill(float_type(-1));
+  iout.fill(int_type(-1));
+
+  tsimd::store_aos(fout.data() + 1, rgba);
+  tsimd::store_aos(iout.data() + 1, xyz);
+
+  REQUIRE(fout.front() == float_type(-1));
+  REQUIRE(fout.back() == float_type(-1));
+  REQUIRE(iout.front() == int_type(-1));
+  REQUIRE(iout.back() == int_type(-1));
+
+  for (int i = 1; i < int(fout.size()) - 1; ++i)
+    REQUIRE(fout[i] == fbuf[i]);
+
+  for (int i = 1; i < int(iout.size()) - 1; ++i)
+    REQUIRE(iout[i] == ibuf[i]);
+}
+
 TEST_CASE("reverse_bits()", "[memory_operations]")
 {
   vint v1(0x01020304);
@@ -656,6 +1867,210 @@ TEST_CASE("reverse_bits()", "[memory_operations]")
 }
 #endif
 
+// pack<> shuffles ////////////////////////////////////////////////////////////
+
+TEST_CASE("shuffle<>()", "[shuffles]")
+{
+  vfloat f1, f2;
+  vint i1;
+
+  for (int i = 0; i < TEST_WIDTH; ++i) {
+    f1[i] = float_type(i);
+    f2[i] = float_type(i + TEST_WIDTH);
+    i1[i] = int_type(i);
+  }
+
+#if TEST_WIDTH == 1
+  const vfloat fr  = tsimd::shuffle<0>(f1);
+  const vint ir    = tsimd::shuffle<0>(i1);
+  const vfloat f2r = tsimd::shuffle<1>(f1, f2);
+  const std::array<int, 1> two_source = {{1}};
+#elif TEST_WIDTH == 4
+  const vfloat fr  = tsimd::shuffle<3, 2, 1, 0>(f1);
+  const vint ir    = tsimd::shuffle<3, 2, 1, 0>(i1);
+  const vfloat f2r = tsimd::shuffle<1, 0, 7, 6>(f1, f2);
+  const std::array<int, 4> two_source = {{1, 0, 7, 6}};
+#elif TEST_WIDTH == 8
+  const vfloat fr  = tsimd::shuffle<7, 6, 5, 4, 3, 2, 1, 0>(f1);
+  const vint ir    = tsimd::shuffle<7, 6, 5, 4, 3, 2, 1, 0>(i1);
+  const vfloat f2r = tsimd::shuffle<0, 8, 1, 9, 2, 10, 3, 11>(f1, f2);
+  const std::array<int, 8> two_source = {{0, 8, 1, 9, 2, 10, 3, 11}};
+
+  // NOTE: same 4-lane pattern in both 128-bit halves
+  const vint il = tsimd::shuffle<3, 2, 1, 0, 7, 6, 5, 4>(i1);
+  const vfloat fl = tsimd::shuffle<1, 0, 9, 8, 5, 4, 13, 12>(f1, f2);
+
+  for (int i = 0; i < 8; ++i) {
+    REQUIRE(il[i] == (i ^ 3));
+    REQUIRE(fl[i] == ((i & 2) ? f2[i ^ 3] : f1[i ^ 1]));
+  }
+#elif TEST_WIDTH == 16
+  const vfloat fr =
+      tsimd::shuffle<15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0>(
+          f1);
+  const vint ir =
+      tsimd::shuffle<15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0>(
+          i1);
+  const vfloat f2r =
+      tsimd::shuffle<0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23>(
+          f1, f2);
+  const std::array<int, 16> two_source = {
+      {0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23}};
+#endif
+
+#if TEST_WIDTH <= 16
+  for (int i = 0; i < TEST_WIDTH; ++i) {
+    REQUIRE(fr[i] == f1[TEST_WIDTH - 1 - i]);
+    REQUIRE(ir[i] == i1[TEST_WIDTH - 1 - i]);
+
+    const int j = two_source[i];
+    REQUIRE(f2r[i] == (j < TEST_WIDTH ? f1[j] : f2[j - TEST_WIDTH]));
+  }
+#endif
+}
+
+TEST_CASE("permute()", "[shuffles]")
+{
+  vfloat f1, f2;
+  vint i1, idx, idx2;
+  vuint u1;
+
+  for (int i = 0; i < TEST_WIDTH; ++i) {
+    f1[i]   = float_type(i);
+    f2[i]   = -float_type(i + 1);
+    i1[i]   = int_type(i) * 10;
+    u1[i]   = uint_type(i) + 100;
+    idx[i]  = int_type((i * 5 + 3) % TEST_WIDTH);
+    idx2[i] = int_type((i * 3 + 1) % (2 * TEST_WIDTH));
+  }
+
+  const vfloat fr  = tsimd::permute(f1, idx);
+  const vint ir    = tsimd::permute(i1, idx);
+  const vuint ur   = tsimd::permute(u1, idx + TEST_WIDTH);
+  const vfloat f2r = tsimd::permute(f1, f2, idx2);
+
+  for (int i = 0; i < TEST_WIDTH; ++i) {
+    REQUIRE(fr[i] == f1[idx[i]]);
+    REQUIRE(ir[i] == i1[idx[i]]);
+    REQUIRE(ur[i] == u1[idx[i]]);
+
+    const int j = int(idx2[i]);
+    REQUIRE(f2r[i] == (j < TEST_WIDTH ? f1[j] : f2[j - TEST_WIDTH]));
+  }
+
+#if TEST_SMALL_INTS
+  vschar c, cidx;
+  vshort s, sidx;
+
+  for (int i = 0; i < vschar::static_size; ++i) {
+    c[i]    = static_cast<signed char>(i - 20);
+    cidx[i] = static_cast<signed char>(vschar::static_size - 1 - i);
+  }
+
+  for (int i = 0; i < vshort::static_size; ++i) {
+    s[i]    = static_cast<short>(i * 300);
+    sidx[i] = static_cast<short>((i * 3 + 2) % vshort::static_size);
+  }
+
+  const vschar cr = tsimd::permute(c, cidx);
+  const vshort sr = tsimd::permute(s, sidx);
+
+  for (int i = 0; i < vschar::static_size; ++i)
+    REQUIRE(cr[i] == c[cidx[i]]);
+
+  for (int i = 0; i < vshort::static_size; ++i)
+    REQUIRE(sr[i] == s[sidx[i]]);
+#endif
+}
+
+TEST_CASE("broadcast<>()", "[shuffles]")
+{
+  vfloat f;
+  vint v;
+
+  for (int i = 0; i < TEST_WIDTH; ++i) {
+    f[i] = float_type(i) + float_type(0.5);
+    v[i] = int_type(i) * 3;
+  }
+
+  REQUIRE(tsimd::all(tsimd::broadcast<0>(f) == f[0]));
+  REQUIRE(tsimd::all(tsimd::broadcast<TEST_WIDTH - 1>(f) == f[TEST_WIDTH - 1]));
+  REQUIRE(tsimd::all(tsimd::broadcast<TEST_WIDTH / 2>(v) == v[TEST_WIDTH / 2]));
+}
+
+TEST_CASE("rotate_lanes<>()/shift_lanes_up<>()/shift_lanes_down<>()",
+          "[shuffles]")
+{
+  vfloat f;
+  vint v;
+
+  for (int i = 0; i < TEST_WIDTH; ++i) {
+    f[i] = float_type(i + 1);
+    v[i] = int_type(i + 1);
+  }
+
+  const vfloat rd = tsimd::rotate_lanes<1>(f);
+  const vint ru   = tsimd::rotate_lanes<-3>(v);
+  const vfloat sd = tsimd::shift_lanes_down<1>(f);
+  const vint su   = tsimd::shift_lanes_up<3>(v);
+
+  for (int i = 0; i < TEST_WIDTH; ++i) {
+    REQUIRE(rd[i] == f[(i + 1) % TEST_WIDTH]);
+    REQUIRE(ru[i] == v[(i + TEST_WIDTH * 3 - 3) % TEST_WIDTH]);
+    REQUIRE(sd[i] == (i + 1 < TEST_WIDTH ? f[i + 1] : float_type(0)));
+    REQUIRE(su[i] == (i >= 3 ? v[i - 3] : int_type(0)));
+  }
+
+  REQUIRE(tsimd::all(tsimd::shift_lanes_down<TEST_WIDTH>(v) == 0));
+  REQUIRE(tsimd::all(tsimd::shift_lanes_up<0>(v) == v));
+
+#if TEST_SMALL_INTS
+  vschar c;
+  vushort s;
+
+  for (int i = 0; i < vschar::static_size; ++i)
+    c[i] = static_cast<signed char>(i + 1);
+
+  for (int i = 0; i < vushort::static_size; ++i)
+    s[i] = static_cast<unsigned short>(i * 1000 + 1);
+
+  const vschar cr    = tsimd::rotate_lanes<5>(c);
+  const vschar cd    = tsimd::shift_lanes_down<3>(c);
+  const vushort su16 = tsimd::shift_lanes_up<1>(s);
+
+  for (int i = 0; i < vschar::static_size; ++i) {
+    REQUIRE(cr[i] == c[(i + 5) % vschar::static_size]);
+    REQUIRE(cd[i] == (i + 3 < vschar::static_size ? c[i + 3] : 0));
+  }
+
+  for (int i = 0; i < vushort::static_size; ++i)
+    REQUIRE(su16[i] == (i >= 1 ? s[i - 1] : 0));
+#endif
+}
+
+TEST_CASE("transpose()", "[shuffles]")
+{
+  vfloat f[TEST_WIDTH];
+  vuint u[TEST_WIDTH];
+
+  for (int i = 0; i < TEST_WIDTH; ++i) {
+    for (int j = 0; j < TEST_WIDTH; ++j) {
+      f[i][j] = float_type(i * TEST_WIDTH + j);
+      u[i][j] = uint_type(j * TEST_WIDTH + i) + 3;
+    }
+  }
+
+  tsimd::transpose(f);
+  tsimd::transpose(u);
+
+  for (int i = 0; i < TEST_WIDTH; ++i) {
+    for (int j = 0; j < TEST_WIDTH; ++j) {
+      REQUIRE(f[i][j] == float_type(j * TEST_WIDTH + i));
+      REQUIRE(u[i][j] == uint_type(i * TEST_WIDTH + j) + 3);
+    }
+  }
+}
+
 // random numbers /////////////////////////////////////////////////////////////
 
 TEST_CASE("uniform_random_distribution()", "[random]")
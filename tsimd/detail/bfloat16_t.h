@@ -0,0 +1,94 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Intel Corporation                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+
+#include "config.h"
+
+TSIMD_NAMESPACE_BEGIN
+
+  namespace detail {
+
+    // bfloat16 <--> float bit conversions ////////////////////////////////////
+
+    TSIMD_INLINE float bfloat16_bits_to_float(uint16_t b)
+    {
+      const uint32_t bits = uint32_t(b) << 16;
+
+      float f;
+      std::memcpy(&f, &bits, sizeof(f));
+      return f;
+    }
+
+    // NOTE: rounds to nearest even, nans stay quiet
+    TSIMD_INLINE uint16_t float_to_bfloat16_bits(float f)
+    {
+      uint32_t x;
+      std::memcpy(&x, &f, sizeof(x));
+
+      if ((x & 0x7FFFFFFF) > 0x7F800000)
+        return uint16_t((x >> 16) | 0x40);
+
+      x += 0x7FFF + ((x >> 16) & 1);
+      return uint16_t(x >> 16);
+    }
+
+  }  // namespace detail
+
+  // 16-bit brain float storage type //////////////////////////////////////////
+
+  // NOTE: this type is only a storage format, math is done on vfloat packs
+  //       after converting with load<vfloatN>(const bfloat16_t *)
+  struct bfloat16_t
+  {
+    bfloat16_t()                   = default;
+    bfloat16_t(const bfloat16_t &) = default;
+    bfloat16_t(bfloat16_t &&)      = default;
+    bfloat16_t &operator=(const bfloat16_t &) = default;
+    bfloat16_t &operator=(bfloat16_t &&) = default;
+
+    TSIMD_INLINE bfloat16_t(float f) noexcept
+        : bits(detail::float_to_bfloat16_bits(f))
+    {
+    }
+
+    TSIMD_INLINE operator float() const noexcept
+    {
+      return detail::bfloat16_bits_to_float(bits);
+    }
+
+    uint16_t bits;
+  };
+
+  TSIMD_INLINE std::ostream &operator<<(std::ostream &o, const bfloat16_t &b)
+  {
+    o << static_cast<float>(b);
+    return o;
+  }
+
+TSIMD_NAMESPACE_END  // namespace tsimd
\ No newline at end of file
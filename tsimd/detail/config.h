@@ -30,7 +30,34 @@
 #define TSIMD_WIN 0
 #endif
 
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || \
+    defined(_M_IX86)
+#define TSIMD_X86 1
 #include <immintrin.h>
+#else
+#define TSIMD_X86 0
+#endif
+
+// NOTE: with TSIMD_VECTOR_EXTENSIONS, packs without a native intrinsic type
+//       for the enabled ISA (all of them on non-x86 or flag-less builds) are
+//       stored as GCC/Clang vector types and use the compiler's generic
+//       vector operations instead of scalar loops
+#if !defined(TSIMD_VECTOR_EXTENSIONS)
+#define TSIMD_VECTOR_EXTENSIONS 0
+#endif
+
+// NOTE: masked load()/store() never touch the memory of inactive lanes, so
+//       they are safe at the end of a buffer and next to other threads'
+//       data. ISAs without masked moves fall back to per-lane loops, unless
+//       TSIMD_MASKED_MEMORY_RMW lets them read (and for stores, write back)
+//       the whole vector instead.
+#if !defined(TSIMD_MASKED_MEMORY_RMW)
+#define TSIMD_MASKED_MEMORY_RMW 0
+#endif
+
+#if TSIMD_VECTOR_EXTENSIONS && TSIMD_WIN
+#error "TSIMD_VECTOR_EXTENSIONS requires GCC or Clang vector extensions!"
+#endif
 
 #if defined(__AVX512F__)
 #define TSIMD_DEFAULT_WIDTH 16
@@ -48,6 +75,10 @@
 #endif
 #endif
 
+#if !defined(TSIMD_DEFAULT_WIDTH) && TSIMD_VECTOR_EXTENSIONS
+#define TSIMD_DEFAULT_WIDTH 4
+#endif
+
 #if !defined(TSIMD_DEFAULT_WIDTH)
 #define TSIMD_DEFAULT_WIDTH 1
 #endif
@@ -68,6 +99,22 @@
 #define TSIMD_INLINE inline __attribute__((always_inline))
 #endif
 
+// NOTE: translation units built for runtime dispatch (see dispatch.h) compile
+//       the library once per ISA, so each copy lives in its own inline
+//       namespace to keep the linker from merging functions built for
+//       different instruction sets
+#if defined(TSIMD_DISPATCH_TARGET)
+#define TSIMD_NAMESPACE_BEGIN \
+  namespace tsimd {           \
+  inline namespace TSIMD_DISPATCH_TARGET {
+#define TSIMD_NAMESPACE_END \
+  }                         \
+  }
+#else
+#define TSIMD_NAMESPACE_BEGIN namespace tsimd {
+#define TSIMD_NAMESPACE_END }
+#endif
+
 #if 0
 #define NOT_YET_IMPLEMENTED \
   static_assert(false, "This function is not yet implemented!");
@@ -0,0 +1,367 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Intel Corporation                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+#include "config.h"
+
+#if TSIMD_WIN
+#include <intrin.h>
+#elif TSIMD_X86
+#include <cpuid.h>
+#endif
+
+// NOTE: runtime dispatch works by compiling the same kernel source once per
+//       ISA (see tsimd_add_dispatch_sources() in cmake/tsimd.cmake), where
+//       TSIMD_DISPATCH_TARGET names the ISA a translation unit is built for
+//       and TSIMD_DISPATCH_HAS_[ISA] is defined for every ISA compiled in.
+//       Kernels are defined inside 'namespace TSIMD_DISPATCH_TARGET {}' and
+//       declared once, in the same enclosing namespace, with:
+//
+//         TSIMD_DISPATCH(saxpy, void(float, const float *, float *, int));
+//
+//       ...which provides a 'saxpy' function object calling the best variant
+//       the CPU supports. The choice is made on the first call and then
+//       cached in a function pointer.
+
+TSIMD_NAMESPACE_BEGIN
+
+  // ISAs which kernels can be dispatched to //////////////////////////////////
+
+  // NOTE: ordered from least to most capable, matching TSIMD_BUILD_ISA
+  enum class isa
+  {
+    sse4,
+    avx,
+    avx2,
+    avx512knl,
+    avx512skx
+  };
+
+  namespace detail {
+
+    static constexpr int num_isas = int(isa::avx512skx) + 1;
+
+    struct cpuid_regs
+    {
+      uint32_t eax;
+      uint32_t ebx;
+      uint32_t ecx;
+      uint32_t edx;
+    };
+
+    inline cpuid_regs cpuid(uint32_t leaf, uint32_t subleaf = 0)
+    {
+      cpuid_regs r;
+#if TSIMD_WIN
+      int out[4];
+      __cpuidex(out, int(leaf), int(subleaf));
+      r.eax = uint32_t(out[0]);
+      r.ebx = uint32_t(out[1]);
+      r.ecx = uint32_t(out[2]);
+      r.edx = uint32_t(out[3]);
+#elif TSIMD_X86
+      __cpuid_count(leaf, subleaf, r.eax, r.ebx, r.ecx, r.edx);
+#else
+      // NOTE: no x86 ISA is ever supported on other architectures
+      (void)leaf;
+      (void)subleaf;
+      r = cpuid_regs{0, 0, 0, 0};
+#endif
+      return r;
+    }
+
+    inline uint64_t xgetbv0()
+    {
+#if TSIMD_WIN
+      return _xgetbv(0);
+#elif TSIMD_X86
+      uint32_t lo, hi;
+      __asm__("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+      return (uint64_t(hi) << 32) | lo;
+#else
+      return 0;
+#endif
+    }
+
+    inline bool has_bits(uint32_t reg, uint32_t bits)
+    {
+      return (reg & bits) == bits;
+    }
+
+    // NOTE: each ISA requires the same feature set as its FLAGS_[ISA] in
+    //       cmake/gcc.cmake, plus the OS saving the register state it uses
+    inline int detect_supported_isas()
+    {
+      const cpuid_regs empty{0, 0, 0, 0};
+
+      const cpuid_regs leaf0  = cpuid(0);
+      const cpuid_regs leafe0 = cpuid(0x80000000);
+      const cpuid_regs leaf1  = leaf0.eax >= 1 ? cpuid(1) : empty;
+      const cpuid_regs leaf7  = leaf0.eax >= 7 ? cpuid(7, 0) : empty;
+      const cpuid_regs leafe1 =
+          leafe0.eax >= 0x80000001 ? cpuid(0x80000001) : empty;
+
+      bool ymm_enabled = false;
+      bool zmm_enabled = false;
+      if (has_bits(leaf1.ecx, 1u << 27)) {  // OSXSAVE
+        const uint64_t xcr0 = xgetbv0();
+        ymm_enabled         = (xcr0 & 0x06) == 0x06;
+        zmm_enabled         = ymm_enabled && (xcr0 & 0xe0) == 0xe0;
+      }
+
+      // SSE4.1, SSE4.2
+      const bool sse4 = has_bits(leaf1.ecx, (1u << 19) | (1u << 20));
+
+      // AVX
+      const bool avx = sse4 && ymm_enabled && has_bits(leaf1.ecx, 1u << 28);
+
+      // FMA, F16C, BMI1, AVX2, BMI2, LZCNT
+      const bool avx2 =
+          avx && has_bits(leaf1.ecx, (1u << 12) | (1u << 29)) &&
+          has_bits(leaf7.ebx, (1u << 3) | (1u << 5) | (1u << 8)) &&
+          has_bits(leafe1.ecx, 1u << 5);
+
+      // AVX512F, AVX512CD
+      const bool avx512 =
+          avx2 && zmm_enabled && has_bits(leaf7.ebx, (1u << 16) | (1u << 28));
+
+      // AVX512PF, AVX512ER
+      const bool knl = avx512 && has_bits(leaf7.ebx, (1u << 26) | (1u << 27));
+
+      // AVX512DQ, AVX512BW, AVX512VL
+      const bool skx =
+          avx512 && has_bits(leaf7.ebx, (1u << 17) | (1u << 30) | (1u << 31));
+
+      return int(sse4) << int(isa::sse4) | int(avx) << int(isa::avx) |
+             int(avx2) << int(isa::avx2) | int(knl) << int(isa::avx512knl) |
+             int(skx) << int(isa::avx512skx);
+    }
+
+    // NOTE: setting TSIMD_DISPATCH_MAX_ISA (e.g. to 'avx2') in the
+    //       environment caps which variants get picked, which is handy to
+    //       exercise the lower ISA paths on a single machine
+    inline int detect_allowed_isas()
+    {
+      const char *max_isa = std::getenv("TSIMD_DISPATCH_MAX_ISA");
+
+      if (!max_isa)
+        return ~0;
+
+      const char *names[num_isas] = {
+          "sse4", "avx", "avx2", "avx512knl", "avx512skx"};
+
+      for (int i = 0; i < num_isas; ++i) {
+        if (std::strcmp(max_isa, names[i]) == 0)
+          return (1 << (i + 1)) - 1;
+      }
+
+      return ~0;
+    }
+
+    inline int available_isas()
+    {
+      static const int isas = detect_supported_isas() & detect_allowed_isas();
+      return isas;
+    }
+
+    template <typename T>
+    using identity_t = T;
+
+  }  // namespace detail
+
+  inline bool cpu_supports(isa target)
+  {
+    return (detail::available_isas() & (1 << int(target))) != 0;
+  }
+
+  inline const char *isa_name(isa target)
+  {
+    switch (target) {
+    case isa::sse4:
+      return "SSE4";
+    case isa::avx:
+      return "AVX";
+    case isa::avx2:
+      return "AVX2";
+    case isa::avx512knl:
+      return "AVX512KNL";
+    case isa::avx512skx:
+      return "AVX512SKX";
+    }
+
+    return "UNKNOWN";
+  }
+
+  // Dispatch table (one entry per ISA, nullptr if not compiled in) ///////////
+
+  template <typename FCN_T>
+  using dispatch_table =
+      std::array<typename std::add_pointer<FCN_T>::type, detail::num_isas>;
+
+  // Dispatcher ///////////////////////////////////////////////////////////////
+
+  template <typename VARIANTS_T, typename FCN_T>
+  struct dispatcher;
+
+  template <typename VARIANTS_T, typename R, typename... ARGS>
+  struct dispatcher<VARIANTS_T, R(ARGS...)>
+  {
+    using fcn_t = R (*)(ARGS...);
+
+    R operator()(ARGS... args) const
+    {
+      const fcn_t fcn = selected.load(std::memory_order_relaxed);
+      return fcn(std::forward<ARGS>(args)...);
+    }
+
+    // NOTE: throws if none of the compiled variants runs on this CPU
+    static isa target()
+    {
+      static const isa t = select_target();
+      return t;
+    }
+
+   private:
+    static isa select_target()
+    {
+      const dispatch_table<R(ARGS...)> variants = VARIANTS_T::variants();
+
+      // NOTE: walks from most to least capable, no CPU has both KNL and SKX
+      for (int i = detail::num_isas - 1; i >= 0; --i) {
+        if (variants[i] && cpu_supports(isa(i)))
+          return isa(i);
+      }
+
+      throw std::runtime_error(
+          "tsimd::dispatcher: no compiled variant is supported by this CPU");
+    }
+
+    static R resolve(ARGS... args)
+    {
+      const fcn_t fcn = VARIANTS_T::variants()[int(target())];
+      selected.store(fcn, std::memory_order_relaxed);
+      return fcn(std::forward<ARGS>(args)...);
+    }
+
+    // NOTE: starts out pointing at resolve(), which is constant initialized
+    //       so calls made during static initialization still dispatch
+    static std::atomic<fcn_t> selected;
+  };
+
+  template <typename VARIANTS_T, typename R, typename... ARGS>
+  std::atomic<R (*)(ARGS...)> dispatcher<VARIANTS_T, R(ARGS...)>::selected{
+      &dispatcher<VARIANTS_T, R(ARGS...)>::resolve};
+
+TSIMD_NAMESPACE_END  // namespace tsimd
+
+// Per-ISA declarations and table entries /////////////////////////////////////
+
+#if defined(TSIMD_DISPATCH_HAS_SSE4)
+#define TSIMD_DISPATCH_DECLARE_SSE4(NAME, ...)                                \
+  namespace sse4 {                                                            \
+    ::tsimd::detail::identity_t<__VA_ARGS__> NAME;                            \
+  }
+#define TSIMD_DISPATCH_ENTRY_SSE4(NAME) &sse4::NAME
+#else
+#define TSIMD_DISPATCH_DECLARE_SSE4(NAME, ...)
+#define TSIMD_DISPATCH_ENTRY_SSE4(NAME) nullptr
+#endif
+
+#if defined(TSIMD_DISPATCH_HAS_AVX)
+#define TSIMD_DISPATCH_DECLARE_AVX(NAME, ...)                                 \
+  namespace avx {                                                             \
+    ::tsimd::detail::identity_t<__VA_ARGS__> NAME;                            \
+  }
+#define TSIMD_DISPATCH_ENTRY_AVX(NAME) &avx::NAME
+#else
+#define TSIMD_DISPATCH_DECLARE_AVX(NAME, ...)
+#define TSIMD_DISPATCH_ENTRY_AVX(NAME) nullptr
+#endif
+
+#if defined(TSIMD_DISPATCH_HAS_AVX2)
+#define TSIMD_DISPATCH_DECLARE_AVX2(NAME, ...)                                \
+  namespace avx2 {                                                            \
+    ::tsimd::detail::identity_t<__VA_ARGS__> NAME;                            \
+  }
+#define TSIMD_DISPATCH_ENTRY_AVX2(NAME) &avx2::NAME
+#else
+#define TSIMD_DISPATCH_DECLARE_AVX2(NAME, ...)
+#define TSIMD_DISPATCH_ENTRY_AVX2(NAME) nullptr
+#endif
+
+#if defined(TSIMD_DISPATCH_HAS_AVX512KNL)
+#define TSIMD_DISPATCH_DECLARE_AVX512KNL(NAME, ...)                           \
+  namespace avx512knl {                                                       \
+    ::tsimd::detail::identity_t<__VA_ARGS__> NAME;                            \
+  }
+#define TSIMD_DISPATCH_ENTRY_AVX512KNL(NAME) &avx512knl::NAME
+#else
+#define TSIMD_DISPATCH_DECLARE_AVX512KNL(NAME, ...)
+#define TSIMD_DISPATCH_ENTRY_AVX512KNL(NAME) nullptr
+#endif
+
+#if defined(TSIMD_DISPATCH_HAS_AVX512SKX)
+#define TSIMD_DISPATCH_DECLARE_AVX512SKX(NAME, ...)                           \
+  namespace avx512skx {                                                       \
+    ::tsimd::detail::identity_t<__VA_ARGS__> NAME;                            \
+  }
+#define TSIMD_DISPATCH_ENTRY_AVX512SKX(NAME) &avx512skx::NAME
+#else
+#define TSIMD_DISPATCH_DECLARE_AVX512SKX(NAME, ...)
+#define TSIMD_DISPATCH_ENTRY_AVX512SKX(NAME) nullptr
+#endif
+
+// Kernel declaration //////////////////////////////////////////////////////////
+
+#define TSIMD_DISPATCH(NAME, ...)                                             \
+  TSIMD_DISPATCH_DECLARE_SSE4(NAME, __VA_ARGS__)                              \
+  TSIMD_DISPATCH_DECLARE_AVX(NAME, __VA_ARGS__)                               \
+  TSIMD_DISPATCH_DECLARE_AVX2(NAME, __VA_ARGS__)                              \
+  TSIMD_DISPATCH_DECLARE_AVX512KNL(NAME, __VA_ARGS__)                         \
+  TSIMD_DISPATCH_DECLARE_AVX512SKX(NAME, __VA_ARGS__)                         \
+                                                                              \
+  struct NAME##_dispatch_variants                                             \
+  {                                                                           \
+    static ::tsimd::dispatch_table<__VA_ARGS__> variants()                    \
+    {                                                                         \
+      return {{TSIMD_DISPATCH_ENTRY_SSE4(NAME),                               \
+               TSIMD_DISPATCH_ENTRY_AVX(NAME),                                \
+               TSIMD_DISPATCH_ENTRY_AVX2(NAME),                               \
+               TSIMD_DISPATCH_ENTRY_AVX512KNL(NAME),                          \
+               TSIMD_DISPATCH_ENTRY_AVX512SKX(NAME)}};                        \
+    }                                                                         \
+  };                                                                          \
+                                                                              \
+  constexpr ::tsimd::dispatcher<NAME##_dispatch_variants, __VA_ARGS__> NAME   \
+  {                                                                           \
+  }
@@ -26,7 +26,10 @@
 
 #include "algorithm/all.h"
 #include "algorithm/any.h"
+#include "algorithm/compress.h"
 #include "algorithm/foreach.h"
 #include "algorithm/near_equal.h"
+#include "algorithm/reduce.h"
+#include "algorithm/scan.h"
 #include "algorithm/select.h"
 #include "algorithm/set_if.h"
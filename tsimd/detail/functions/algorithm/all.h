@@ -28,7 +28,7 @@
 
 #include "any.h"
 
-namespace tsimd {
+TSIMD_NAMESPACE_BEGIN
 
   // 1-wide //
 
@@ -46,7 +46,9 @@ namespace tsimd {
 
   TSIMD_INLINE bool all(const vboolf4 &a)
   {
-#if defined(__SSE__)
+#if defined(__AVX512VL__)
+    return static_cast<__mmask8>(a) == 0xF;
+#elif defined(__SSE__)
     return _mm_movemask_ps(a) == 0xf;
 #else
     for (int i = 0; i < 4; ++i) {
@@ -60,19 +62,27 @@ namespace tsimd {
 
   TSIMD_INLINE bool all(const vboold4 &a)
   {
+#if defined(__AVX512VL__)
+    return static_cast<__mmask8>(a) == 0xF;
+#elif defined(__AVX__)
+    return _mm256_movemask_pd(a) == 0xf;
+#else
     for (int i = 0; i < 4; ++i) {
       if (!a[i])
         return false;
     }
 
     return true;
+#endif
   }
 
   // 8-wide //
 
   TSIMD_INLINE bool all(const vboolf8 &a)
   {
-#if defined(__AVX512F__) || defined(__AVX2__) || defined(__AVX__)
+#if defined(__AVX512VL__)
+    return static_cast<__mmask8>(a) == 0xFF;
+#elif defined(__AVX512F__) || defined(__AVX2__) || defined(__AVX__)
     return _mm256_movemask_ps(a) == (unsigned int)0xff;
 #else
     return all(vboolf4(a.vl)) && all(vboolf4(a.vh));
@@ -81,7 +91,11 @@ namespace tsimd {
   
   TSIMD_INLINE bool all(const vboold8 &a)
   {
+#if defined(__AVX512F__)
+    return static_cast<__mmask8>(a) == 0xFF;
+#else
     return all(vboold4(a.vl)) && all(vboold4(a.vh));
+#endif
   }
 
   // 16-wide //
@@ -97,7 +111,98 @@ namespace tsimd {
 
   TSIMD_INLINE bool all(const vboold16 &a)
   {
+#if defined(__AVX512F__)
+    return _mm512_kortestc(a, a) != 0;
+#else
     return all(vboold8(a.vl)) && all(vboold8(a.vh));
+#endif
+  }
+
+  // 8/16-bit //
+
+  TSIMD_INLINE bool all(const vboolc16 &a)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    return _mm512_kortestc(a, a) != 0;
+#elif defined(__SSE__)
+    return _mm_movemask_epi8(a) == 0xFFFF;
+#else
+    for (int i = 0; i < 16; ++i) {
+      if (!a[i])
+        return false;
+    }
+
+    return true;
+#endif
+  }
+
+  TSIMD_INLINE bool all(const vbools8 &a)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    return static_cast<__mmask8>(a) == 0xFF;
+#elif defined(__SSE__)
+    return _mm_movemask_epi8(a) == 0xFFFF;
+#else
+    for (int i = 0; i < 8; ++i) {
+      if (!a[i])
+        return false;
+    }
+
+    return true;
+#endif
+  }
+
+  TSIMD_INLINE bool all(const vboolc32 &a)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    return _kortestc_mask32_u8(a, a) != 0;
+#elif defined(__AVX__)
+    return _mm256_testc_si256(a, _mm256_set1_epi32(-1)) != 0;
+#else
+    return all(vboolc16(a.vl)) && all(vboolc16(a.vh));
+#endif
+  }
+
+  TSIMD_INLINE bool all(const vbools16 &a)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    return _mm512_kortestc(a, a) != 0;
+#elif defined(__AVX__)
+    return _mm256_testc_si256(a, _mm256_set1_epi32(-1)) != 0;
+#else
+    return all(vbools8(a.vl)) && all(vbools8(a.vh));
+#endif
+  }
+
+  TSIMD_INLINE bool all(const vboolc64 &a)
+  {
+#if defined(__AVX512BW__)
+    return _kortestc_mask64_u8(a, a) != 0;
+#elif defined(__AVX512F__)
+    return _mm512_cmpneq_epi32_mask(a, _mm512_set1_epi32(-1)) == 0x0;
+#else
+    return all(vboolc32(a.vl)) && all(vboolc32(a.vh));
+#endif
+  }
+
+  TSIMD_INLINE bool all(const vbools32 &a)
+  {
+#if defined(__AVX512BW__)
+    return _kortestc_mask32_u8(a, a) != 0;
+#elif defined(__AVX512F__)
+    return _mm512_cmpneq_epi32_mask(a, _mm512_set1_epi32(-1)) == 0x0;
+#else
+    return all(vbools16(a.vl)) && all(vbools16(a.vh));
+#endif
+  }
+
+
+  // wide //
+
+  template <typename T, int W, typename = traits::is_wide_pack_t<T, W>>
+  TSIMD_INLINE bool all(const pack<T, W> &m)
+  {
+    return all(m.vl) && all(m.vh);
   }
 
-}  // namespace tsimd
\ No newline at end of file
+TSIMD_NAMESPACE_END  // namespace tsimd
\ No newline at end of file
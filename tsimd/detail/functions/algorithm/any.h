@@ -26,7 +26,7 @@
 
 #include "../../pack.h"
 
-namespace tsimd {
+TSIMD_NAMESPACE_BEGIN
 
   // 1-wide //
 
@@ -40,7 +40,9 @@ namespace tsimd {
 
   TSIMD_INLINE bool any(const vboolf4 &a)
   {
-#if defined(__SSE__)
+#if defined(__AVX512VL__)
+    return static_cast<__mmask8>(a) != 0x0;
+#elif defined(__SSE__)
     return _mm_movemask_ps(a) != 0x0;
 #else
     for (int i = 0; i < 4; ++i) {
@@ -54,19 +56,27 @@ namespace tsimd {
 
   TSIMD_INLINE bool any(const vboold4 &a)
   {
+#if defined(__AVX512VL__)
+    return static_cast<__mmask8>(a) != 0x0;
+#elif defined(__AVX__)
+    return _mm256_movemask_pd(a) != 0x0;
+#else
     for (int i = 0; i < 4; ++i) {
       if (a[i])
         return true;
     }
 
     return false;
+#endif
   }
 
   // 8-wide //
 
   TSIMD_INLINE bool any(const vboolf8 &a)
   {
-#if defined(__AVX512F__) || defined(__AVX2__) || defined(__AVX__)
+#if defined(__AVX512VL__)
+    return static_cast<__mmask8>(a) != 0x0;
+#elif defined(__AVX512F__) || defined(__AVX2__) || defined(__AVX__)
     return !_mm256_testz_ps(a, a);
 #else
     return any(vboolf4(a.vl)) || any(vboolf4(a.vh));
@@ -75,7 +85,11 @@ namespace tsimd {
 
   TSIMD_INLINE bool any(const vboold8 &a)
   {
+#if defined(__AVX512F__)
+    return _mm512_kortestz(a, a) == 0;
+#else
     return any(vboold4(a.vl)) || any(vboold4(a.vh));
+#endif
   }
 
   // 16-wide //
@@ -91,7 +105,97 @@ namespace tsimd {
 
   TSIMD_INLINE bool any(const vboold16 &a)
   {
+#if defined(__AVX512F__)
+    return _mm512_kortestz(a, a) == 0;
+#else
     return any(vboold8(a.vl)) || any(vboold8(a.vh));
+#endif
+  }
+
+  // 8/16-bit //
+
+  TSIMD_INLINE bool any(const vboolc16 &a)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    return _mm512_kortestz(a, a) == 0;
+#elif defined(__SSE__)
+    return _mm_movemask_epi8(a) != 0x0;
+#else
+    for (int i = 0; i < 16; ++i) {
+      if (a[i])
+        return true;
+    }
+
+    return false;
+#endif
+  }
+
+  TSIMD_INLINE bool any(const vbools8 &a)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    return static_cast<__mmask8>(a) != 0x0;
+#elif defined(__SSE__)
+    return _mm_movemask_epi8(a) != 0x0;
+#else
+    for (int i = 0; i < 8; ++i) {
+      if (a[i])
+        return true;
+    }
+
+    return false;
+#endif
+  }
+
+  TSIMD_INLINE bool any(const vboolc32 &a)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    return _kortestz_mask32_u8(a, a) == 0;
+#elif defined(__AVX__)
+    return !_mm256_testz_si256(a, a);
+#else
+    return any(vboolc16(a.vl)) || any(vboolc16(a.vh));
+#endif
+  }
+
+  TSIMD_INLINE bool any(const vbools16 &a)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    return _mm512_kortestz(a, a) == 0;
+#elif defined(__AVX__)
+    return !_mm256_testz_si256(a, a);
+#else
+    return any(vbools8(a.vl)) || any(vbools8(a.vh));
+#endif
+  }
+
+  TSIMD_INLINE bool any(const vboolc64 &a)
+  {
+#if defined(__AVX512BW__)
+    return _kortestz_mask64_u8(a, a) == 0;
+#elif defined(__AVX512F__)
+    return _mm512_test_epi32_mask(a, a) != 0x0;
+#else
+    return any(vboolc32(a.vl)) || any(vboolc32(a.vh));
+#endif
+  }
+
+  TSIMD_INLINE bool any(const vbools32 &a)
+  {
+#if defined(__AVX512BW__)
+    return _kortestz_mask32_u8(a, a) == 0;
+#elif defined(__AVX512F__)
+    return _mm512_test_epi32_mask(a, a) != 0x0;
+#else
+    return any(vbools16(a.vl)) || any(vbools16(a.vh));
+#endif
+  }
+
+  // wide //
+
+  template <typename T, int W, typename = traits::is_wide_pack_t<T, W>>
+  TSIMD_INLINE bool any(const pack<T, W> &m)
+  {
+    return any(m.vl) || any(m.vh);
   }
 
   // none() ///////////////////////////////////////////////////////////////////
@@ -102,4 +206,4 @@ namespace tsimd {
     return !any(m);
   }
 
-}  // namespace tsimd
\ No newline at end of file
+TSIMD_NAMESPACE_END  // namespace tsimd
\ No newline at end of file
@@ -0,0 +1,812 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Intel Corporation                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+#pragma once
+
+#include <bitset>
+#include <cstdint>
+#include <cstring>
+
+#include "../../pack.h"
+
+#include "../../operators/arithmetic/plus.h"
+#include "../../operators/logic/less_than.h"
+#include "../shuffle/permute.h"
+#include "select.h"
+
+TSIMD_NAMESPACE_BEGIN
+
+  namespace detail {
+
+    // Active lanes of a mask as bits /////////////////////////////////////////
+
+    template <typename B, int W>
+    TSIMD_INLINE unsigned long long active_bits(const pack<B, W> &m)
+    {
+      unsigned long long bits = 0;
+
+      for (int i = 0; i < W; ++i)
+        if (m[i])
+          bits |= 1ULL << i;
+
+      return bits;
+    }
+
+    TSIMD_INLINE unsigned long long active_bits(const vboolf4 &m)
+    {
+#if defined(__AVX512VL__)
+      return static_cast<__mmask8>(m);
+#elif defined(__SSE__)
+      return _mm_movemask_ps(m);
+#else
+      return active_bits<bool32_t, 4>(m);
+#endif
+    }
+
+    TSIMD_INLINE unsigned long long active_bits(const vboold4 &m)
+    {
+#if defined(__AVX512VL__)
+      return static_cast<__mmask8>(m);
+#elif defined(__AVX__)
+      return _mm256_movemask_pd(m);
+#else
+      return active_bits<bool64_t, 4>(m);
+#endif
+    }
+
+    TSIMD_INLINE unsigned long long active_bits(const vboolf8 &m)
+    {
+#if defined(__AVX512VL__)
+      return static_cast<__mmask8>(m);
+#elif defined(__AVX__)
+      return _mm256_movemask_ps(m);
+#else
+      return active_bits<bool32_t, 8>(m);
+#endif
+    }
+
+    TSIMD_INLINE unsigned long long active_bits(const vboold8 &m)
+    {
+#if defined(__AVX512F__)
+      return static_cast<__mmask8>(m);
+#else
+      return active_bits<bool64_t, 8>(m);
+#endif
+    }
+
+    TSIMD_INLINE unsigned long long active_bits(const vboolf16 &m)
+    {
+#if defined(__AVX512F__)
+      return static_cast<__mmask16>(m);
+#else
+      return active_bits<bool32_t, 16>(m);
+#endif
+    }
+
+    template <typename B, int W>
+    TSIMD_INLINE int count_active(const pack<B, W> &m)
+    {
+      return static_cast<int>(std::bitset<W>(active_bits(m)).count());
+    }
+
+    // Lane index tables //////////////////////////////////////////////////////
+
+    // NOTE: indexed by the active bits of a mask of up to 8 lanes, with one
+    //       nibble per lane: 'compress' holds the source lane of each lane of
+    //       the compressed result, 'expand' the compressed lane each lane
+    //       reads from (the number of active lanes before it)
+
+    template <typename = void>
+    struct compress_luts
+    {
+      static const uint32_t compress[256];
+      static const uint32_t expand[256];
+    };
+
+    template <typename VOID_T>
+    const uint32_t compress_luts<VOID_T>::compress[256] = {
+        0x00000000, 0x00000000, 0x00000001, 0x00000010, 0x00000002, 0x00000020,
+        0x00000021, 0x00000210, 0x00000003, 0x00000030, 0x00000031, 0x00000310,
+        0x00000032, 0x00000320, 0x00000321, 0x00003210, 0x00000004, 0x00000040,
+        0x00000041, 0x00000410, 0x00000042, 0x00000420, 0x00000421, 0x00004210,
+        0x00000043, 0x00000430, 0x00000431, 0x00004310, 0x00000432, 0x00004320,
+        0x00004321, 0x00043210, 0x00000005, 0x00000050, 0x00000051, 0x00000510,
+        0x00000052, 0x00000520, 0x00000521, 0x00005210, 0x00000053, 0x00000530,
+        0x00000531, 0x00005310, 0x00000532, 0x00005320, 0x00005321, 0x00053210,
+        0x00000054, 0x00000540, 0x00000541, 0x00005410, 0x00000542, 0x00005420,
+        0x00005421, 0x00054210, 0x00000543, 0x00005430, 0x00005431, 0x00054310,
+        0x00005432, 0x00054320, 0x00054321, 0x00543210, 0x00000006, 0x00000060,
+        0x00000061, 0x00000610, 0x00000062, 0x00000620, 0x00000621, 0x00006210,
+        0x00000063, 0x00000630, 0x00000631, 0x00006310, 0x00000632, 0x00006320,
+        0x00006321, 0x00063210, 0x00000064, 0x00000640, 0x00000641, 0x00006410,
+        0x00000642, 0x00006420, 0x00006421, 0x00064210, 0x00000643, 0x00006430,
+        0x00006431, 0x00064310, 0x00006432, 0x00064320, 0x00064321, 0x00643210,
+        0x00000065, 0x00000650, 0x00000651, 0x00006510, 0x00000652, 0x00006520,
+        0x00006521, 0x00065210, 0x00000653, 0x00006530, 0x00006531, 0x00065310,
+        0x00006532, 0x00065320, 0x00065321, 0x00653210, 0x00000654, 0x00006540,
+        0x00006541, 0x00065410, 0x00006542, 0x00065420, 0x00065421, 0x00654210,
+        0x00006543, 0x00065430, 0x00065431, 0x00654310, 0x00065432, 0x00654320,
+        0x00654321, 0x06543210, 0x00000007, 0x00000070, 0x00000071, 0x00000710,
+        0x00000072, 0x00000720, 0x00000721, 0x00007210, 0x00000073, 0x00000730,
+        0x00000731, 0x00007310, 0x00000732, 0x00007320, 0x00007321, 0x00073210,
+        0x00000074, 0x00000740, 0x00000741, 0x00007410, 0x00000742, 0x00007420,
+        0x00007421, 0x00074210, 0x00000743, 0x00007430, 0x00007431, 0x00074310,
+        0x00007432, 0x00074320, 0x00074321, 0x00743210, 0x00000075, 0x00000750,
+        0x00000751, 0x00007510, 0x00000752, 0x00007520, 0x00007521, 0x00075210,
+        0x00000753, 0x00007530, 0x00007531, 0x00075310, 0x00007532, 0x00075320,
+        0x00075321, 0x00753210, 0x00000754, 0x00007540, 0x00007541, 0x00075410,
+        0x00007542, 0x00075420, 0x00075421, 0x00754210, 0x00007543, 0x00075430,
+        0x00075431, 0x00754310, 0x00075432, 0x00754320, 0x00754321, 0x07543210,
+        0x00000076, 0x00000760, 0x00000761, 0x00007610, 0x00000762, 0x00007620,
+        0x00007621, 0x00076210, 0x00000763, 0x00007630, 0x00007631, 0x00076310,
+        0x00007632, 0x00076320, 0x00076321, 0x00763210, 0x00000764, 0x00007640,
+        0x00007641, 0x00076410, 0x00007642, 0x00076420, 0x00076421, 0x00764210,
+        0x00007643, 0x00076430, 0x00076431, 0x00764310, 0x00076432, 0x00764320,
+        0x00764321, 0x07643210, 0x00000765, 0x00007650, 0x00007651, 0x00076510,
+        0x00007652, 0x00076520, 0x00076521, 0x00765210, 0x00007653, 0x00076530,
+        0x00076531, 0x00765310, 0x00076532, 0x00765320, 0x00765321, 0x07653210,
+        0x00007654, 0x00076540, 0x00076541, 0x00765410, 0x00076542, 0x00765420,
+        0x00765421, 0x07654210, 0x00076543, 0x00765430, 0x00765431, 0x07654310,
+        0x00765432, 0x07654320, 0x07654321, 0x76543210};
+
+    template <typename VOID_T>
+    const uint32_t compress_luts<VOID_T>::expand[256] = {
+        0x00000000, 0x11111110, 0x11111100, 0x22222210, 0x11111000, 0x22222110,
+        0x22222100, 0x33333210, 0x11110000, 0x22221110, 0x22221100, 0x33332210,
+        0x22221000, 0x33332110, 0x33332100, 0x44443210, 0x11100000, 0x22211110,
+        0x22211100, 0x33322210, 0x22211000, 0x33322110, 0x33322100, 0x44433210,
+        0x22210000, 0x33321110, 0x33321100, 0x44432210, 0x33321000, 0x44432110,
+        0x44432100, 0x55543210, 0x11000000, 0x22111110, 0x22111100, 0x33222210,
+        0x22111000, 0x33222110, 0x33222100, 0x44333210, 0x22110000, 0x33221110,
+        0x33221100, 0x44332210, 0x33221000, 0x44332110, 0x44332100, 0x55443210,
+        0x22100000, 0x33211110, 0x33211100, 0x44322210, 0x33211000, 0x44322110,
+        0x44322100, 0x55433210, 0x33210000, 0x44321110, 0x44321100, 0x55432210,
+        0x44321000, 0x55432110, 0x55432100, 0x66543210, 0x10000000, 0x21111110,
+        0x21111100, 0x32222210, 0x21111000, 0x32222110, 0x32222100, 0x43333210,
+        0x21110000, 0x32221110, 0x32221100, 0x43332210, 0x32221000, 0x43332110,
+        0x43332100, 0x54443210, 0x21100000, 0x32211110, 0x32211100, 0x43322210,
+        0x32211000, 0x43322110, 0x43322100, 0x54433210, 0x32210000, 0x43321110,
+        0x43321100, 0x54432210, 0x43321000, 0x54432110, 0x54432100, 0x65543210,
+        0x21000000, 0x32111110, 0x32111100, 0x43222210, 0x32111000, 0x43222110,
+        0x43222100, 0x54333210, 0x32110000, 0x43221110, 0x43221100, 0x54332210,
+        0x43221000, 0x54332110, 0x54332100, 0x65443210, 0x32100000, 0x43211110,
+        0x43211100, 0x54322210, 0x43211000, 0x54322110, 0x54322100, 0x65433210,
+        0x43210000, 0x54321110, 0x54321100, 0x65432210, 0x54321000, 0x65432110,
+        0x65432100, 0x76543210, 0x00000000, 0x11111110, 0x11111100, 0x22222210,
+        0x11111000, 0x22222110, 0x22222100, 0x33333210, 0x11110000, 0x22221110,
+        0x22221100, 0x33332210, 0x22221000, 0x33332110, 0x33332100, 0x44443210,
+        0x11100000, 0x22211110, 0x22211100, 0x33322210, 0x22211000, 0x33322110,
+        0x33322100, 0x44433210, 0x22210000, 0x33321110, 0x33321100, 0x44432210,
+        0x33321000, 0x44432110, 0x44432100, 0x55543210, 0x11000000, 0x22111110,
+        0x22111100, 0x33222210, 0x22111000, 0x33222110, 0x33222100, 0x44333210,
+        0x22110000, 0x33221110, 0x33221100, 0x44332210, 0x33221000, 0x44332110,
+        0x44332100, 0x55443210, 0x22100000, 0x33211110, 0x33211100, 0x44322210,
+        0x33211000, 0x44322110, 0x44322100, 0x55433210, 0x33210000, 0x44321110,
+        0x44321100, 0x55432210, 0x44321000, 0x55432110, 0x55432100, 0x66543210,
+        0x10000000, 0x21111110, 0x21111100, 0x32222210, 0x21111000, 0x32222110,
+        0x32222100, 0x43333210, 0x21110000, 0x32221110, 0x32221100, 0x43332210,
+        0x32221000, 0x43332110, 0x43332100, 0x54443210, 0x21100000, 0x32211110,
+        0x32211100, 0x43322210, 0x32211000, 0x43322110, 0x43322100, 0x54433210,
+        0x32210000, 0x43321110, 0x43321100, 0x54432210, 0x43321000, 0x54432110,
+        0x54432100, 0x65543210, 0x21000000, 0x32111110, 0x32111100, 0x43222210,
+        0x32111000, 0x43222110, 0x43222100, 0x54333210, 0x32110000, 0x43221110,
+        0x43221100, 0x54332210, 0x43221000, 0x54332110, 0x54332100, 0x65443210,
+        0x32100000, 0x43211110, 0x43211100, 0x54322210, 0x43211000, 0x54322110,
+        0x54322100, 0x65433210, 0x43210000, 0x54321110, 0x54321100, 0x65432210,
+        0x54321000, 0x65432110, 0x65432100, 0x76543210};
+
+    // NOTE: lane 'i' of the result is nibble 'i' of 'nibbles'
+
+    template <typename T, int W>
+    TSIMD_INLINE pack<T, W> nibble_lanes(uint32_t nibbles)
+    {
+      pack<T, W> lanes;
+
+      for (int i = 0; i < W; ++i)
+        lanes[i] = T((nibbles >> (4 * i)) & 0xF);
+
+      return lanes;
+    }
+
+    template <>
+    TSIMD_INLINE vint4 nibble_lanes<int, 4>(uint32_t nibbles)
+    {
+#if defined(__AVX2__)
+      return _mm_and_si128(
+          _mm_srlv_epi32(_mm_set1_epi32(nibbles), _mm_setr_epi32(0, 4, 8, 12)),
+          _mm_set1_epi32(0xF));
+#elif defined(__SSE4_1__)
+      // NOTE: move nibble 'i' to the top of lane 'i', then shift it down
+      return _mm_srli_epi32(
+          _mm_mullo_epi32(_mm_set1_epi32(nibbles),
+                          _mm_setr_epi32(1 << 28, 1 << 24, 1 << 20, 1 << 16)),
+          28);
+#else
+      vint4 lanes;
+
+      for (int i = 0; i < 4; ++i)
+        lanes[i] = (nibbles >> (4 * i)) & 0xF;
+
+      return lanes;
+#endif
+    }
+
+    template <>
+    TSIMD_INLINE vint8 nibble_lanes<int, 8>(uint32_t nibbles)
+    {
+#if defined(__AVX2__)
+      return _mm256_and_si256(
+          _mm256_srlv_epi32(_mm256_set1_epi32(nibbles),
+                            _mm256_setr_epi32(0, 4, 8, 12, 16, 20, 24, 28)),
+          _mm256_set1_epi32(0xF));
+#else
+      vint8 lanes;
+
+      for (int i = 0; i < 8; ++i)
+        lanes[i] = (nibbles >> (4 * i)) & 0xF;
+
+      return lanes;
+#endif
+    }
+
+    template <>
+    TSIMD_INLINE vllong4 nibble_lanes<long long, 4>(uint32_t nibbles)
+    {
+#if defined(__AVX2__)
+      return _mm256_and_si256(
+          _mm256_srlv_epi64(_mm256_set1_epi64x(nibbles),
+                            _mm256_setr_epi64x(0, 4, 8, 12)),
+          _mm256_set1_epi64x(0xF));
+#else
+      vllong4 lanes;
+
+      for (int i = 0; i < 4; ++i)
+        lanes[i] = (nibbles >> (4 * i)) & 0xF;
+
+      return lanes;
+#endif
+    }
+
+    // Compress strategies ////////////////////////////////////////////////////
+
+    // NOTE: as with permutes, everything below works on the signed integer
+    //       view of the data
+
+    enum class compress_path
+    {
+      lanes,  // scalar loop over the lanes
+      lut,    // permute with the lane indices looked up for the mask
+      halves  // compress the two halves, then join them
+    };
+
+    template <compress_path PATH>
+    using compress_path_t = std::integral_constant<compress_path, PATH>;
+
+    template <typename T, int W>
+    struct compress_path_for
+    {
+      static constexpr compress_path value =
+          (W == 1 || sizeof(T) < 4)
+              ? compress_path::lanes
+              : W <= 8 ? compress_path::lut : compress_path::halves;
+    };
+
+    // NOTE: the per-width overloads fall back to these, which in turn use the
+    //       per-width overloads on the halves (defined further below)
+
+    template <typename T, int W>
+    TSIMD_INLINE pack<T, W> compress_lanes(
+        const mask<T, W> &m,
+        const pack<T, W> &p,
+        compress_path_t<compress_path::lanes>);
+
+    template <typename T, int W>
+    TSIMD_INLINE pack<T, W> compress_lanes(
+        const mask<T, W> &m,
+        const pack<T, W> &p,
+        compress_path_t<compress_path::lut>);
+
+    template <typename T, int W>
+    TSIMD_INLINE pack<T, W> compress_lanes(
+        const mask<T, W> &m,
+        const pack<T, W> &p,
+        compress_path_t<compress_path::halves>);
+
+    template <typename T, int W>
+    TSIMD_INLINE int compress_store_lanes(
+        const mask<T, W> &m,
+        const pack<T, W> &p,
+        T *dst,
+        compress_path_t<compress_path::lanes>);
+
+    template <typename T, int W>
+    TSIMD_INLINE int compress_store_lanes(
+        const mask<T, W> &m,
+        const pack<T, W> &p,
+        T *dst,
+        compress_path_t<compress_path::lut>);
+
+    template <typename T, int W>
+    TSIMD_INLINE int compress_store_lanes(
+        const mask<T, W> &m,
+        const pack<T, W> &p,
+        T *dst,
+        compress_path_t<compress_path::halves>);
+
+    template <typename B, int W, typename T>
+    TSIMD_INLINE pack<T, W> expand_load_lanes(
+        const pack<B, W> &m,
+        const T *src,
+        compress_path_t<compress_path::lanes>);
+
+    template <typename B, int W, typename T>
+    TSIMD_INLINE pack<T, W> expand_load_lanes(
+        const pack<B, W> &m,
+        const T *src,
+        compress_path_t<compress_path::halves>);
+
+    // 4-wide //
+
+    TSIMD_INLINE vint4 compress_lanes(const vboolf4 &m, const vint4 &p)
+    {
+#if defined(__AVX512VL__)
+      return _mm_maskz_compress_epi32(m, p.v);
+#else
+      return compress_lanes(m, p, compress_path_t<compress_path::lut>());
+#endif
+    }
+
+    TSIMD_INLINE int compress_store_lanes(const vboolf4 &m,
+                                          const vint4 &p,
+                                          int *dst)
+    {
+#if defined(__AVX512VL__)
+      _mm_mask_compressstoreu_epi32(dst, m, p.v);
+      return count_active(m);
+#elif defined(__AVX__)
+      const int n = count_active(m);
+      const vboolf4 first_n = lane_ids<int, 4>() < n;
+      _mm_maskstore_ps((float *)dst,
+                       _mm_castps_si128(first_n),
+                       _mm_castsi128_ps(compress_lanes(m, p)));
+      return n;
+#else
+      return compress_store_lanes(
+          m, p, dst, compress_path_t<compress_path::lut>());
+#endif
+    }
+
+    TSIMD_INLINE vint4 expand_load_lanes(const vboolf4 &m, const int *src)
+    {
+#if defined(__AVX512VL__)
+      return _mm_maskz_expandloadu_epi32(m, src);
+#elif defined(__AVX__)
+      const int bits         = static_cast<int>(active_bits(m));
+      const vboolf4 first_n  = lane_ids<int, 4>() < count_active(m);
+      const vint4 compressed = _mm_castps_si128(
+          _mm_maskload_ps((const float *)src, _mm_castps_si128(first_n)));
+      const vint4 idx = nibble_lanes<int, 4>(compress_luts<>::expand[bits]);
+      return select(m, permute1(compressed, idx), vint4(0));
+#else
+      return expand_load_lanes(m, src, compress_path_t<compress_path::lanes>());
+#endif
+    }
+
+    TSIMD_INLINE vllong4 compress_lanes(const vboold4 &m, const vllong4 &p)
+    {
+#if defined(__AVX512VL__)
+      return _mm256_maskz_compress_epi64(m, p.v);
+#else
+      return compress_lanes(m, p, compress_path_t<compress_path::lut>());
+#endif
+    }
+
+    TSIMD_INLINE int compress_store_lanes(const vboold4 &m,
+                                          const vllong4 &p,
+                                          long long *dst)
+    {
+#if defined(__AVX512VL__)
+      _mm256_mask_compressstoreu_epi64(dst, m, p.v);
+      return count_active(m);
+#elif defined(__AVX__)
+      const int n = count_active(m);
+      const vboold4 first_n = lane_ids<long long, 4>() < n;
+      _mm256_maskstore_pd((double *)dst,
+                          _mm256_castpd_si256(first_n),
+                          _mm256_castsi256_pd(compress_lanes(m, p)));
+      return n;
+#else
+      return compress_store_lanes(
+          m, p, dst, compress_path_t<compress_path::lut>());
+#endif
+    }
+
+    TSIMD_INLINE vllong4 expand_load_lanes(const vboold4 &m,
+                                           const long long *src)
+    {
+#if defined(__AVX512VL__)
+      return _mm256_maskz_expandloadu_epi64(m, src);
+#elif defined(__AVX__)
+      const int bits          = static_cast<int>(active_bits(m));
+      const vboold4 first_n   = lane_ids<long long, 4>() < count_active(m);
+      const vllong4 compressed = _mm256_castpd_si256(_mm256_maskload_pd(
+          (const double *)src, _mm256_castpd_si256(first_n)));
+      const vllong4 idx =
+          nibble_lanes<long long, 4>(compress_luts<>::expand[bits]);
+      return select(m, permute1(compressed, idx), vllong4(0));
+#else
+      return expand_load_lanes(m, src, compress_path_t<compress_path::lanes>());
+#endif
+    }
+
+    // 8-wide //
+
+    TSIMD_INLINE vint8 compress_lanes(const vboolf8 &m, const vint8 &p)
+    {
+#if defined(__AVX512VL__)
+      return _mm256_maskz_compress_epi32(m, p.v);
+#else
+      return compress_lanes(m, p, compress_path_t<compress_path::lut>());
+#endif
+    }
+
+    TSIMD_INLINE int compress_store_lanes(const vboolf8 &m,
+                                          const vint8 &p,
+                                          int *dst)
+    {
+#if defined(__AVX512VL__)
+      _mm256_mask_compressstoreu_epi32(dst, m, p.v);
+      return count_active(m);
+#elif defined(__AVX__)
+      const int n = count_active(m);
+      const vboolf8 first_n = lane_ids<int, 8>() < n;
+      _mm256_maskstore_ps((float *)dst,
+                          _mm256_castps_si256(first_n),
+                          _mm256_castsi256_ps(compress_lanes(m, p)));
+      return n;
+#else
+      return compress_store_lanes(
+          m, p, dst, compress_path_t<compress_path::lut>());
+#endif
+    }
+
+    TSIMD_INLINE vint8 expand_load_lanes(const vboolf8 &m, const int *src)
+    {
+#if defined(__AVX512VL__)
+      return _mm256_maskz_expandloadu_epi32(m, src);
+#elif defined(__AVX__)
+      const int bits         = static_cast<int>(active_bits(m));
+      const vboolf8 first_n  = lane_ids<int, 8>() < count_active(m);
+      const vint8 compressed = _mm256_castps_si256(
+          _mm256_maskload_ps((const float *)src, _mm256_castps_si256(first_n)));
+      const vint8 idx = nibble_lanes<int, 8>(compress_luts<>::expand[bits]);
+      return select(m, permute1(compressed, idx), vint8(0));
+#else
+      return expand_load_lanes(m, src, compress_path_t<compress_path::lanes>());
+#endif
+    }
+
+    TSIMD_INLINE vllong8 compress_lanes(const vboold8 &m, const vllong8 &p)
+    {
+#if defined(__AVX512F__)
+      return _mm512_maskz_compress_epi64(m, p.v);
+#else
+      return compress_lanes(m, p, compress_path_t<compress_path::lut>());
+#endif
+    }
+
+    TSIMD_INLINE int compress_store_lanes(const vboold8 &m,
+                                          const vllong8 &p,
+                                          long long *dst)
+    {
+#if defined(__AVX512F__)
+      _mm512_mask_compressstoreu_epi64(dst, m, p.v);
+      return count_active(m);
+#else
+      return compress_store_lanes(
+          m, p, dst, compress_path_t<compress_path::lut>());
+#endif
+    }
+
+    TSIMD_INLINE vllong8 expand_load_lanes(const vboold8 &m,
+                                           const long long *src)
+    {
+#if defined(__AVX512F__)
+      return _mm512_maskz_expandloadu_epi64(m, src);
+#else
+      return expand_load_lanes(m, src, compress_path_t<compress_path::lanes>());
+#endif
+    }
+
+    // 16-wide //
+
+    TSIMD_INLINE vint16 compress_lanes(const vboolf16 &m, const vint16 &p)
+    {
+#if defined(__AVX512F__)
+      return _mm512_maskz_compress_epi32(m, p.v);
+#else
+      return compress_lanes(m, p, compress_path_t<compress_path::halves>());
+#endif
+    }
+
+    TSIMD_INLINE int compress_store_lanes(const vboolf16 &m,
+                                          const vint16 &p,
+                                          int *dst)
+    {
+#if defined(__AVX512F__)
+      _mm512_mask_compressstoreu_epi32(dst, m, p.v);
+      return count_active(m);
+#else
+      return compress_store_lanes(
+          m, p, dst, compress_path_t<compress_path::halves>());
+#endif
+    }
+
+    TSIMD_INLINE vint16 expand_load_lanes(const vboolf16 &m, const int *src)
+    {
+#if defined(__AVX512F__)
+      return _mm512_maskz_expandloadu_epi32(m, src);
+#else
+      return expand_load_lanes(
+          m, src, compress_path_t<compress_path::halves>());
+#endif
+    }
+
+    // generic //
+
+    template <typename T, int W>
+    TSIMD_INLINE pack<T, W> compress_lanes(const mask<T, W> &m,
+                                           const pack<T, W> &p)
+    {
+      return compress_lanes(
+          m, p, compress_path_t<compress_path_for<T, W>::value>());
+    }
+
+    template <typename T, int W>
+    TSIMD_INLINE int compress_store_lanes(const mask<T, W> &m,
+                                          const pack<T, W> &p,
+                                          T *dst)
+    {
+      return compress_store_lanes(
+          m, p, dst, compress_path_t<compress_path_for<T, W>::value>());
+    }
+
+    // NOTE: only the wide packs split into halves, the native widths have
+    //       their own overloads above
+    template <typename B, int W, typename T>
+    TSIMD_INLINE pack<T, W> expand_load_lanes(const pack<B, W> &m,
+                                              const T *src)
+    {
+      using path_t = compress_path_t<compress_path_for<T, W>::value ==
+                                             compress_path::halves
+                                         ? compress_path::halves
+                                         : compress_path::lanes>;
+      return expand_load_lanes(m, src, path_t());
+    }
+
+    // lanes //
+
+    template <typename T, int W>
+    TSIMD_INLINE pack<T, W> compress_lanes(
+        const mask<T, W> &m,
+        const pack<T, W> &p,
+        compress_path_t<compress_path::lanes>)
+    {
+      pack<T, W> result(T(0));
+      int n = 0;
+
+      for (int i = 0; i < W; ++i)
+        if (m[i])
+          result[n++] = p[i];
+
+      return result;
+    }
+
+    // NOTE: the lanes are copied as bytes, 'dst' may hold the float or
+    //       unsigned elements the signed view was made from
+
+    template <typename T, int W>
+    TSIMD_INLINE int compress_store_lanes(
+        const mask<T, W> &m,
+        const pack<T, W> &p,
+        T *dst,
+        compress_path_t<compress_path::lanes>)
+    {
+      int n = 0;
+
+      for (int i = 0; i < W; ++i) {
+        if (m[i]) {
+          const T lane = p[i];
+          std::memcpy(dst + n++, &lane, sizeof(T));
+        }
+      }
+
+      return n;
+    }
+
+    template <typename B, int W, typename T>
+    TSIMD_INLINE pack<T, W> expand_load_lanes(
+        const pack<B, W> &m,
+        const T *src,
+        compress_path_t<compress_path::lanes>)
+    {
+      pack<T, W> result(T(0));
+      int n = 0;
+
+      for (int i = 0; i < W; ++i) {
+        if (m[i]) {
+          T lane;
+          std::memcpy(&lane, src + n++, sizeof(T));
+          result[i] = lane;
+        }
+      }
+
+      return result;
+    }
+
+    // lut //
+
+    template <typename T, int W>
+    TSIMD_INLINE pack<T, W> compress_lanes(
+        const mask<T, W> &m,
+        const pack<T, W> &p,
+        compress_path_t<compress_path::lut>)
+    {
+      const int bits = static_cast<int>(active_bits(m));
+      const pack<T, W> idx =
+          nibble_lanes<T, W>(compress_luts<>::compress[bits]);
+      return select(lane_ids<T, W>() < T(count_active(m)),
+                    permute1(p, idx),
+                    pack<T, W>(T(0)));
+    }
+
+    template <typename T, int W>
+    TSIMD_INLINE int compress_store_lanes(
+        const mask<T, W> &m,
+        const pack<T, W> &p,
+        T *dst,
+        compress_path_t<compress_path::lut>)
+    {
+      const pack<T, W> compressed = compress_lanes(m, p);
+      const int n = count_active(m);
+
+      std::memcpy(dst, &compressed, n * sizeof(T));
+
+      return n;
+    }
+
+    // halves //
+
+    template <typename T, int W>
+    TSIMD_INLINE pack<T, W> compress_lanes(
+        const mask<T, W> &m,
+        const pack<T, W> &p,
+        compress_path_t<compress_path::halves>)
+    {
+      using half_t      = pack<T, W / 2>;
+      using half_mask_t = mask<T, W / 2>;
+
+      const half_mask_t ml(m.vl);
+      const half_mask_t mh(m.vh);
+
+      const int nl = count_active(ml);
+      const int n  = nl + count_active(mh);
+
+      // NOTE: the active lanes of the high half start right after the ones
+      //       of the low half
+      const pack<T, W> joined(compress_lanes(ml, half_t(p.vl)),
+                              compress_lanes(mh, half_t(p.vh)));
+
+      const pack<T, W> ids = lane_ids<T, W>();
+      const pack<T, W> idx =
+          select(ids < T(nl), ids, ids + T(W / 2 - nl));
+
+      return select(ids < T(n), permute1(joined, idx), pack<T, W>(T(0)));
+    }
+
+    template <typename T, int W>
+    TSIMD_INLINE int compress_store_lanes(
+        const mask<T, W> &m,
+        const pack<T, W> &p,
+        T *dst,
+        compress_path_t<compress_path::halves>)
+    {
+      using half_t      = pack<T, W / 2>;
+      using half_mask_t = mask<T, W / 2>;
+
+      const int n = compress_store_lanes(half_mask_t(m.vl), half_t(p.vl), dst);
+      return n +
+             compress_store_lanes(half_mask_t(m.vh), half_t(p.vh), dst + n);
+    }
+
+    template <typename B, int W, typename T>
+    TSIMD_INLINE pack<T, W> expand_load_lanes(
+        const pack<B, W> &m,
+        const T *src,
+        compress_path_t<compress_path::halves>)
+    {
+      using half_mask_t = pack<B, W / 2>;
+
+      const half_mask_t ml(m.vl);
+      const half_mask_t mh(m.vh);
+
+      return pack<T, W>(expand_load_lanes(ml, src),
+                        expand_load_lanes(mh, src + count_active(ml)));
+    }
+
+  }  // namespace detail
+
+  // compress() ///////////////////////////////////////////////////////////////
+
+  // NOTE: the active lanes of 'p' move (in order) to the first lanes of the
+  //       result, the remaining lanes are 0
+
+  template <typename T, int W>
+  TSIMD_INLINE pack<T, W> compress(const mask<T, W> &m, const pack<T, W> &p)
+  {
+    static_assert(!traits::is_bool<T>::value,
+                  "tsimd::compress() can only be used with non-bool packs");
+    return reinterpret_elements_as<T>(
+        detail::compress_lanes(m, detail::as_lane_indices(p)));
+  }
+
+  // compress_store() /////////////////////////////////////////////////////////
+
+  // NOTE: writes the active lanes of 'p' (in order) to consecutive elements
+  //       of 'dst', which needs no alignment, and returns how many were
+  //       written (nothing past them is touched)
+
+  template <typename T, int W>
+  TSIMD_INLINE int compress_store(const mask<T, W> &m,
+                                  const pack<T, W> &p,
+                                  T *dst)
+  {
+    static_assert(!traits::is_bool<T>::value,
+                  "tsimd::compress_store() can only be used with non-bool"
+                  " packs");
+    using index_t = typename detail::lane_index_type<T>::type;
+    return detail::compress_store_lanes(
+        m, detail::as_lane_indices(p), reinterpret_cast<index_t *>(dst));
+  }
+
+  // expand_load() ////////////////////////////////////////////////////////////
+
+  // NOTE: the inverse of compress_store(), the active lanes of the result
+  //       (in order) read consecutive elements of 'src', which needs no
+  //       alignment, and inactive lanes are 0 (only as many elements as
+  //       there are active lanes are read)
+
+  template <typename BOOL_T, int W, typename T>
+  TSIMD_INLINE pack<T, W> expand_load(const pack<BOOL_T, W> &m, const T *src)
+  {
+    static_assert(!traits::is_bool<T>::value,
+                  "tsimd::expand_load() can only be used with non-bool packs");
+    static_assert(std::is_same<BOOL_T, bool_t<T>>::value,
+                  "tsimd::expand_load() mask must match the element type");
+    using index_t = typename detail::lane_index_type<T>::type;
+    return reinterpret_elements_as<T>(detail::expand_load_lanes(
+        m, reinterpret_cast<const index_t *>(src)));
+  }
+
+TSIMD_NAMESPACE_END  // namespace tsimd
@@ -28,15 +28,50 @@
 
 #include "select.h"
 
-namespace tsimd {
+TSIMD_NAMESPACE_BEGIN
 
-  template <typename T, int W, typename FCN_T>
+  namespace detail {
+
+    template <typename T, int W>
+    using has_lane_refs =
+        std::is_reference<typename pack<T, W>::reference_t>;
+
+    template <typename T, int W>
+    using has_lane_refs_t = traits::enable_if_t<has_lane_refs<T, W>::value>;
+
+    template <typename T, int W>
+    using has_no_lane_refs_t =
+        traits::enable_if_t<!has_lane_refs<T, W>::value>;
+
+  }  // namespace detail
+
+  template <typename T,
+            int W,
+            typename FCN_T,
+            typename = detail::has_lane_refs_t<T, W>>
   TSIMD_INLINE void foreach(pack<T, W> &p, FCN_T && fcn)
   {
     for (int i = 0; i < W; ++i)
       fcn(p[i], i);
   }
 
+  // NOTE: lanes of a bit mask (or of a wide mask made of them) aren't
+  //       addressable, so hand 'fcn' a copy of the lane and write it back
+  //       afterwards
+  template <typename T,
+            int W,
+            typename FCN_T,
+            typename = detail::has_no_lane_refs_t<T, W>,
+            typename = void>
+  TSIMD_INLINE void foreach(pack<T, W> &p, FCN_T && fcn)
+  {
+    for (int i = 0; i < W; ++i) {
+      T lane = p[i];
+      fcn(lane, i);
+      p[i] = lane;
+    }
+  }
+
   template <typename BOOL_T,
             int W,
             typename FCN_T,
@@ -58,4 +93,4 @@ namespace tsimd {
         fcn(p[i]);
   }
 
-}  // namespace tsimd
+TSIMD_NAMESPACE_END  // namespace tsimd
@@ -30,7 +30,7 @@
 
 #include "../math/abs.h"
 
-namespace tsimd {
+TSIMD_NAMESPACE_BEGIN
 
   #define EPSILON_DEFAULT TSIMD_DEFAULT_NEAR_EQUAL_EPSILON
 
@@ -66,4 +66,4 @@ namespace tsimd {
 
   #undef EPSILON_DEFAULT
 
-}  // namespace tsimd
\ No newline at end of file
+TSIMD_NAMESPACE_END  // namespace tsimd
\ No newline at end of file
@@ -0,0 +1,382 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Intel Corporation                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+
+#include "../../pack.h"
+
+#include "../../operators/arithmetic/plus.h"
+#include "../../operators/arithmetic/times.h"
+#include "../math/max.h"
+#include "../math/min.h"
+#include "select.h"
+
+TSIMD_NAMESPACE_BEGIN
+
+  namespace detail {
+
+    // Reduction operations ///////////////////////////////////////////////////
+
+    // NOTE: each op combines two packs lane-wise (the steps of the tree) or
+    //       two scalars (the lane-by-lane fallback), and provides the value
+    //       masked off lanes are replaced with
+
+    struct reduce_add_op
+    {
+      template <typename T>
+      TSIMD_INLINE T operator()(const T &a, const T &b) const
+      {
+        return a + b;
+      }
+
+      template <typename T>
+      static TSIMD_INLINE T identity()
+      {
+        return T(0);
+      }
+    };
+
+    struct reduce_mul_op
+    {
+      template <typename T>
+      TSIMD_INLINE T operator()(const T &a, const T &b) const
+      {
+        return a * b;
+      }
+
+      template <typename T>
+      static TSIMD_INLINE T identity()
+      {
+        return T(1);
+      }
+    };
+
+    struct reduce_min_op
+    {
+      template <typename T, int W>
+      TSIMD_INLINE pack<T, W> operator()(const pack<T, W> &a,
+                                         const pack<T, W> &b) const
+      {
+        return min(a, b);
+      }
+
+      template <typename T>
+      TSIMD_INLINE T operator()(const T &a, const T &b) const
+      {
+        return std::min(a, b);
+      }
+
+      template <typename T>
+      static TSIMD_INLINE T identity()
+      {
+        return std::numeric_limits<T>::has_infinity
+                   ? std::numeric_limits<T>::infinity()
+                   : std::numeric_limits<T>::max();
+      }
+    };
+
+    struct reduce_max_op
+    {
+      template <typename T, int W>
+      TSIMD_INLINE pack<T, W> operator()(const pack<T, W> &a,
+                                         const pack<T, W> &b) const
+      {
+        return max(a, b);
+      }
+
+      template <typename T>
+      TSIMD_INLINE T operator()(const T &a, const T &b) const
+      {
+        return std::max(a, b);
+      }
+
+      template <typename T>
+      static TSIMD_INLINE T identity()
+      {
+        return std::numeric_limits<T>::has_infinity
+                   ? -std::numeric_limits<T>::infinity()
+                   : std::numeric_limits<T>::lowest();
+      }
+    };
+
+    // Reduction strategies ///////////////////////////////////////////////////
+
+    enum class reduce_path
+    {
+      lanes,   // scalar loop over the lanes
+      sse,     // shuffle tree inside one 128-bit register
+      avx,     // shuffle tree inside one 256-bit register of 8-byte lanes
+      halves   // fold the two halves together, then reduce the half
+    };
+
+    template <reduce_path PATH>
+    using reduce_path_t = std::integral_constant<reduce_path, PATH>;
+
+    template <typename T, int W>
+    struct reduce_path_for
+    {
+      static constexpr int bytes = W * int(sizeof(T));
+
+      static constexpr reduce_path value =
+          W == 1 ? reduce_path::lanes
+                 : traits::is_wide_pack<T, W>::value
+                       ? reduce_path::halves
+                       : bytes == 16 ? reduce_path::sse
+                                     : (bytes == 32 && sizeof(T) == 8)
+                                           ? reduce_path::avx
+                                           : bytes > 16 ? reduce_path::halves
+                                                        : reduce_path::lanes;
+    };
+
+#if defined(__AVX512F__)
+    // NOTE: 512-bit registers use the compiler's reduction sequences, which
+    //       already are the optimal extract/shuffle trees for each type
+
+#define TSIMD_REDUCE_AVX512(PACK_T, OP, INTRINSIC)                    \
+    TSIMD_INLINE typename PACK_T::value_t reduce(const PACK_T &p, OP) \
+    {                                                                 \
+      return INTRINSIC(p.v);                                          \
+    }
+
+    TSIMD_REDUCE_AVX512(vfloat16, reduce_add_op, _mm512_reduce_add_ps)
+    TSIMD_REDUCE_AVX512(vfloat16, reduce_mul_op, _mm512_reduce_mul_ps)
+    TSIMD_REDUCE_AVX512(vfloat16, reduce_min_op, _mm512_reduce_min_ps)
+    TSIMD_REDUCE_AVX512(vfloat16, reduce_max_op, _mm512_reduce_max_ps)
+
+    TSIMD_REDUCE_AVX512(vdouble8, reduce_add_op, _mm512_reduce_add_pd)
+    TSIMD_REDUCE_AVX512(vdouble8, reduce_mul_op, _mm512_reduce_mul_pd)
+    TSIMD_REDUCE_AVX512(vdouble8, reduce_min_op, _mm512_reduce_min_pd)
+    TSIMD_REDUCE_AVX512(vdouble8, reduce_max_op, _mm512_reduce_max_pd)
+
+    TSIMD_REDUCE_AVX512(vint16, reduce_add_op, _mm512_reduce_add_epi32)
+    TSIMD_REDUCE_AVX512(vint16, reduce_mul_op, _mm512_reduce_mul_epi32)
+    TSIMD_REDUCE_AVX512(vint16, reduce_min_op, _mm512_reduce_min_epi32)
+    TSIMD_REDUCE_AVX512(vint16, reduce_max_op, _mm512_reduce_max_epi32)
+
+    TSIMD_REDUCE_AVX512(vuint16, reduce_add_op, _mm512_reduce_add_epi32)
+    TSIMD_REDUCE_AVX512(vuint16, reduce_mul_op, _mm512_reduce_mul_epi32)
+    TSIMD_REDUCE_AVX512(vuint16, reduce_min_op, _mm512_reduce_min_epu32)
+    TSIMD_REDUCE_AVX512(vuint16, reduce_max_op, _mm512_reduce_max_epu32)
+
+    TSIMD_REDUCE_AVX512(vllong8, reduce_add_op, _mm512_reduce_add_epi64)
+    TSIMD_REDUCE_AVX512(vllong8, reduce_mul_op, _mm512_reduce_mul_epi64)
+    TSIMD_REDUCE_AVX512(vllong8, reduce_min_op, _mm512_reduce_min_epi64)
+    TSIMD_REDUCE_AVX512(vllong8, reduce_max_op, _mm512_reduce_max_epi64)
+
+    TSIMD_REDUCE_AVX512(vullong8, reduce_add_op, _mm512_reduce_add_epi64)
+    TSIMD_REDUCE_AVX512(vullong8, reduce_mul_op, _mm512_reduce_mul_epi64)
+    TSIMD_REDUCE_AVX512(vullong8, reduce_min_op, _mm512_reduce_min_epu64)
+    TSIMD_REDUCE_AVX512(vullong8, reduce_max_op, _mm512_reduce_max_epu64)
+
+#undef TSIMD_REDUCE_AVX512
+#endif
+
+    template <typename T, int W, typename OP>
+    TSIMD_INLINE T reduce(const pack<T, W> &p, OP op)
+    {
+      static_assert(!traits::is_bool<T>::value,
+                    "tsimd::reduce_*() can only be used with non-bool packs");
+      return reduce(p, op, reduce_path_t<reduce_path_for<T, W>::value>());
+    }
+
+    // lanes //
+
+    template <typename T, int W, typename OP>
+    TSIMD_INLINE T reduce(const pack<T, W> &p,
+                          OP op,
+                          reduce_path_t<reduce_path::lanes>)
+    {
+      T result = p[0];
+
+      for (int i = 1; i < W; ++i)
+        result = op(result, T(p[i]));
+
+      return result;
+    }
+
+    // sse //
+
+#if defined(__SSE__)
+    template <int BYTES>
+    using sse_fold_t = std::integral_constant<int, BYTES>;
+
+    template <typename T, int W, typename OP>
+    TSIMD_INLINE pack<T, W> sse_fold(const pack<T, W> &p, OP, sse_fold_t<0>)
+    {
+      return p;
+    }
+
+    // NOTE: each step folds the upper BYTES of the live lanes onto the lower
+    //       ones, halving the distance until lane 0 holds the result
+    template <typename T, int W, typename OP, int BYTES>
+    TSIMD_INLINE pack<T, W> sse_fold(const pack<T, W> &p,
+                                     OP op,
+                                     sse_fold_t<BYTES>)
+    {
+      const pack<T, W> upper(_mm_srli_si128(p.v, BYTES));
+      return sse_fold(op(p, upper),
+                      op,
+                      sse_fold_t<(BYTES > int(sizeof(T)) ? BYTES / 2 : 0)>());
+    }
+#endif
+
+    template <typename T, int W, typename OP>
+    TSIMD_INLINE T reduce(const pack<T, W> &p,
+                          OP op,
+                          reduce_path_t<reduce_path::sse>)
+    {
+#if defined(__SSE__)
+      return T(_mm_cvtsi128_si32(sse_fold(p, op, sse_fold_t<8>()).v));
+#else
+      return reduce(p, op, reduce_path_t<reduce_path::lanes>());
+#endif
+    }
+
+    template <typename OP>
+    TSIMD_INLINE float reduce(const vfloat4 &p,
+                              OP op,
+                              reduce_path_t<reduce_path::sse>)
+    {
+#if defined(__SSE__)
+      const vfloat4 x = op(p, vfloat4(_mm_movehl_ps(p.v, p.v)));
+      const vfloat4 y =
+          op(x, vfloat4(_mm_shuffle_ps(x.v, x.v, _MM_SHUFFLE(1, 1, 1, 1))));
+      return _mm_cvtss_f32(y.v);
+#else
+      return reduce(p, op, reduce_path_t<reduce_path::lanes>());
+#endif
+    }
+
+    // avx //
+
+    template <typename T, typename OP>
+    TSIMD_INLINE T reduce(const pack<T, 4> &p,
+                          OP op,
+                          reduce_path_t<reduce_path::avx>)
+    {
+#if defined(__AVX__)
+      const pack<T, 4> x =
+          op(p, pack<T, 4>(_mm256_permute2f128_si256(p.v, p.v, 0x01)));
+      const pack<T, 4> y = op(x,
+                              pack<T, 4>(_mm256_castpd_si256(_mm256_permute_pd(
+                                  _mm256_castsi256_pd(x.v), 0x5))));
+      return T(_mm_cvtsi128_si64(_mm256_castsi256_si128(y.v)));
+#else
+      return reduce(p, op, reduce_path_t<reduce_path::lanes>());
+#endif
+    }
+
+    template <typename OP>
+    TSIMD_INLINE double reduce(const vdouble4 &p,
+                               OP op,
+                               reduce_path_t<reduce_path::avx>)
+    {
+#if defined(__AVX__)
+      const vdouble4 x =
+          op(p, vdouble4(_mm256_permute2f128_pd(p.v, p.v, 0x01)));
+      const vdouble4 y = op(x, vdouble4(_mm256_permute_pd(x.v, 0x5)));
+      return _mm256_cvtsd_f64(y.v);
+#else
+      return reduce(p, op, reduce_path_t<reduce_path::lanes>());
+#endif
+    }
+
+    // halves //
+
+    template <typename T, int W, typename OP>
+    TSIMD_INLINE T reduce(const pack<T, W> &p,
+                          OP op,
+                          reduce_path_t<reduce_path::halves>)
+    {
+      using half_t = pack<T, W / 2>;
+      return reduce(op(half_t(p.vl), half_t(p.vh)), op);
+    }
+
+    // masked //
+
+    template <typename T, int W, typename OP>
+    TSIMD_INLINE T reduce(const mask<T, W> &m, const pack<T, W> &p, OP op)
+    {
+      return reduce(select(m, p, pack<T, W>(OP::template identity<T>())), op);
+    }
+
+  }  // namespace detail
+
+  // NOTE: masked reductions only combine the active lanes; with no active
+  //       lanes the result is the identity of the operation (0 for add, 1 for
+  //       mul, the largest value for min and the smallest value for max)
+
+  template <typename T, int W>
+  TSIMD_INLINE T reduce_add(const pack<T, W> &p)
+  {
+    return detail::reduce(p, detail::reduce_add_op());
+  }
+
+  template <typename T, int W>
+  TSIMD_INLINE T reduce_add(const mask<T, W> &m, const pack<T, W> &p)
+  {
+    return detail::reduce(m, p, detail::reduce_add_op());
+  }
+
+  template <typename T, int W>
+  TSIMD_INLINE T reduce_mul(const pack<T, W> &p)
+  {
+    return detail::reduce(p, detail::reduce_mul_op());
+  }
+
+  template <typename T, int W>
+  TSIMD_INLINE T reduce_mul(const mask<T, W> &m, const pack<T, W> &p)
+  {
+    return detail::reduce(m, p, detail::reduce_mul_op());
+  }
+
+  template <typename T, int W>
+  TSIMD_INLINE T reduce_min(const pack<T, W> &p)
+  {
+    return detail::reduce(p, detail::reduce_min_op());
+  }
+
+  template <typename T, int W>
+  TSIMD_INLINE T reduce_min(const mask<T, W> &m, const pack<T, W> &p)
+  {
+    return detail::reduce(m, p, detail::reduce_min_op());
+  }
+
+  template <typename T, int W>
+  TSIMD_INLINE T reduce_max(const pack<T, W> &p)
+  {
+    return detail::reduce(p, detail::reduce_max_op());
+  }
+
+  template <typename T, int W>
+  TSIMD_INLINE T reduce_max(const mask<T, W> &m, const pack<T, W> &p)
+  {
+    return detail::reduce(m, p, detail::reduce_max_op());
+  }
+
+TSIMD_NAMESPACE_END  // namespace tsimd
@@ -0,0 +1,256 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Intel Corporation                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+#pragma once
+
+#include <type_traits>
+
+#include "../../pack.h"
+
+#include "../../operators/arithmetic/plus.h"
+#include "../../operators/bitwise/or.h"
+#include "../../operators/logic/equals.h"
+#include "../shuffle/shift_lanes.h"
+#include "select.h"
+
+TSIMD_NAMESPACE_BEGIN
+
+  namespace detail {
+
+    // NOTE: log-step network, after the step with shift S every lane holds
+    //       the sum of the (up to) 2S lanes ending at it
+
+    template <int S, typename T, int W>
+    TSIMD_INLINE pack<T, W> scan_steps(const pack<T, W> &p, std::false_type)
+    {
+      return p;
+    }
+
+    template <int S, typename T, int W>
+    TSIMD_INLINE pack<T, W> scan_steps(const pack<T, W> &p, std::true_type)
+    {
+      const pack<T, W> next = p + shift_lanes_up<S>(p);
+      return scan_steps<2 * S>(next,
+                               std::integral_constant<bool, (2 * S < W)>());
+    }
+
+    template <typename T, int W>
+    TSIMD_INLINE pack<T, W> inclusive_scan(const pack<T, W> &p,
+                                           std::false_type /*is_wide*/)
+    {
+      return scan_steps<1>(p, std::integral_constant<bool, (1 < W)>());
+    }
+
+    // NOTE: wide packs scan their halves, then carry the low half's total
+    //       into the high half
+
+    template <typename T, int W>
+    TSIMD_INLINE pack<T, W> inclusive_scan(const pack<T, W> &p,
+                                           std::true_type /*is_wide*/)
+    {
+      using half_t = pack<T, W / 2>;
+      using is_wide_half = traits::is_wide_pack<T, W / 2>;
+
+      const half_t lo = inclusive_scan(
+          p.vl, std::integral_constant<bool, is_wide_half::value>());
+      const half_t hi = inclusive_scan(
+          p.vh, std::integral_constant<bool, is_wide_half::value>());
+
+      return pack<T, W>(lo, hi + lo[W / 2 - 1]);
+    }
+
+    // NOTE: 'flags' is -1 in the lanes starting a segment, once the steps are
+    //       done it is -1 in every lane with a segment start at or before it
+
+    template <int S, typename T, int W, typename FLAG_T>
+    TSIMD_INLINE pack<T, W> segmented_scan_steps(const pack<T, W> &p,
+                                                 pack<FLAG_T, W> &flags,
+                                                 std::false_type)
+    {
+      return p;
+    }
+
+    template <int S, typename T, int W, typename FLAG_T>
+    TSIMD_INLINE pack<T, W> segmented_scan_steps(const pack<T, W> &p,
+                                                 pack<FLAG_T, W> &flags,
+                                                 std::true_type)
+    {
+      const pack<T, W> next =
+          select(flags == FLAG_T(0), p + shift_lanes_up<S>(p), p);
+      flags = flags | shift_lanes_up<S>(flags);
+      return segmented_scan_steps<2 * S>(
+          next, flags, std::integral_constant<bool, (2 * S < W)>());
+    }
+
+    template <typename T, int W, typename FLAG_T>
+    TSIMD_INLINE pack<T, W> segmented_scan(const mask<T, W> &heads,
+                                           const pack<T, W> &p,
+                                           pack<FLAG_T, W> &flags,
+                                           std::false_type /*is_wide*/)
+    {
+      flags = select(heads, pack<FLAG_T, W>(FLAG_T(-1)), pack<FLAG_T, W>(0));
+      return segmented_scan_steps<1>(
+          p, flags, std::integral_constant<bool, (1 < W)>());
+    }
+
+    // NOTE: as with inclusive_scan(), the low half's last sum is carried
+    //       into the lanes of the high half before its first segment start
+
+    template <typename T, int W, typename FLAG_T>
+    TSIMD_INLINE pack<T, W> segmented_scan(const mask<T, W> &heads,
+                                           const pack<T, W> &p,
+                                           pack<FLAG_T, W> &flags,
+                                           std::true_type /*is_wide*/)
+    {
+      using half_t      = pack<T, W / 2>;
+      using half_mask_t = mask<T, W / 2>;
+      using half_flag_t = pack<FLAG_T, W / 2>;
+      using is_wide_half =
+          std::integral_constant<bool, traits::is_wide_pack<T, W / 2>::value>;
+
+      half_flag_t flo, fhi;
+
+      const half_t lo = segmented_scan(half_mask_t(heads.vl),
+                                       half_t(p.vl),
+                                       flo,
+                                       is_wide_half());
+      const half_t hi = segmented_scan(half_mask_t(heads.vh),
+                                       half_t(p.vh),
+                                       fhi,
+                                       is_wide_half());
+
+      flags = pack<FLAG_T, W>(flo, fhi | flo[W / 2 - 1]);
+      return pack<T, W>(lo,
+                        select(fhi == FLAG_T(0), hi + lo[W / 2 - 1], hi));
+    }
+
+    template <typename T, int W, typename FLAG_T>
+    TSIMD_INLINE pack<T, W> segmented_scan(const mask<T, W> &heads,
+                                           const pack<T, W> &p,
+                                           pack<FLAG_T, W> &flags)
+    {
+      using is_wide = traits::is_wide_pack<T, W>;
+      return segmented_scan(
+          heads, p, flags, std::integral_constant<bool, is_wide::value>());
+    }
+
+  }  // namespace detail
+
+  // inclusive_scan() /////////////////////////////////////////////////////////
+
+  // NOTE: lane 'i' of the result is the sum of lanes [0, i] of 'p'
+
+  template <typename T, int W>
+  TSIMD_INLINE pack<T, W> inclusive_scan(const pack<T, W> &p)
+  {
+    static_assert(!traits::is_bool<T>::value,
+                  "tsimd::inclusive_scan() can only be used with non-bool"
+                  " packs");
+    using is_wide = traits::is_wide_pack<T, W>;
+    return detail::inclusive_scan(
+        p, std::integral_constant<bool, is_wide::value>());
+  }
+
+  // NOTE: chains across consecutive packs, 'carry' (the running total of the
+  //       previous packs) is added to every lane and updated to the new total
+
+  template <typename T, int W>
+  TSIMD_INLINE pack<T, W> inclusive_scan(const pack<T, W> &p, T &carry)
+  {
+    const pack<T, W> result = inclusive_scan(p) + carry;
+    carry = result[W - 1];
+    return result;
+  }
+
+  // NOTE: inactive lanes add nothing, but still get the running sum
+
+  template <typename T, int W>
+  TSIMD_INLINE pack<T, W> inclusive_scan(const mask<T, W> &m,
+                                         const pack<T, W> &p)
+  {
+    return inclusive_scan(select(m, p, pack<T, W>(T(0))));
+  }
+
+  // exclusive_scan() /////////////////////////////////////////////////////////
+
+  // NOTE: lane 'i' of the result is the sum of lanes [0, i) of 'p'
+
+  template <typename T, int W>
+  TSIMD_INLINE pack<T, W> exclusive_scan(const pack<T, W> &p)
+  {
+    return shift_lanes_up<1>(inclusive_scan(p));
+  }
+
+  template <typename T, int W>
+  TSIMD_INLINE pack<T, W> exclusive_scan(const pack<T, W> &p, T &carry)
+  {
+    const pack<T, W> sums = inclusive_scan(p);
+    const pack<T, W> result = shift_lanes_up<1>(sums) + carry;
+    carry += sums[W - 1];
+    return result;
+  }
+
+  template <typename T, int W>
+  TSIMD_INLINE pack<T, W> exclusive_scan(const mask<T, W> &m,
+                                         const pack<T, W> &p)
+  {
+    return exclusive_scan(select(m, p, pack<T, W>(T(0))));
+  }
+
+  // segmented_inclusive_scan() ///////////////////////////////////////////////
+
+  // NOTE: like inclusive_scan(), but the sums restart at every lane active
+  //       in 'heads'
+
+  template <typename T, int W>
+  TSIMD_INLINE pack<T, W> segmented_inclusive_scan(const mask<T, W> &heads,
+                                                   const pack<T, W> &p)
+  {
+    static_assert(!traits::is_bool<T>::value,
+                  "tsimd::segmented_inclusive_scan() can only be used with"
+                  " non-bool packs");
+    detail::lane_index_pack<T, W> flags;
+    return detail::segmented_scan(heads, p, flags);
+  }
+
+  // NOTE: 'carry' is added to the lanes before the first segment start, and
+  //       updated to the sum of the last lane's segment
+
+  template <typename T, int W>
+  TSIMD_INLINE pack<T, W> segmented_inclusive_scan(const mask<T, W> &heads,
+                                                   const pack<T, W> &p,
+                                                   T &carry)
+  {
+    static_assert(!traits::is_bool<T>::value,
+                  "tsimd::segmented_inclusive_scan() can only be used with"
+                  " non-bool packs");
+    detail::lane_index_pack<T, W> flags;
+    const pack<T, W> sums = detail::segmented_scan(heads, p, flags);
+    const pack<T, W> result =
+        select(flags == 0, sums + carry, sums);
+    carry = result[W - 1];
+    return result;
+  }
+
+TSIMD_NAMESPACE_END  // namespace tsimd
@@ -26,7 +26,7 @@
 
 #include "../../pack.h"
 
-namespace tsimd {
+TSIMD_NAMESPACE_BEGIN
 
   // 1-wide //
 
@@ -44,10 +44,15 @@ namespace tsimd {
                               const vfloat4 &t,
                               const vfloat4 &f)
   {
-#if defined(__SSE4_1__)
+#if defined(__AVX512VL__)
+    return _mm_mask_blend_ps(m, f, t);
+#elif defined(__SSE4_1__)
     return _mm_blendv_ps(f, t, m);
 #elif defined(__SSE__)
     return _mm_or_ps(_mm_and_ps(m, t), _mm_andnot_ps(m, f));
+#elif TSIMD_VECTOR_EXTENSIONS
+    return detail::from_vext<vfloat4>(
+        detail::vext(m) ? detail::vext(t) : detail::vext(f));
 #else
     vfloat4 result;
 
@@ -60,11 +65,16 @@ namespace tsimd {
 
   TSIMD_INLINE vint4 select(const vboolf4 &m, const vint4 &t, const vint4 &f)
   {
-#if defined(__SSE4_1__)
+#if defined(__AVX512VL__)
+    return _mm_mask_blend_epi32(m, f.v, t.v);
+#elif defined(__SSE4_1__)
     return _mm_castps_si128(
         _mm_blendv_ps(_mm_castsi128_ps(f), _mm_castsi128_ps(t), m));
 #elif defined(__SSE__)
     return _mm_or_si128(_mm_and_si128(m, t), _mm_andnot_si128(m, f));
+#elif TSIMD_VECTOR_EXTENSIONS
+    return detail::from_vext<vint4>(
+        detail::vext(m) ? detail::vext(t) : detail::vext(f));
 #else
     vint4 result;
 
@@ -79,24 +89,43 @@ namespace tsimd {
                                const vdouble4 &t,
                                const vdouble4 &f)
   {
+#if defined(__AVX512VL__)
+    return _mm256_mask_blend_pd(m, f, t);
+#elif defined(__AVX__)
+    return _mm256_blendv_pd(f, t, m);
+#elif TSIMD_VECTOR_EXTENSIONS
+    return detail::from_vext<vdouble4>(
+        detail::vext(m) ? detail::vext(t) : detail::vext(f));
+#else
     vdouble4 result;
 
     for (int i = 0; i < 4; ++i)
       result[i] = m[i] ? t[i] : f[i];
 
     return result;
+#endif
   }
 
   TSIMD_INLINE vllong4 select(const vboold4 &m, 
                               const vllong4 &t,
                               const vllong4 &f)
   {
+#if defined(__AVX512VL__)
+    return _mm256_mask_blend_epi64(m, f, t);
+#elif defined(__AVX__)
+    return _mm256_castpd_si256(
+        _mm256_blendv_pd(_mm256_castsi256_pd(f), _mm256_castsi256_pd(t), m));
+#elif TSIMD_VECTOR_EXTENSIONS
+    return detail::from_vext<vllong4>(
+        detail::vext(m) ? detail::vext(t) : detail::vext(f));
+#else
     vllong4 result;
 
     for (int i = 0; i < 4; ++i)
       result[i] = m[i] ? t[i] : f[i];
 
     return result;
+#endif
   }
 
   // 8-wide //
@@ -105,7 +134,9 @@ namespace tsimd {
                               const vfloat8 &t,
                               const vfloat8 &f)
   {
-#if defined(__AVX2__) || defined(__AVX__)
+#if defined(__AVX512VL__)
+    return _mm256_mask_blend_ps(m, f, t);
+#elif defined(__AVX2__) || defined(__AVX__)
     return _mm256_blendv_ps(f, t, m);
 #else
     return vfloat8(select(vboolf4(m.vl), vfloat4(t.vl), vfloat4(f.vl)),
@@ -115,7 +146,9 @@ namespace tsimd {
 
   TSIMD_INLINE vint8 select(const vboolf8 &m, const vint8 &t, const vint8 &f)
   {
-#if defined(__AVX512F__) || defined(__AVX2__) || defined(__AVX__)
+#if defined(__AVX512VL__)
+    return _mm256_mask_blend_epi32(m, f.v, t.v);
+#elif defined(__AVX512F__) || defined(__AVX2__) || defined(__AVX__)
     return _mm256_castps_si256(
         _mm256_blendv_ps(_mm256_castsi256_ps(f), _mm256_castsi256_ps(t), m));
 #else
@@ -128,16 +161,24 @@ namespace tsimd {
                               const vdouble8 &t,
                               const vdouble8 &f)
   {
+#if defined(__AVX512F__)
+    return _mm512_mask_blend_pd(m, f, t);
+#else
     return vdouble8(select(vboold4(m.vl), vdouble4(t.vl), vdouble4(f.vl)),
                     select(vboold4(m.vh), vdouble4(t.vh), vdouble4(f.vh)));
+#endif
   }
 
   TSIMD_INLINE vllong8 select(const vboold8 &m, 
                               const vllong8 &t,
                               const vllong8 &f)
   {
+#if defined(__AVX512F__)
+    return _mm512_mask_blend_epi64(m, f, t);
+#else
     return vllong8(select(vboold4(m.vl), vllong4(t.vl), vllong4(f.vl)),
                    select(vboold4(m.vh), vllong4(t.vh), vllong4(f.vh)));
+#endif
   }
 
   // 16-wide //
@@ -182,6 +223,130 @@ namespace tsimd {
                     select(vboold8(m.vh), vllong8(t.vh), vllong8(f.vh)));
   }
 
+  // 8/16-bit //
+
+  TSIMD_INLINE vschar16 select(const vboolc16 &m,
+                               const vschar16 &t,
+                               const vschar16 &f)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    return _mm_mask_blend_epi8(m, f.v, t.v);
+#elif defined(__SSE4_1__)
+    return _mm_blendv_epi8(f, t, m);
+#elif defined(__SSE__)
+    return _mm_or_si128(_mm_and_si128(m, t), _mm_andnot_si128(m, f));
+#elif TSIMD_VECTOR_EXTENSIONS
+    return detail::from_vext<vschar16>(
+        detail::vext(m) ? detail::vext(t) : detail::vext(f));
+#else
+    vschar16 result;
+
+    for (int i = 0; i < 16; ++i)
+      result[i] = m[i] ? t[i] : f[i];
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vshort8 select(const vbools8 &m,
+                              const vshort8 &t,
+                              const vshort8 &f)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    return _mm_mask_blend_epi16(m, f.v, t.v);
+#elif defined(__SSE4_1__)
+    return _mm_blendv_epi8(f, t, m);
+#elif defined(__SSE__)
+    return _mm_or_si128(_mm_and_si128(m, t), _mm_andnot_si128(m, f));
+#elif TSIMD_VECTOR_EXTENSIONS
+    return detail::from_vext<vshort8>(
+        detail::vext(m) ? detail::vext(t) : detail::vext(f));
+#else
+    vshort8 result;
+
+    for (int i = 0; i < 8; ++i)
+      result[i] = m[i] ? t[i] : f[i];
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vschar32 select(const vboolc32 &m,
+                               const vschar32 &t,
+                               const vschar32 &f)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    return _mm256_mask_blend_epi8(m, f.v, t.v);
+#elif defined(__AVX2__)
+    return _mm256_blendv_epi8(f, t, m);
+#else
+    return vschar32(select(vboolc16(m.vl), vschar16(t.vl), vschar16(f.vl)),
+                    select(vboolc16(m.vh), vschar16(t.vh), vschar16(f.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vshort16 select(const vbools16 &m,
+                               const vshort16 &t,
+                               const vshort16 &f)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    return _mm256_mask_blend_epi16(m, f.v, t.v);
+#elif defined(__AVX2__)
+    return _mm256_blendv_epi8(f, t, m);
+#else
+    return vshort16(select(vbools8(m.vl), vshort8(t.vl), vshort8(f.vl)),
+                    select(vbools8(m.vh), vshort8(t.vh), vshort8(f.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vschar64 select(const vboolc64 &m,
+                               const vschar64 &t,
+                               const vschar64 &f)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_mask_blend_epi8(m, f.v, t.v);
+#else
+    return vschar64(select(vboolc32(m.vl), vschar32(t.vl), vschar32(f.vl)),
+                    select(vboolc32(m.vh), vschar32(t.vh), vschar32(f.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vshort32 select(const vbools32 &m,
+                               const vshort32 &t,
+                               const vshort32 &f)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_mask_blend_epi16(m, f.v, t.v);
+#else
+    return vshort32(select(vbools16(m.vl), vshort16(t.vl), vshort16(f.vl)),
+                    select(vbools16(m.vh), vshort16(t.vh), vshort16(f.vh)));
+#endif
+  }
+
+  // wide //
+
+  template <typename T,
+            int W,
+            typename = traits::is_wide_pack_t<T, W>,
+            typename = void>
+  TSIMD_INLINE pack<T, W> select(const mask<T, W> &m,
+                                 const pack<T, W> &t,
+                                 const pack<T, W> &f)
+  {
+    return pack<T, W>(select(m.vl, t.vl, f.vl), select(m.vh, t.vh, f.vh));
+  }
+
+  // unsigned (same bits as signed) //
+
+  template <typename T, int W, typename = traits::is_unsigned_pack_t<T, W>>
+  TSIMD_INLINE pack<T, W> select(const mask<T, W> &m,
+                                 const pack<T, W> &t,
+                                 const pack<T, W> &f)
+  {
+    return detail::as_unsigned(
+        select(m, detail::as_signed(t), detail::as_signed(f)));
+  }
+
   // Inferred pack-scalar select //////////////////////////////////////////////
 
   template <typename T,
@@ -206,4 +371,4 @@ namespace tsimd {
     return select(m, pack<T, W>(t), f);
   }
 
-}  // namespace tsimd
\ No newline at end of file
+TSIMD_NAMESPACE_END  // namespace tsimd
\ No newline at end of file
@@ -28,7 +28,7 @@
 
 #include "select.h"
 
-namespace tsimd {
+TSIMD_NAMESPACE_BEGIN
 
   template <typename T, int W>
   TSIMD_INLINE void set_if(pack<T, W>& a,
@@ -38,4 +38,4 @@ namespace tsimd {
     a = select(mask, b, a);
   }
 
-}  // namespace tsimd
\ No newline at end of file
+TSIMD_NAMESPACE_END  // namespace tsimd
\ No newline at end of file
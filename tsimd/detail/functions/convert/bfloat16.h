@@ -0,0 +1,308 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Intel Corporation                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+#pragma once
+
+#include "../../bfloat16_t.h"
+#include "../../pack.h"
+
+TSIMD_NAMESPACE_BEGIN
+
+  // load() from bfloat16_t storage ///////////////////////////////////////////
+
+  // NOTE: bfloat16 is the upper half of a float, widening is a 16-bit shift
+
+  // NOTE: wide packs split the conversion over their two halves
+
+  template <typename PACK_T>
+  TSIMD_INLINE PACK_T load(const bfloat16_t *src)
+  {
+    using HALF_T = pack<typename PACK_T::value_t, PACK_T::static_size / 2>;
+    return PACK_T(load<HALF_T>(src), load<HALF_T>(src + HALF_T::static_size));
+  }
+
+  // 1-wide //
+
+  template <>
+  TSIMD_INLINE vfloat1 load(const bfloat16_t *src)
+  {
+    return vfloat1(float(src[0]));
+  }
+
+  // 4-wide //
+
+  template <>
+  TSIMD_INLINE vfloat4 load(const bfloat16_t *src)
+  {
+#if defined(__SSE__)
+    const __m128i b = _mm_loadl_epi64((const __m128i *)src);
+    return _mm_castsi128_ps(_mm_unpacklo_epi16(_mm_setzero_si128(), b));
+#else
+    vfloat4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = src[i];
+
+    return result;
+#endif
+  }
+
+  // 8-wide //
+
+  template <>
+  TSIMD_INLINE vfloat8 load(const bfloat16_t *src)
+  {
+#if defined(__AVX2__)
+    const __m128i b = _mm_loadu_si128((const __m128i *)src);
+    return _mm256_castsi256_ps(
+        _mm256_slli_epi32(_mm256_cvtepu16_epi32(b), 16));
+#else
+    return vfloat8(load<vfloat4>(src), load<vfloat4>(src + 4));
+#endif
+  }
+
+  // 16-wide //
+
+  template <>
+  TSIMD_INLINE vfloat16 load(const bfloat16_t *src)
+  {
+#if defined(__AVX512F__)
+    const __m256i b = _mm256_loadu_si256((const __m256i *)src);
+    return _mm512_castsi512_ps(
+        _mm512_slli_epi32(_mm512_cvtepu16_epi32(b), 16));
+#else
+    return vfloat16(load<vfloat8>(src), load<vfloat8>(src + 8));
+#endif
+  }
+
+  // store() to bfloat16_t storage ////////////////////////////////////////////
+
+  // NOTE: floats are rounded to the nearest even bfloat16 and nans stay quiet.
+  //       The native AVX512_BF16 conversion also flushes denormals to zero.
+
+  template <typename PACK_T>
+  TSIMD_INLINE void store(const PACK_T &p, bfloat16_t *dst)
+  {
+    store(p.vl, dst);
+    store(p.vh, dst + PACK_T::static_size / 2);
+  }
+
+  // 1-wide //
+
+  template <>
+  TSIMD_INLINE void store(const vfloat1 &p, bfloat16_t *dst)
+  {
+    dst[0] = p[0];
+  }
+
+  // 4-wide //
+
+  template <>
+  TSIMD_INLINE void store(const vfloat4 &p, bfloat16_t *dst)
+  {
+#if defined(__AVX512BF16__) && defined(__AVX512VL__)
+    _mm_storel_epi64((__m128i *)dst, (__m128i)_mm_cvtneps_pbh(p));
+#elif defined(__SSE__)
+    const __m128i x   = _mm_castps_si128(p);
+    const __m128i lsb = _mm_and_si128(_mm_srli_epi32(x, 16), _mm_set1_epi32(1));
+    const __m128i rne =
+        _mm_add_epi32(x, _mm_add_epi32(lsb, _mm_set1_epi32(0x7FFF)));
+    const __m128i nan  = _mm_or_si128(x, _mm_set1_epi32(0x400000));
+    const __m128i mnan = _mm_castps_si128(_mm_cmpunord_ps(p, p));
+    const __m128i r    = _mm_or_si128(_mm_and_si128(mnan, nan),
+                                   _mm_andnot_si128(mnan, rne));
+    // NOTE: an arithmetic shift keeps the 16-bit patterns intact through the
+    //       signed saturation of packs
+    const __m128i b = _mm_srai_epi32(r, 16);
+    _mm_storel_epi64((__m128i *)dst, _mm_packs_epi32(b, b));
+#else
+    for (int i = 0; i < 4; ++i)
+      dst[i] = p[i];
+#endif
+  }
+
+  // 8-wide //
+
+  template <>
+  TSIMD_INLINE void store(const vfloat8 &p, bfloat16_t *dst)
+  {
+#if defined(__AVX512BF16__) && defined(__AVX512VL__)
+    _mm_storeu_si128((__m128i *)dst, (__m128i)_mm256_cvtneps_pbh(p));
+#elif defined(__AVX2__)
+    const __m256i x   = _mm256_castps_si256(p);
+    const __m256i lsb =
+        _mm256_and_si256(_mm256_srli_epi32(x, 16), _mm256_set1_epi32(1));
+    const __m256i rne =
+        _mm256_add_epi32(x, _mm256_add_epi32(lsb, _mm256_set1_epi32(0x7FFF)));
+    const __m256i nan  = _mm256_or_si256(x, _mm256_set1_epi32(0x400000));
+    const __m256i mnan = _mm256_castps_si256(_mm256_cmp_ps(p, p, _CMP_UNORD_Q));
+    const __m256i b =
+        _mm256_srai_epi32(_mm256_blendv_epi8(rne, nan, mnan), 16);
+    _mm_storeu_si128((__m128i *)dst,
+                     _mm_packs_epi32(_mm256_castsi256_si128(b),
+                                     _mm256_extracti128_si256(b, 1)));
+#else
+    store(vfloat4(p.vl), dst);
+    store(vfloat4(p.vh), dst + 4);
+#endif
+  }
+
+  // 16-wide //
+
+  template <>
+  TSIMD_INLINE void store(const vfloat16 &p, bfloat16_t *dst)
+  {
+#if defined(__AVX512BF16__)
+    _mm256_storeu_si256((__m256i *)dst, (__m256i)_mm512_cvtneps_pbh(p));
+#elif defined(__AVX512F__)
+    const __m512i x   = _mm512_castps_si512(p);
+    const __m512i lsb =
+        _mm512_and_si512(_mm512_srli_epi32(x, 16), _mm512_set1_epi32(1));
+    const __m512i rne =
+        _mm512_add_epi32(x, _mm512_add_epi32(lsb, _mm512_set1_epi32(0x7FFF)));
+    const __m512i nan    = _mm512_or_si512(x, _mm512_set1_epi32(0x400000));
+    const __mmask16 mnan = _mm512_cmp_ps_mask(p, p, _CMP_UNORD_Q);
+    const __m512i b =
+        _mm512_srli_epi32(_mm512_mask_blend_epi32(mnan, rne, nan), 16);
+    _mm256_storeu_si256((__m256i *)dst, _mm512_cvtepi32_epi16(b));
+#else
+    store(vfloat8(p.vl), dst);
+    store(vfloat8(p.vh), dst + 8);
+#endif
+  }
+
+  // dpbf16() -- bfloat16 pair dot-product accumulate /////////////////////////
+
+  // NOTE: reads 2*W elements from each of 'a' and 'b' and returns
+  //       acc[i] + a[2i+1]*b[2i+1] + a[2i]*b[2i], like vdpbf16ps
+
+  // 1-wide //
+
+  TSIMD_INLINE vfloat1 dpbf16(const vfloat1 &acc,
+                              const bfloat16_t *a,
+                              const bfloat16_t *b)
+  {
+    return vfloat1(acc[0] + float(a[1]) * float(b[1]) +
+                   float(a[0]) * float(b[0]));
+  }
+
+  // 4-wide //
+
+  TSIMD_INLINE vfloat4 dpbf16(const vfloat4 &acc,
+                              const bfloat16_t *a,
+                              const bfloat16_t *b)
+  {
+#if defined(__AVX512BF16__) && defined(__AVX512VL__)
+    const __m128i ia = _mm_loadu_si128((const __m128i *)a);
+    const __m128i ib = _mm_loadu_si128((const __m128i *)b);
+    return _mm_dpbf16_ps(acc, (__m128bh)ia, (__m128bh)ib);
+#elif defined(__SSE__)
+    const __m128i ia = _mm_loadu_si128((const __m128i *)a);
+    const __m128i ib = _mm_loadu_si128((const __m128i *)b);
+    const __m128i hi = _mm_set1_epi32(0xFFFF0000);
+
+    const __m128 a_odd  = _mm_castsi128_ps(_mm_and_si128(ia, hi));
+    const __m128 b_odd  = _mm_castsi128_ps(_mm_and_si128(ib, hi));
+    const __m128 a_even = _mm_castsi128_ps(_mm_slli_epi32(ia, 16));
+    const __m128 b_even = _mm_castsi128_ps(_mm_slli_epi32(ib, 16));
+
+    const __m128 r = _mm_add_ps(acc, _mm_mul_ps(a_odd, b_odd));
+    return _mm_add_ps(r, _mm_mul_ps(a_even, b_even));
+#else
+    vfloat4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = dpbf16(vfloat1(acc[i]), a + 2 * i, b + 2 * i)[0];
+
+    return result;
+#endif
+  }
+
+  // 8-wide //
+
+  TSIMD_INLINE vfloat8 dpbf16(const vfloat8 &acc,
+                              const bfloat16_t *a,
+                              const bfloat16_t *b)
+  {
+#if defined(__AVX512BF16__) && defined(__AVX512VL__)
+    const __m256i ia = _mm256_loadu_si256((const __m256i *)a);
+    const __m256i ib = _mm256_loadu_si256((const __m256i *)b);
+    return _mm256_dpbf16_ps(acc, (__m256bh)ia, (__m256bh)ib);
+#elif defined(__AVX2__)
+    const __m256i ia = _mm256_loadu_si256((const __m256i *)a);
+    const __m256i ib = _mm256_loadu_si256((const __m256i *)b);
+    const __m256i hi = _mm256_set1_epi32(0xFFFF0000);
+
+    const __m256 a_odd  = _mm256_castsi256_ps(_mm256_and_si256(ia, hi));
+    const __m256 b_odd  = _mm256_castsi256_ps(_mm256_and_si256(ib, hi));
+    const __m256 a_even = _mm256_castsi256_ps(_mm256_slli_epi32(ia, 16));
+    const __m256 b_even = _mm256_castsi256_ps(_mm256_slli_epi32(ib, 16));
+
+    const __m256 r = _mm256_add_ps(acc, _mm256_mul_ps(a_odd, b_odd));
+    return _mm256_add_ps(r, _mm256_mul_ps(a_even, b_even));
+#else
+    return vfloat8(dpbf16(vfloat4(acc.vl), a, b),
+                   dpbf16(vfloat4(acc.vh), a + 8, b + 8));
+#endif
+  }
+
+  // 16-wide //
+
+  TSIMD_INLINE vfloat16 dpbf16(const vfloat16 &acc,
+                               const bfloat16_t *a,
+                               const bfloat16_t *b)
+  {
+#if defined(__AVX512BF16__)
+    const __m512i ia = _mm512_loadu_si512((const __m512i *)a);
+    const __m512i ib = _mm512_loadu_si512((const __m512i *)b);
+    return _mm512_dpbf16_ps(acc, (__m512bh)ia, (__m512bh)ib);
+#elif defined(__AVX512F__)
+    const __m512i ia = _mm512_loadu_si512((const __m512i *)a);
+    const __m512i ib = _mm512_loadu_si512((const __m512i *)b);
+    const __m512i hi = _mm512_set1_epi32(0xFFFF0000);
+
+    const __m512 a_odd  = _mm512_castsi512_ps(_mm512_and_si512(ia, hi));
+    const __m512 b_odd  = _mm512_castsi512_ps(_mm512_and_si512(ib, hi));
+    const __m512 a_even = _mm512_castsi512_ps(_mm512_slli_epi32(ia, 16));
+    const __m512 b_even = _mm512_castsi512_ps(_mm512_slli_epi32(ib, 16));
+
+    const __m512 r = _mm512_add_ps(acc, _mm512_mul_ps(a_odd, b_odd));
+    return _mm512_add_ps(r, _mm512_mul_ps(a_even, b_even));
+#else
+    return vfloat16(dpbf16(vfloat8(acc.vl), a, b),
+                    dpbf16(vfloat8(acc.vh), a + 16, b + 16));
+#endif
+  }
+
+  // wide //
+
+  template <int W, typename = traits::is_wide_pack_t<float, W>>
+  TSIMD_INLINE vfloatn<W> dpbf16(const vfloatn<W> &acc,
+                                 const bfloat16_t *a,
+                                 const bfloat16_t *b)
+  {
+    return vfloatn<W>(dpbf16(acc.vl, a, b), dpbf16(acc.vh, a + W, b + W));
+  }
+
+TSIMD_NAMESPACE_END  // namespace tsimd
\ No newline at end of file
@@ -0,0 +1,368 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Intel Corporation                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+#include "../../half_t.h"
+#include "../../pack.h"
+
+TSIMD_NAMESPACE_BEGIN
+
+  // load() from half_t storage ///////////////////////////////////////////////
+
+  // NOTE: half_t buffers only need 2-byte alignment, they are read unaligned
+
+  // NOTE: wide packs split the conversion over their two halves
+
+  template <typename PACK_T>
+  TSIMD_INLINE PACK_T load(const half_t *src)
+  {
+    using HALF_T = pack<typename PACK_T::value_t, PACK_T::static_size / 2>;
+    return PACK_T(load<HALF_T>(src), load<HALF_T>(src + HALF_T::static_size));
+  }
+
+  template <typename PACK_T>
+  TSIMD_INLINE PACK_T
+  load(const half_t *src,
+       const mask<typename PACK_T::value_t, PACK_T::static_size> &m)
+  {
+    using HALF_T = pack<typename PACK_T::value_t, PACK_T::static_size / 2>;
+    return PACK_T(load<HALF_T>(src, m.vl),
+                  load<HALF_T>(src + HALF_T::static_size, m.vh));
+  }
+
+  // 1-wide //
+
+  template <>
+  TSIMD_INLINE vfloat1 load(const half_t *src)
+  {
+    return vfloat1(float(src[0]));
+  }
+
+  template <>
+  TSIMD_INLINE vfloat1 load(const half_t *src, const vboolf1 &m)
+  {
+    return vfloat1(m[0] ? float(src[0]) : 0.f);
+  }
+
+  // 4-wide //
+
+  template <>
+  TSIMD_INLINE vfloat4 load(const half_t *src)
+  {
+#if defined(__F16C__)
+    return _mm_cvtph_ps(_mm_loadl_epi64((const __m128i *)src));
+#else
+    vfloat4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = src[i];
+
+    return result;
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vfloat4 load(const half_t *src, const vboolf4 &m)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    return _mm_maskz_cvtph_ps(m, _mm_maskz_loadu_epi16(m, src));
+#elif defined(__F16C__)
+    return _mm_and_ps(load<vfloat4>(src), m);
+#else
+    vfloat4 result(0.f);
+
+    for (int i = 0; i < 4; ++i)
+      if (m[i])
+        result[i] = src[i];
+
+    return result;
+#endif
+  }
+
+  // 8-wide //
+
+  template <>
+  TSIMD_INLINE vfloat8 load(const half_t *src)
+  {
+#if defined(__F16C__)
+    return _mm256_cvtph_ps(_mm_loadu_si128((const __m128i *)src));
+#else
+    return vfloat8(load<vfloat4>(src), load<vfloat4>(src + 4));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vfloat8 load(const half_t *src, const vboolf8 &m)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    return _mm256_maskz_cvtph_ps(m, _mm_maskz_loadu_epi16(m, src));
+#elif defined(__F16C__)
+    return _mm256_and_ps(load<vfloat8>(src), m);
+#else
+    return vfloat8(load<vfloat4>(src, vboolf4(m.vl)),
+                   load<vfloat4>(src + 4, vboolf4(m.vh)));
+#endif
+  }
+
+  // 16-wide //
+
+  template <>
+  TSIMD_INLINE vfloat16 load(const half_t *src)
+  {
+#if defined(__AVX512F__)
+    return _mm512_cvtph_ps(_mm256_loadu_si256((const __m256i *)src));
+#else
+    return vfloat16(load<vfloat8>(src), load<vfloat8>(src + 8));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vfloat16 load(const half_t *src, const vboolf16 &m)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    return _mm512_maskz_cvtph_ps(m, _mm256_maskz_loadu_epi16(m, src));
+#elif defined(__AVX512F__)
+    return _mm512_maskz_cvtph_ps(m, _mm256_loadu_si256((const __m256i *)src));
+#else
+    return vfloat16(load<vfloat8>(src, vboolf8(m.vl)),
+                    load<vfloat8>(src + 8, vboolf8(m.vh)));
+#endif
+  }
+
+  // store() to half_t storage ////////////////////////////////////////////////
+
+  // NOTE: floats are rounded to the nearest even half
+
+  template <typename PACK_T>
+  TSIMD_INLINE void store(const PACK_T &p, half_t *dst)
+  {
+    store(p.vl, dst);
+    store(p.vh, dst + PACK_T::static_size / 2);
+  }
+
+  template <typename PACK_T>
+  TSIMD_INLINE void store(
+      const PACK_T &p,
+      half_t *dst,
+      const mask<typename PACK_T::value_t, PACK_T::static_size> &m)
+  {
+    store(p.vl, dst, m.vl);
+    store(p.vh, dst + PACK_T::static_size / 2, m.vh);
+  }
+
+  // 1-wide //
+
+  template <>
+  TSIMD_INLINE void store(const vfloat1 &p, half_t *dst)
+  {
+    dst[0] = p[0];
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vfloat1 &p, half_t *dst, const vboolf1 &m)
+  {
+    if (m[0])
+      dst[0] = p[0];
+  }
+
+  // 4-wide //
+
+  template <>
+  TSIMD_INLINE void store(const vfloat4 &p, half_t *dst)
+  {
+#if defined(__F16C__)
+    _mm_storel_epi64((__m128i *)dst,
+                     _mm_cvtps_ph(p, _MM_FROUND_TO_NEAREST_INT));
+#else
+    for (int i = 0; i < 4; ++i)
+      dst[i] = p[i];
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vfloat4 &p, half_t *dst, const vboolf4 &m)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    _mm_mask_storeu_epi16(dst, m, _mm_cvtps_ph(p, _MM_FROUND_TO_NEAREST_INT));
+#elif defined(__F16C__)
+    const __m128i h   = _mm_cvtps_ph(p, _MM_FROUND_TO_NEAREST_INT);
+    const __m128i old = _mm_loadl_epi64((const __m128i *)dst);
+    const __m128i m16 =
+        _mm_packs_epi32(_mm_castps_si128(m), _mm_castps_si128(m));
+    _mm_storel_epi64((__m128i *)dst, _mm_blendv_epi8(old, h, m16));
+#else
+    for (int i = 0; i < 4; ++i)
+      if (m[i])
+        dst[i] = p[i];
+#endif
+  }
+
+  // 8-wide //
+
+  template <>
+  TSIMD_INLINE void store(const vfloat8 &p, half_t *dst)
+  {
+#if defined(__F16C__)
+    _mm_storeu_si128((__m128i *)dst,
+                     _mm256_cvtps_ph(p, _MM_FROUND_TO_NEAREST_INT));
+#else
+    store(vfloat4(p.vl), dst);
+    store(vfloat4(p.vh), dst + 4);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vfloat8 &p, half_t *dst, const vboolf8 &m)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    _mm_mask_storeu_epi16(
+        dst, m, _mm256_cvtps_ph(p, _MM_FROUND_TO_NEAREST_INT));
+#elif defined(__F16C__)
+    const __m256i mi  = _mm256_castps_si256(m);
+    const __m128i h   = _mm256_cvtps_ph(p, _MM_FROUND_TO_NEAREST_INT);
+    const __m128i old = _mm_loadu_si128((const __m128i *)dst);
+    const __m128i m16 = _mm_packs_epi32(_mm256_castsi256_si128(mi),
+                                        _mm256_extractf128_si256(mi, 1));
+    _mm_storeu_si128((__m128i *)dst, _mm_blendv_epi8(old, h, m16));
+#else
+    store(vfloat4(p.vl), dst, vboolf4(m.vl));
+    store(vfloat4(p.vh), dst + 4, vboolf4(m.vh));
+#endif
+  }
+
+  // 16-wide //
+
+  template <>
+  TSIMD_INLINE void store(const vfloat16 &p, half_t *dst)
+  {
+#if defined(__AVX512F__)
+    _mm256_storeu_si256((__m256i *)dst,
+                        _mm512_cvtps_ph(p, _MM_FROUND_TO_NEAREST_INT));
+#else
+    store(vfloat8(p.vl), dst);
+    store(vfloat8(p.vh), dst + 8);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vfloat16 &p, half_t *dst, const vboolf16 &m)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    _mm256_mask_storeu_epi16(
+        dst, m, _mm512_cvtps_ph(p, _MM_FROUND_TO_NEAREST_INT));
+#elif defined(__AVX512F__)
+    const __m256i old = _mm256_loadu_si256((const __m256i *)dst);
+    _mm256_storeu_si256(
+        (__m256i *)dst,
+        _mm512_mask_cvtps_ph(old, m, p, _MM_FROUND_TO_NEAREST_INT));
+#else
+    store(vfloat8(p.vl), dst, vboolf8(m.vl));
+    store(vfloat8(p.vh), dst + 8, vboolf8(m.vh));
+#endif
+  }
+
+  // gather() from half_t storage /////////////////////////////////////////////
+
+  // NOTE: a 32-bit hardware gather would read 2 bytes past the last half_t,
+  //       so the lanes are collected first and converted all at once
+
+  template <typename PACK_T, typename OFFSET_T>
+  TSIMD_INLINE PACK_T gather(const half_t *src,
+                             const pack<OFFSET_T, PACK_T::static_size> &o)
+  {
+    TSIMD_ALIGN(64) std::array<half_t, PACK_T::static_size> lanes;
+
+    for (int i = 0; i < PACK_T::static_size; ++i)
+      lanes[i] = src[o[i]];
+
+    return load<PACK_T>(lanes.data());
+  }
+
+  template <typename PACK_T, typename OFFSET_T>
+  TSIMD_INLINE PACK_T
+  gather(const half_t *src,
+         const pack<OFFSET_T, PACK_T::static_size> &o,
+         const mask<typename PACK_T::value_t, PACK_T::static_size> &m)
+  {
+    TSIMD_ALIGN(64) std::array<half_t, PACK_T::static_size> lanes;
+
+    for (int i = 0; i < PACK_T::static_size; ++i)
+      lanes[i] = m[i] ? src[o[i]] : half_t(0.f);
+
+    return load<PACK_T>(lanes.data());
+  }
+
+  // convert_buffer() -- bulk half_t <--> float conversion ////////////////////
+
+  TSIMD_INLINE void convert_buffer(const half_t *src, float *dst, size_t count)
+  {
+    size_t i = 0;
+
+#if defined(__AVX512F__)
+    for (; i + 16 <= count; i += 16) {
+      const __m256i h = _mm256_loadu_si256((const __m256i *)(src + i));
+      _mm512_storeu_ps(dst + i, _mm512_cvtph_ps(h));
+    }
+#endif
+
+#if defined(__F16C__)
+    for (; i + 8 <= count; i += 8) {
+      const __m128i h = _mm_loadu_si128((const __m128i *)(src + i));
+      _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(h));
+    }
+#endif
+
+    for (; i < count; ++i)
+      dst[i] = src[i];
+  }
+
+  TSIMD_INLINE void convert_buffer(const float *src, half_t *dst, size_t count)
+  {
+    size_t i = 0;
+
+#if defined(__AVX512F__)
+    for (; i + 16 <= count; i += 16) {
+      const __m512 f = _mm512_loadu_ps(src + i);
+      _mm256_storeu_si256((__m256i *)(dst + i),
+                          _mm512_cvtps_ph(f, _MM_FROUND_TO_NEAREST_INT));
+    }
+#endif
+
+#if defined(__F16C__)
+    for (; i + 8 <= count; i += 8) {
+      const __m256 f = _mm256_loadu_ps(src + i);
+      _mm_storeu_si128((__m128i *)(dst + i),
+                       _mm256_cvtps_ph(f, _MM_FROUND_TO_NEAREST_INT));
+    }
+#endif
+
+    for (; i < count; ++i)
+      dst[i] = src[i];
+  }
+
+TSIMD_NAMESPACE_END  // namespace tsimd
\ No newline at end of file
@@ -0,0 +1,197 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Intel Corporation                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+#pragma once
+
+#include "../../pack.h"
+
+#include "../math/adds.h"
+
+TSIMD_NAMESPACE_BEGIN
+
+  // packs()/packus() -- narrow two packs into one, saturating ////////////////
+
+  // NOTE: the lanes of 'a' fill the low half of the result and the lanes of
+  //       'b' the high half; AVX2/AVX-512 pack within each 128-bit lane, so
+  //       those results get their 64-bit chunks put back in that order
+
+  // 128-bit //
+
+  TSIMD_INLINE vschar16 packs(const vshort8 &a, const vshort8 &b)
+  {
+#if defined(__SSE__)
+    return _mm_packs_epi16(a, b);
+#else
+    vschar16 result;
+
+    for (int i = 0; i < 8; ++i) {
+      result[i]     = detail::saturate_to<signed char>(a[i]);
+      result[8 + i] = detail::saturate_to<signed char>(b[i]);
+    }
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vshort8 packs(const vint4 &a, const vint4 &b)
+  {
+#if defined(__SSE__)
+    return _mm_packs_epi32(a, b);
+#else
+    vshort8 result;
+
+    for (int i = 0; i < 4; ++i) {
+      result[i]     = detail::saturate_to<short>(a[i]);
+      result[4 + i] = detail::saturate_to<short>(b[i]);
+    }
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vuchar16 packus(const vshort8 &a, const vshort8 &b)
+  {
+#if defined(__SSE__)
+    return _mm_packus_epi16(a, b);
+#else
+    vuchar16 result;
+
+    for (int i = 0; i < 8; ++i) {
+      result[i]     = detail::saturate_to<unsigned char>(a[i]);
+      result[8 + i] = detail::saturate_to<unsigned char>(b[i]);
+    }
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vushort8 packus(const vint4 &a, const vint4 &b)
+  {
+#if defined(__SSE4_1__)
+    return _mm_packus_epi32(a, b);
+#else
+    vushort8 result;
+
+    for (int i = 0; i < 4; ++i) {
+      result[i]     = detail::saturate_to<unsigned short>(a[i]);
+      result[4 + i] = detail::saturate_to<unsigned short>(b[i]);
+    }
+
+    return result;
+#endif
+  }
+
+  // 256-bit //
+
+  TSIMD_INLINE vschar32 packs(const vshort16 &a, const vshort16 &b)
+  {
+#if defined(__AVX2__)
+    return _mm256_permute4x64_epi64(_mm256_packs_epi16(a, b),
+                                    _MM_SHUFFLE(3, 1, 2, 0));
+#else
+    return vschar32(packs(vshort8(a.vl), vshort8(a.vh)),
+                    packs(vshort8(b.vl), vshort8(b.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vshort16 packs(const vint8 &a, const vint8 &b)
+  {
+#if defined(__AVX2__)
+    return _mm256_permute4x64_epi64(_mm256_packs_epi32(a, b),
+                                    _MM_SHUFFLE(3, 1, 2, 0));
+#else
+    return vshort16(packs(vint4(a.vl), vint4(a.vh)),
+                    packs(vint4(b.vl), vint4(b.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vuchar32 packus(const vshort16 &a, const vshort16 &b)
+  {
+#if defined(__AVX2__)
+    return _mm256_permute4x64_epi64(_mm256_packus_epi16(a, b),
+                                    _MM_SHUFFLE(3, 1, 2, 0));
+#else
+    return vuchar32(packus(vshort8(a.vl), vshort8(a.vh)),
+                    packus(vshort8(b.vl), vshort8(b.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vushort16 packus(const vint8 &a, const vint8 &b)
+  {
+#if defined(__AVX2__)
+    return _mm256_permute4x64_epi64(_mm256_packus_epi32(a, b),
+                                    _MM_SHUFFLE(3, 1, 2, 0));
+#else
+    return vushort16(packus(vint4(a.vl), vint4(a.vh)),
+                     packus(vint4(b.vl), vint4(b.vh)));
+#endif
+  }
+
+  // 512-bit //
+
+  TSIMD_INLINE vschar64 packs(const vshort32 &a, const vshort32 &b)
+  {
+#if defined(__AVX512BW__)
+    const __m512i order = _mm512_setr_epi64(0, 2, 4, 6, 1, 3, 5, 7);
+    return _mm512_permutexvar_epi64(order, _mm512_packs_epi16(a, b));
+#else
+    return vschar64(packs(vshort16(a.vl), vshort16(a.vh)),
+                    packs(vshort16(b.vl), vshort16(b.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vshort32 packs(const vint16 &a, const vint16 &b)
+  {
+#if defined(__AVX512BW__)
+    const __m512i order = _mm512_setr_epi64(0, 2, 4, 6, 1, 3, 5, 7);
+    return _mm512_permutexvar_epi64(order, _mm512_packs_epi32(a, b));
+#else
+    return vshort32(packs(vint8(a.vl), vint8(a.vh)),
+                    packs(vint8(b.vl), vint8(b.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vuchar64 packus(const vshort32 &a, const vshort32 &b)
+  {
+#if defined(__AVX512BW__)
+    const __m512i order = _mm512_setr_epi64(0, 2, 4, 6, 1, 3, 5, 7);
+    return _mm512_permutexvar_epi64(order, _mm512_packus_epi16(a, b));
+#else
+    return vuchar64(packus(vshort16(a.vl), vshort16(a.vh)),
+                    packus(vshort16(b.vl), vshort16(b.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vushort32 packus(const vint16 &a, const vint16 &b)
+  {
+#if defined(__AVX512BW__)
+    const __m512i order = _mm512_setr_epi64(0, 2, 4, 6, 1, 3, 5, 7);
+    return _mm512_permutexvar_epi64(order, _mm512_packus_epi32(a, b));
+#else
+    return vushort32(packus(vint8(a.vl), vint8(a.vh)),
+                     packus(vint8(b.vl), vint8(b.vh)));
+#endif
+  }
+
+TSIMD_NAMESPACE_END  // namespace tsimd
\ No newline at end of file
@@ -0,0 +1,306 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Intel Corporation                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+#pragma once
+
+#include "../../pack.h"
+
+TSIMD_NAMESPACE_BEGIN
+
+  // unpack_lo()/unpack_hi() -- widen half of the lanes ///////////////////////
+
+  // NOTE: unpack_lo() widens the low half of the lanes and unpack_hi() the
+  //       high half, sign-extending signed and zero-extending unsigned types
+
+  // 128-bit //
+
+  TSIMD_INLINE vshort8 unpack_lo(const vschar16 &p)
+  {
+#if defined(__SSE4_1__)
+    return _mm_cvtepi8_epi16(p);
+#elif defined(__SSE__)
+    return _mm_srai_epi16(_mm_unpacklo_epi8(p, p), 8);
+#else
+    vshort8 result;
+
+    for (int i = 0; i < 8; ++i)
+      result[i] = p[i];
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vshort8 unpack_hi(const vschar16 &p)
+  {
+#if defined(__SSE4_1__)
+    return _mm_cvtepi8_epi16(_mm_unpackhi_epi64(p, p));
+#elif defined(__SSE__)
+    return _mm_srai_epi16(_mm_unpackhi_epi8(p, p), 8);
+#else
+    vshort8 result;
+
+    for (int i = 0; i < 8; ++i)
+      result[i] = p[8 + i];
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vushort8 unpack_lo(const vuchar16 &p)
+  {
+#if defined(__SSE__)
+    return _mm_unpacklo_epi8(p, _mm_setzero_si128());
+#else
+    vushort8 result;
+
+    for (int i = 0; i < 8; ++i)
+      result[i] = p[i];
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vushort8 unpack_hi(const vuchar16 &p)
+  {
+#if defined(__SSE__)
+    return _mm_unpackhi_epi8(p, _mm_setzero_si128());
+#else
+    vushort8 result;
+
+    for (int i = 0; i < 8; ++i)
+      result[i] = p[8 + i];
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vint4 unpack_lo(const vshort8 &p)
+  {
+#if defined(__SSE4_1__)
+    return _mm_cvtepi16_epi32(p);
+#elif defined(__SSE__)
+    return _mm_srai_epi32(_mm_unpacklo_epi16(p, p), 16);
+#else
+    vint4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = p[i];
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vint4 unpack_hi(const vshort8 &p)
+  {
+#if defined(__SSE4_1__)
+    return _mm_cvtepi16_epi32(_mm_unpackhi_epi64(p, p));
+#elif defined(__SSE__)
+    return _mm_srai_epi32(_mm_unpackhi_epi16(p, p), 16);
+#else
+    vint4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = p[4 + i];
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vuint4 unpack_lo(const vushort8 &p)
+  {
+#if defined(__SSE__)
+    return _mm_unpacklo_epi16(p, _mm_setzero_si128());
+#else
+    vuint4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = p[i];
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vuint4 unpack_hi(const vushort8 &p)
+  {
+#if defined(__SSE__)
+    return _mm_unpackhi_epi16(p, _mm_setzero_si128());
+#else
+    vuint4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = p[4 + i];
+
+    return result;
+#endif
+  }
+
+  // 256-bit //
+
+  TSIMD_INLINE vshort16 unpack_lo(const vschar32 &p)
+  {
+#if defined(__AVX2__)
+    return _mm256_cvtepi8_epi16(p.vl);
+#else
+    return vshort16(unpack_lo(vschar16(p.vl)), unpack_hi(vschar16(p.vl)));
+#endif
+  }
+
+  TSIMD_INLINE vshort16 unpack_hi(const vschar32 &p)
+  {
+#if defined(__AVX2__)
+    return _mm256_cvtepi8_epi16(p.vh);
+#else
+    return vshort16(unpack_lo(vschar16(p.vh)), unpack_hi(vschar16(p.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vushort16 unpack_lo(const vuchar32 &p)
+  {
+#if defined(__AVX2__)
+    return _mm256_cvtepu8_epi16(p.vl);
+#else
+    return vushort16(unpack_lo(vuchar16(p.vl)), unpack_hi(vuchar16(p.vl)));
+#endif
+  }
+
+  TSIMD_INLINE vushort16 unpack_hi(const vuchar32 &p)
+  {
+#if defined(__AVX2__)
+    return _mm256_cvtepu8_epi16(p.vh);
+#else
+    return vushort16(unpack_lo(vuchar16(p.vh)), unpack_hi(vuchar16(p.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vint8 unpack_lo(const vshort16 &p)
+  {
+#if defined(__AVX2__)
+    return _mm256_cvtepi16_epi32(p.vl);
+#else
+    return vint8(unpack_lo(vshort8(p.vl)), unpack_hi(vshort8(p.vl)));
+#endif
+  }
+
+  TSIMD_INLINE vint8 unpack_hi(const vshort16 &p)
+  {
+#if defined(__AVX2__)
+    return _mm256_cvtepi16_epi32(p.vh);
+#else
+    return vint8(unpack_lo(vshort8(p.vh)), unpack_hi(vshort8(p.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vuint8 unpack_lo(const vushort16 &p)
+  {
+#if defined(__AVX2__)
+    return _mm256_cvtepu16_epi32(p.vl);
+#else
+    return vuint8(unpack_lo(vushort8(p.vl)), unpack_hi(vushort8(p.vl)));
+#endif
+  }
+
+  TSIMD_INLINE vuint8 unpack_hi(const vushort16 &p)
+  {
+#if defined(__AVX2__)
+    return _mm256_cvtepu16_epi32(p.vh);
+#else
+    return vuint8(unpack_lo(vushort8(p.vh)), unpack_hi(vushort8(p.vh)));
+#endif
+  }
+
+  // 512-bit //
+
+  TSIMD_INLINE vshort32 unpack_lo(const vschar64 &p)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_cvtepi8_epi16(p.vl);
+#else
+    return vshort32(unpack_lo(vschar32(p.vl)), unpack_hi(vschar32(p.vl)));
+#endif
+  }
+
+  TSIMD_INLINE vshort32 unpack_hi(const vschar64 &p)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_cvtepi8_epi16(p.vh);
+#else
+    return vshort32(unpack_lo(vschar32(p.vh)), unpack_hi(vschar32(p.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vushort32 unpack_lo(const vuchar64 &p)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_cvtepu8_epi16(p.vl);
+#else
+    return vushort32(unpack_lo(vuchar32(p.vl)), unpack_hi(vuchar32(p.vl)));
+#endif
+  }
+
+  TSIMD_INLINE vushort32 unpack_hi(const vuchar64 &p)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_cvtepu8_epi16(p.vh);
+#else
+    return vushort32(unpack_lo(vuchar32(p.vh)), unpack_hi(vuchar32(p.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vint16 unpack_lo(const vshort32 &p)
+  {
+#if defined(__AVX512F__)
+    return _mm512_cvtepi16_epi32(p.vl);
+#else
+    return vint16(unpack_lo(vshort16(p.vl)), unpack_hi(vshort16(p.vl)));
+#endif
+  }
+
+  TSIMD_INLINE vint16 unpack_hi(const vshort32 &p)
+  {
+#if defined(__AVX512F__)
+    return _mm512_cvtepi16_epi32(p.vh);
+#else
+    return vint16(unpack_lo(vshort16(p.vh)), unpack_hi(vshort16(p.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vuint16 unpack_lo(const vushort32 &p)
+  {
+#if defined(__AVX512F__)
+    return _mm512_cvtepu16_epi32(p.vl);
+#else
+    return vuint16(unpack_lo(vushort16(p.vl)), unpack_hi(vushort16(p.vl)));
+#endif
+  }
+
+  TSIMD_INLINE vuint16 unpack_hi(const vushort32 &p)
+  {
+#if defined(__AVX512F__)
+    return _mm512_cvtepu16_epi32(p.vh);
+#else
+    return vuint16(unpack_lo(vushort16(p.vh)), unpack_hi(vushort16(p.vh)));
+#endif
+  }
+
+TSIMD_NAMESPACE_END  // namespace tsimd
\ No newline at end of file
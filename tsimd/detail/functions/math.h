@@ -25,14 +25,20 @@
 #pragma once
 
 #include "math/abs.h"
+#include "math/adds.h"
+#include "math/avg.h"
 #include "math/ceil.h"
 #include "math/cos.h"
 #include "math/exp.h"
 #include "math/floor.h"
+#include "math/fma.h"
 #include "math/log.h"
 #include "math/max.h"
 #include "math/min.h"
+#include "math/mul_wide.h"
+#include "math/mulhi.h"
 #include "math/pow.h"
 #include "math/sin.h"
 #include "math/sqrt.h"
+#include "math/subs.h"
 #include "math/tan.h"
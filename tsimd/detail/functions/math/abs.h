@@ -28,7 +28,7 @@
 
 #include "../../pack.h"
 
-namespace tsimd {
+TSIMD_NAMESPACE_BEGIN
 
   // 1-wide //
 
@@ -44,6 +44,9 @@ namespace tsimd {
   {
 #if defined(__SSE__)
     return _mm_and_ps(p, _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff)));
+#elif TSIMD_VECTOR_EXTENSIONS
+    const auto a = detail::vext(p);
+    return detail::from_vext<vfloat4>(a < 0 ? -a : a);
 #else
     vfloat4 result;
 
@@ -58,6 +61,9 @@ namespace tsimd {
   {
 #if defined(__SSE__)
     return _mm_abs_epi32(p);
+#elif TSIMD_VECTOR_EXTENSIONS
+    const auto a = detail::vext(p);
+    return detail::from_vext<vint4>(a < 0 ? -a : a);
 #else
     vint4 result;
 
@@ -70,22 +76,45 @@ namespace tsimd {
 
   TSIMD_INLINE vdouble4 abs(const vdouble4 &p)
   {
+#if defined(__AVX__)
+    return _mm256_and_pd(
+        p, _mm256_castsi256_pd(_mm256_set1_epi64x(0x7fffffffffffffffLL)));
+#elif TSIMD_VECTOR_EXTENSIONS
+    const auto a = detail::vext(p);
+    return detail::from_vext<vdouble4>(a < 0 ? -a : a);
+#else
     vdouble4 result;
 
     for (int i = 0; i < 4; ++i)
       result[i] = std::abs(p[i]);
 
     return result;
+#endif
   }
 
   TSIMD_INLINE vllong4 abs(const vllong4 &p)
   {
+#if defined(__AVX512VL__)
+    return _mm256_abs_epi64(p);
+#elif defined(__AVX2__)
+    const __m256i sign = _mm256_cmpgt_epi64(_mm256_setzero_si256(), p);
+    return _mm256_sub_epi64(_mm256_xor_si256(p, sign), sign);
+#elif defined(__AVX__)
+    const __m128i sign_l = _mm_cmpgt_epi64(_mm_setzero_si128(), p.vl);
+    const __m128i sign_h = _mm_cmpgt_epi64(_mm_setzero_si128(), p.vh);
+    return vllong4(_mm_sub_epi64(_mm_xor_si128(p.vl, sign_l), sign_l),
+                   _mm_sub_epi64(_mm_xor_si128(p.vh, sign_h), sign_h));
+#elif TSIMD_VECTOR_EXTENSIONS
+    const auto a = detail::vext(p);
+    return detail::from_vext<vllong4>(a < 0 ? -a : a);
+#else
     vllong4 result;
 
     for (int i = 0; i < 4; ++i)
       result[i] = std::abs(p[i]);
 
     return result;
+#endif
   }
 
   // 8-wide //
@@ -112,12 +141,22 @@ namespace tsimd {
 
   TSIMD_INLINE vdouble8 abs(const vdouble8 &p)
   {
+#if defined(__AVX512F__)
+    return _mm512_castsi512_pd(
+        _mm512_and_epi64(_mm512_castpd_si512(p),
+                         _mm512_set1_epi64(0x7fffffffffffffffLL)));
+#else
     return vdouble8(abs(vdouble4(p.vl)), abs(vdouble4(p.vh)));
+#endif
   }
 
   TSIMD_INLINE vllong8 abs(const vllong8 &p)
   {
+#if defined(__AVX512F__)
+    return _mm512_abs_epi64(p);
+#else
     return vllong8(abs(vllong4(p.vl)), abs(vllong4(p.vh)));
+#endif
   }
 
   // 16-wide //
@@ -152,4 +191,13 @@ namespace tsimd {
     return vllong16(abs(vllong8(p.vl)), abs(vllong8(p.vh)));
   }
 
-}  // namespace tsimd
\ No newline at end of file
+
+  // wide //
+
+  template <typename T, int W, typename = traits::is_wide_pack_t<T, W>>
+  TSIMD_INLINE pack<T, W> abs(const pack<T, W> &p)
+  {
+    return pack<T, W>(abs(p.vl), abs(p.vh));
+  }
+
+TSIMD_NAMESPACE_END  // namespace tsimd
\ No newline at end of file
@@ -28,7 +28,7 @@
 
 #include "../../pack.h"
 
-namespace tsimd {
+TSIMD_NAMESPACE_BEGIN
 
   // 1-wide //
 
@@ -56,12 +56,16 @@ namespace tsimd {
 
   TSIMD_INLINE vdouble4 ceil(const vdouble4 &p)
   {
+#if defined(__AVX__)
+    return _mm256_round_pd(p, _MM_FROUND_TO_POS_INF);
+#else
     vdouble4 result;
 
     for (int i = 0; i < 4; ++i)
       result[i] = std::ceil(p[i]);
 
     return result;
+#endif
   }
 
   // 8-wide //
@@ -77,7 +81,11 @@ namespace tsimd {
   
   TSIMD_INLINE vdouble8 ceil(const vdouble8 &p)
   {
+#if defined(__AVX512F__)
+    return _mm512_ceil_pd(p);
+#else
     return vdouble8(ceil(vdouble4(p.vl)), ceil(vdouble4(p.vh)));
+#endif
   }
 
   // 16-wide //
@@ -96,4 +104,13 @@ namespace tsimd {
     return vdouble16(ceil(vdouble8(p.vl)), ceil(vdouble8(p.vh)));
   }
 
-}  // namespace tsimd
\ No newline at end of file
+
+  // wide //
+
+  template <typename T, int W, typename = traits::is_wide_pack_t<T, W>>
+  TSIMD_INLINE pack<T, W> ceil(const pack<T, W> &p)
+  {
+    return pack<T, W>(ceil(p.vl), ceil(p.vh));
+  }
+
+TSIMD_NAMESPACE_END  // namespace tsimd
\ No newline at end of file
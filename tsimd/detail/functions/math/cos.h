@@ -31,8 +31,9 @@
 #include "../algorithm/select.h"
 
 #include "floor.h"
+#include "fma.h"
 
-namespace tsimd {
+TSIMD_NAMESPACE_BEGIN
 
   template <typename T, int W>
   TSIMD_INLINE pack<T, W> cos(const pack<T, W> &p)
@@ -58,7 +59,7 @@ namespace tsimd {
     const auto k = vintn<W>(kReal);
 
     // Reduced range version of x
-    const auto x = p - kReal * piOverTwoVec;
+    const auto x = fnma(kReal, piOverTwoVec, p);
 
     const auto kMod4 = k & 3;
     const auto cosUseCos = (kMod4 == 0 | kMod4 == 2);
@@ -84,15 +85,15 @@ namespace tsimd {
     const auto c10 = select(cosUseCos, vfloatn<W>(cosC10), vfloatn<W>(sinC10));
 
     const auto x2 = x * x;
-    auto formula = x2 * c10 + c8;
-    formula = x2 * formula + c6;
-    formula = x2 * formula + c4;
-    formula = x2 * formula + c2;
-    formula = x2 * formula + 1.;
+    auto formula = fma(x2, c10, c8);
+    formula = fma(x2, formula, c6);
+    formula = fma(x2, formula, c4);
+    formula = fma(x2, formula, c2);
+    formula = fma(x2, formula, 1.);
     formula *= outside;
 
     formula = select(flipSign, -formula, formula);
     return formula;
   }
 
-}  // namespace tsimd
\ No newline at end of file
+TSIMD_NAMESPACE_END  // namespace tsimd
\ No newline at end of file
@@ -29,10 +29,11 @@
 #include "../../pack.h"
 
 #include "floor.h"
+#include "fma.h"
 
 #include "../algorithm/select.h"
 
-namespace tsimd {
+TSIMD_NAMESPACE_BEGIN
 
   template <typename T, int W>
   TSIMD_INLINE pack<T, W> exp(const pack<T, W> &p)
@@ -67,15 +68,17 @@ namespace tsimd {
   template <int W>
   TSIMD_INLINE vfloatn<W> fast_exp(vfloatn<W> p)
   {
-    auto z = floor(1.44269504088896341f * p + 0.5f);
-    p -= z * 0.693359375f;
-    p -= z * -2.12194440e-4f;
+    auto z = floor(fma(p, 1.44269504088896341f, 0.5f));
+    p = fnma(z, 0.693359375f, p);
+    p = fnma(z, -2.12194440e-4f, p);
     auto n = vintn<W>(z);
 
-    z = p * p;
-    z = (((((1.9875691500E-4f  * p + 1.3981999507E-3f) * p +
-            8.3334519073E-3f) * p + 4.1665795894E-2f) * p +
-          1.6666665459E-1f) * p + 5.0000001201E-1f) * z + p + 1.f;
+    auto y = fma(p, 1.9875691500E-4f, 1.3981999507E-3f);
+    y = fma(y, p, 8.3334519073E-3f);
+    y = fma(y, p, 4.1665795894E-2f);
+    y = fma(y, p, 1.6666665459E-1f);
+    y = fma(y, p, 5.0000001201E-1f);
+    z = fma(y, p * p, p + 1.f);
     p = detail::ldexp(z, n);
     return p;
   }
@@ -141,4 +144,4 @@ namespace tsimd {
   }
 #endif
 
-}  // namespace tsimd
\ No newline at end of file
+TSIMD_NAMESPACE_END  // namespace tsimd
\ No newline at end of file
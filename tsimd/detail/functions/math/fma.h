@@ -0,0 +1,616 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Intel Corporation                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+#pragma once
+
+#include <cmath>
+
+#include "../../pack.h"
+
+#include "../../operators/arithmetic/minus.h"
+#include "../../operators/arithmetic/negate.h"
+#include "../../operators/arithmetic/plus.h"
+#include "../../operators/arithmetic/times.h"
+
+TSIMD_NAMESPACE_BEGIN
+
+  // NOTE: fused multiply-add computes a * b + c with a single rounding, the
+  //       fallbacks without FMA hardware round the product and the sum
+  //       separately (like writing out the expression by hand)
+
+  // fma() -- a * b + c ////////////////////////////////////////////////////////
+
+  // 1-wide //
+
+  template <typename T, typename = traits::is_floating_point_t<T>>
+  TSIMD_INLINE pack<T, 1> fma(const pack<T, 1> &p1,
+                              const pack<T, 1> &p2,
+                              const pack<T, 1> &p3)
+  {
+#if defined(__FMA__)
+    return pack<T, 1>(std::fma(p1[0], p2[0], p3[0]));
+#else
+    return p1 * p2 + p3;
+#endif
+  }
+
+  // 4-wide //
+
+  TSIMD_INLINE vfloat4 fma(const vfloat4 &p1,
+                           const vfloat4 &p2,
+                           const vfloat4 &p3)
+  {
+#if defined(__FMA__)
+    return _mm_fmadd_ps(p1, p2, p3);
+#else
+    return p1 * p2 + p3;
+#endif
+  }
+
+  TSIMD_INLINE vdouble4 fma(const vdouble4 &p1,
+                            const vdouble4 &p2,
+                            const vdouble4 &p3)
+  {
+#if defined(__FMA__)
+    return _mm256_fmadd_pd(p1, p2, p3);
+#else
+    return p1 * p2 + p3;
+#endif
+  }
+
+  // 8-wide //
+
+  TSIMD_INLINE vfloat8 fma(const vfloat8 &p1,
+                           const vfloat8 &p2,
+                           const vfloat8 &p3)
+  {
+#if defined(__FMA__)
+    return _mm256_fmadd_ps(p1, p2, p3);
+#else
+    return p1 * p2 + p3;
+#endif
+  }
+
+  TSIMD_INLINE vdouble8 fma(const vdouble8 &p1,
+                            const vdouble8 &p2,
+                            const vdouble8 &p3)
+  {
+#if defined(__AVX512F__)
+    return _mm512_fmadd_pd(p1, p2, p3);
+#elif defined(__FMA__)
+    return vdouble8(fma(vdouble4(p1.vl), vdouble4(p2.vl), vdouble4(p3.vl)),
+                    fma(vdouble4(p1.vh), vdouble4(p2.vh), vdouble4(p3.vh)));
+#else
+    return p1 * p2 + p3;
+#endif
+  }
+
+  // 16-wide //
+
+  TSIMD_INLINE vfloat16 fma(const vfloat16 &p1,
+                            const vfloat16 &p2,
+                            const vfloat16 &p3)
+  {
+#if defined(__AVX512F__)
+    return _mm512_fmadd_ps(p1, p2, p3);
+#elif defined(__FMA__)
+    return vfloat16(fma(vfloat8(p1.vl), vfloat8(p2.vl), vfloat8(p3.vl)),
+                    fma(vfloat8(p1.vh), vfloat8(p2.vh), vfloat8(p3.vh)));
+#else
+    return p1 * p2 + p3;
+#endif
+  }
+
+  TSIMD_INLINE vdouble16 fma(const vdouble16 &p1,
+                             const vdouble16 &p2,
+                             const vdouble16 &p3)
+  {
+#if defined(__FMA__)
+    return vdouble16(fma(vdouble8(p1.vl), vdouble8(p2.vl), vdouble8(p3.vl)),
+                     fma(vdouble8(p1.vh), vdouble8(p2.vh), vdouble8(p3.vh)));
+#else
+    return p1 * p2 + p3;
+#endif
+  }
+
+  // wide //
+
+  template <typename T,
+            int W,
+            typename = traits::is_floating_point_t<T>,
+            typename = traits::is_wide_pack_t<T, W>>
+  TSIMD_INLINE pack<T, W> fma(const pack<T, W> &p1,
+                              const pack<T, W> &p2,
+                              const pack<T, W> &p3)
+  {
+    return pack<T, W>(fma(p1.vl, p2.vl, p3.vl), fma(p1.vh, p2.vh, p3.vh));
+  }
+
+  // fms() -- a * b - c ////////////////////////////////////////////////////////
+
+  // 1-wide //
+
+  template <typename T, typename = traits::is_floating_point_t<T>>
+  TSIMD_INLINE pack<T, 1> fms(const pack<T, 1> &p1,
+                              const pack<T, 1> &p2,
+                              const pack<T, 1> &p3)
+  {
+#if defined(__FMA__)
+    return pack<T, 1>(std::fma(p1[0], p2[0], -p3[0]));
+#else
+    return p1 * p2 - p3;
+#endif
+  }
+
+  // 4-wide //
+
+  TSIMD_INLINE vfloat4 fms(const vfloat4 &p1,
+                           const vfloat4 &p2,
+                           const vfloat4 &p3)
+  {
+#if defined(__FMA__)
+    return _mm_fmsub_ps(p1, p2, p3);
+#else
+    return p1 * p2 - p3;
+#endif
+  }
+
+  TSIMD_INLINE vdouble4 fms(const vdouble4 &p1,
+                            const vdouble4 &p2,
+                            const vdouble4 &p3)
+  {
+#if defined(__FMA__)
+    return _mm256_fmsub_pd(p1, p2, p3);
+#else
+    return p1 * p2 - p3;
+#endif
+  }
+
+  // 8-wide //
+
+  TSIMD_INLINE vfloat8 fms(const vfloat8 &p1,
+                           const vfloat8 &p2,
+                           const vfloat8 &p3)
+  {
+#if defined(__FMA__)
+    return _mm256_fmsub_ps(p1, p2, p3);
+#else
+    return p1 * p2 - p3;
+#endif
+  }
+
+  TSIMD_INLINE vdouble8 fms(const vdouble8 &p1,
+                            const vdouble8 &p2,
+                            const vdouble8 &p3)
+  {
+#if defined(__AVX512F__)
+    return _mm512_fmsub_pd(p1, p2, p3);
+#elif defined(__FMA__)
+    return vdouble8(fms(vdouble4(p1.vl), vdouble4(p2.vl), vdouble4(p3.vl)),
+                    fms(vdouble4(p1.vh), vdouble4(p2.vh), vdouble4(p3.vh)));
+#else
+    return p1 * p2 - p3;
+#endif
+  }
+
+  // 16-wide //
+
+  TSIMD_INLINE vfloat16 fms(const vfloat16 &p1,
+                            const vfloat16 &p2,
+                            const vfloat16 &p3)
+  {
+#if defined(__AVX512F__)
+    return _mm512_fmsub_ps(p1, p2, p3);
+#elif defined(__FMA__)
+    return vfloat16(fms(vfloat8(p1.vl), vfloat8(p2.vl), vfloat8(p3.vl)),
+                    fms(vfloat8(p1.vh), vfloat8(p2.vh), vfloat8(p3.vh)));
+#else
+    return p1 * p2 - p3;
+#endif
+  }
+
+  TSIMD_INLINE vdouble16 fms(const vdouble16 &p1,
+                             const vdouble16 &p2,
+                             const vdouble16 &p3)
+  {
+#if defined(__FMA__)
+    return vdouble16(fms(vdouble8(p1.vl), vdouble8(p2.vl), vdouble8(p3.vl)),
+                     fms(vdouble8(p1.vh), vdouble8(p2.vh), vdouble8(p3.vh)));
+#else
+    return p1 * p2 - p3;
+#endif
+  }
+
+  // wide //
+
+  template <typename T,
+            int W,
+            typename = traits::is_floating_point_t<T>,
+            typename = traits::is_wide_pack_t<T, W>>
+  TSIMD_INLINE pack<T, W> fms(const pack<T, W> &p1,
+                              const pack<T, W> &p2,
+                              const pack<T, W> &p3)
+  {
+    return pack<T, W>(fms(p1.vl, p2.vl, p3.vl), fms(p1.vh, p2.vh, p3.vh));
+  }
+
+  // fnma() -- -(a * b) + c ////////////////////////////////////////////////////
+
+  // 1-wide //
+
+  template <typename T, typename = traits::is_floating_point_t<T>>
+  TSIMD_INLINE pack<T, 1> fnma(const pack<T, 1> &p1,
+                               const pack<T, 1> &p2,
+                               const pack<T, 1> &p3)
+  {
+#if defined(__FMA__)
+    return pack<T, 1>(std::fma(-p1[0], p2[0], p3[0]));
+#else
+    return p3 - p1 * p2;
+#endif
+  }
+
+  // 4-wide //
+
+  TSIMD_INLINE vfloat4 fnma(const vfloat4 &p1,
+                            const vfloat4 &p2,
+                            const vfloat4 &p3)
+  {
+#if defined(__FMA__)
+    return _mm_fnmadd_ps(p1, p2, p3);
+#else
+    return p3 - p1 * p2;
+#endif
+  }
+
+  TSIMD_INLINE vdouble4 fnma(const vdouble4 &p1,
+                             const vdouble4 &p2,
+                             const vdouble4 &p3)
+  {
+#if defined(__FMA__)
+    return _mm256_fnmadd_pd(p1, p2, p3);
+#else
+    return p3 - p1 * p2;
+#endif
+  }
+
+  // 8-wide //
+
+  TSIMD_INLINE vfloat8 fnma(const vfloat8 &p1,
+                            const vfloat8 &p2,
+                            const vfloat8 &p3)
+  {
+#if defined(__FMA__)
+    return _mm256_fnmadd_ps(p1, p2, p3);
+#else
+    return p3 - p1 * p2;
+#endif
+  }
+
+  TSIMD_INLINE vdouble8 fnma(const vdouble8 &p1,
+                             const vdouble8 &p2,
+                             const vdouble8 &p3)
+  {
+#if defined(__AVX512F__)
+    return _mm512_fnmadd_pd(p1, p2, p3);
+#elif defined(__FMA__)
+    return vdouble8(fnma(vdouble4(p1.vl), vdouble4(p2.vl), vdouble4(p3.vl)),
+                    fnma(vdouble4(p1.vh), vdouble4(p2.vh), vdouble4(p3.vh)));
+#else
+    return p3 - p1 * p2;
+#endif
+  }
+
+  // 16-wide //
+
+  TSIMD_INLINE vfloat16 fnma(const vfloat16 &p1,
+                             const vfloat16 &p2,
+                             const vfloat16 &p3)
+  {
+#if defined(__AVX512F__)
+    return _mm512_fnmadd_ps(p1, p2, p3);
+#elif defined(__FMA__)
+    return vfloat16(fnma(vfloat8(p1.vl), vfloat8(p2.vl), vfloat8(p3.vl)),
+                    fnma(vfloat8(p1.vh), vfloat8(p2.vh), vfloat8(p3.vh)));
+#else
+    return p3 - p1 * p2;
+#endif
+  }
+
+  TSIMD_INLINE vdouble16 fnma(const vdouble16 &p1,
+                              const vdouble16 &p2,
+                              const vdouble16 &p3)
+  {
+#if defined(__FMA__)
+    return vdouble16(fnma(vdouble8(p1.vl), vdouble8(p2.vl), vdouble8(p3.vl)),
+                     fnma(vdouble8(p1.vh), vdouble8(p2.vh), vdouble8(p3.vh)));
+#else
+    return p3 - p1 * p2;
+#endif
+  }
+
+  // wide //
+
+  template <typename T,
+            int W,
+            typename = traits::is_floating_point_t<T>,
+            typename = traits::is_wide_pack_t<T, W>>
+  TSIMD_INLINE pack<T, W> fnma(const pack<T, W> &p1,
+                               const pack<T, W> &p2,
+                               const pack<T, W> &p3)
+  {
+    return pack<T, W>(fnma(p1.vl, p2.vl, p3.vl), fnma(p1.vh, p2.vh, p3.vh));
+  }
+
+  // fnms() -- -(a * b) - c ////////////////////////////////////////////////////
+
+  // 1-wide //
+
+  template <typename T, typename = traits::is_floating_point_t<T>>
+  TSIMD_INLINE pack<T, 1> fnms(const pack<T, 1> &p1,
+                               const pack<T, 1> &p2,
+                               const pack<T, 1> &p3)
+  {
+#if defined(__FMA__)
+    return pack<T, 1>(std::fma(-p1[0], p2[0], -p3[0]));
+#else
+    return -(p1 * p2 + p3);
+#endif
+  }
+
+  // 4-wide //
+
+  TSIMD_INLINE vfloat4 fnms(const vfloat4 &p1,
+                            const vfloat4 &p2,
+                            const vfloat4 &p3)
+  {
+#if defined(__FMA__)
+    return _mm_fnmsub_ps(p1, p2, p3);
+#else
+    return -(p1 * p2 + p3);
+#endif
+  }
+
+  TSIMD_INLINE vdouble4 fnms(const vdouble4 &p1,
+                             const vdouble4 &p2,
+                             const vdouble4 &p3)
+  {
+#if defined(__FMA__)
+    return _mm256_fnmsub_pd(p1, p2, p3);
+#else
+    return -(p1 * p2 + p3);
+#endif
+  }
+
+  // 8-wide //
+
+  TSIMD_INLINE vfloat8 fnms(const vfloat8 &p1,
+                            const vfloat8 &p2,
+                            const vfloat8 &p3)
+  {
+#if defined(__FMA__)
+    return _mm256_fnmsub_ps(p1, p2, p3);
+#else
+    return -(p1 * p2 + p3);
+#endif
+  }
+
+  TSIMD_INLINE vdouble8 fnms(const vdouble8 &p1,
+                             const vdouble8 &p2,
+                             const vdouble8 &p3)
+  {
+#if defined(__AVX512F__)
+    return _mm512_fnmsub_pd(p1, p2, p3);
+#elif defined(__FMA__)
+    return vdouble8(fnms(vdouble4(p1.vl), vdouble4(p2.vl), vdouble4(p3.vl)),
+                    fnms(vdouble4(p1.vh), vdouble4(p2.vh), vdouble4(p3.vh)));
+#else
+    return -(p1 * p2 + p3);
+#endif
+  }
+
+  // 16-wide //
+
+  TSIMD_INLINE vfloat16 fnms(const vfloat16 &p1,
+                             const vfloat16 &p2,
+                             const vfloat16 &p3)
+  {
+#if defined(__AVX512F__)
+    return _mm512_fnmsub_ps(p1, p2, p3);
+#elif defined(__FMA__)
+    return vfloat16(fnms(vfloat8(p1.vl), vfloat8(p2.vl), vfloat8(p3.vl)),
+                    fnms(vfloat8(p1.vh), vfloat8(p2.vh), vfloat8(p3.vh)));
+#else
+    return -(p1 * p2 + p3);
+#endif
+  }
+
+  TSIMD_INLINE vdouble16 fnms(const vdouble16 &p1,
+                              const vdouble16 &p2,
+                              const vdouble16 &p3)
+  {
+#if defined(__FMA__)
+    return vdouble16(fnms(vdouble8(p1.vl), vdouble8(p2.vl), vdouble8(p3.vl)),
+                     fnms(vdouble8(p1.vh), vdouble8(p2.vh), vdouble8(p3.vh)));
+#else
+    return -(p1 * p2 + p3);
+#endif
+  }
+
+  // wide //
+
+  template <typename T,
+            int W,
+            typename = traits::is_floating_point_t<T>,
+            typename = traits::is_wide_pack_t<T, W>>
+  TSIMD_INLINE pack<T, W> fnms(const pack<T, W> &p1,
+                               const pack<T, W> &p2,
+                               const pack<T, W> &p3)
+  {
+    return pack<T, W>(fnms(p1.vl, p2.vl, p3.vl), fnms(p1.vh, p2.vh, p3.vh));
+  }
+
+  // Inferred pack-scalar versions ////////////////////////////////////////////
+
+  template <typename T,
+            int W,
+            typename OTHER_T,
+            typename = traits::can_convert<OTHER_T, T>>
+  TSIMD_INLINE pack<T, W> fma(const pack<T, W> &p1,
+                              const pack<T, W> &p2,
+                              const OTHER_T &v)
+  {
+    return fma(p1, p2, pack<T, W>(v));
+  }
+
+  template <typename T,
+            int W,
+            typename OTHER_T,
+            typename = traits::can_convert<OTHER_T, T>>
+  TSIMD_INLINE pack<T, W> fma(const pack<T, W> &p1,
+                              const OTHER_T &v,
+                              const pack<T, W> &p3)
+  {
+    return fma(p1, pack<T, W>(v), p3);
+  }
+
+  template <typename T,
+            int W,
+            typename OTHER_T,
+            typename OTHER_T2,
+            typename = traits::can_convert<OTHER_T, T>,
+            typename = traits::can_convert<OTHER_T2, T>>
+  TSIMD_INLINE pack<T, W> fma(const pack<T, W> &p1,
+                              const OTHER_T &v1,
+                              const OTHER_T2 &v2)
+  {
+    return fma(p1, pack<T, W>(v1), pack<T, W>(v2));
+  }
+
+  template <typename T,
+            int W,
+            typename OTHER_T,
+            typename = traits::can_convert<OTHER_T, T>>
+  TSIMD_INLINE pack<T, W> fms(const pack<T, W> &p1,
+                              const pack<T, W> &p2,
+                              const OTHER_T &v)
+  {
+    return fms(p1, p2, pack<T, W>(v));
+  }
+
+  template <typename T,
+            int W,
+            typename OTHER_T,
+            typename = traits::can_convert<OTHER_T, T>>
+  TSIMD_INLINE pack<T, W> fms(const pack<T, W> &p1,
+                              const OTHER_T &v,
+                              const pack<T, W> &p3)
+  {
+    return fms(p1, pack<T, W>(v), p3);
+  }
+
+  template <typename T,
+            int W,
+            typename OTHER_T,
+            typename OTHER_T2,
+            typename = traits::can_convert<OTHER_T, T>,
+            typename = traits::can_convert<OTHER_T2, T>>
+  TSIMD_INLINE pack<T, W> fms(const pack<T, W> &p1,
+                              const OTHER_T &v1,
+                              const OTHER_T2 &v2)
+  {
+    return fms(p1, pack<T, W>(v1), pack<T, W>(v2));
+  }
+
+  template <typename T,
+            int W,
+            typename OTHER_T,
+            typename = traits::can_convert<OTHER_T, T>>
+  TSIMD_INLINE pack<T, W> fnma(const pack<T, W> &p1,
+                               const pack<T, W> &p2,
+                               const OTHER_T &v)
+  {
+    return fnma(p1, p2, pack<T, W>(v));
+  }
+
+  template <typename T,
+            int W,
+            typename OTHER_T,
+            typename = traits::can_convert<OTHER_T, T>>
+  TSIMD_INLINE pack<T, W> fnma(const pack<T, W> &p1,
+                               const OTHER_T &v,
+                               const pack<T, W> &p3)
+  {
+    return fnma(p1, pack<T, W>(v), p3);
+  }
+
+  template <typename T,
+            int W,
+            typename OTHER_T,
+            typename OTHER_T2,
+            typename = traits::can_convert<OTHER_T, T>,
+            typename = traits::can_convert<OTHER_T2, T>>
+  TSIMD_INLINE pack<T, W> fnma(const pack<T, W> &p1,
+                               const OTHER_T &v1,
+                               const OTHER_T2 &v2)
+  {
+    return fnma(p1, pack<T, W>(v1), pack<T, W>(v2));
+  }
+
+  template <typename T,
+            int W,
+            typename OTHER_T,
+            typename = traits::can_convert<OTHER_T, T>>
+  TSIMD_INLINE pack<T, W> fnms(const pack<T, W> &p1,
+                               const pack<T, W> &p2,
+                               const OTHER_T &v)
+  {
+    return fnms(p1, p2, pack<T, W>(v));
+  }
+
+  template <typename T,
+            int W,
+            typename OTHER_T,
+            typename = traits::can_convert<OTHER_T, T>>
+  TSIMD_INLINE pack<T, W> fnms(const pack<T, W> &p1,
+                               const OTHER_T &v,
+                               const pack<T, W> &p3)
+  {
+    return fnms(p1, pack<T, W>(v), p3);
+  }
+
+  template <typename T,
+            int W,
+            typename OTHER_T,
+            typename OTHER_T2,
+            typename = traits::can_convert<OTHER_T, T>,
+            typename = traits::can_convert<OTHER_T2, T>>
+  TSIMD_INLINE pack<T, W> fnms(const pack<T, W> &p1,
+                               const OTHER_T &v1,
+                               const OTHER_T2 &v2)
+  {
+    return fnms(p1, pack<T, W>(v1), pack<T, W>(v2));
+  }
+
+TSIMD_NAMESPACE_END  // namespace tsimd
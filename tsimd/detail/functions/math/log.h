@@ -30,7 +30,9 @@
 
 #include "../algorithm/select.h"
 
-namespace tsimd {
+#include "fma.h"
+
+TSIMD_NAMESPACE_BEGIN
 
   template <typename T, int W>
   TSIMD_INLINE pack<T, W> log(const pack<T, W> &p)
@@ -150,21 +152,20 @@ namespace tsimd {
     const auto c8 = -2.4899270534515380859375;
     const auto c9 = +1.7491014003753662109375;
 
-    auto result = x1 * c9 + c8;
-    result = x1 * result + c7;
-    result = x1 * result + c6;
-    result = x1 * result + c5;
-    result = x1 * result + c4;
-    result = x1 * result + c3;
-    result = x1 * result + c2;
-    result = x1 * result + c1;
-    result = x1 * result + one;
+    auto result = fma(x1, c9, c8);
+    result = fma(x1, result, c7);
+    result = fma(x1, result, c6);
+    result = fma(x1, result, c5);
+    result = fma(x1, result, c4);
+    result = fma(x1, result, c3);
+    result = fma(x1, result, c2);
+    result = fma(x1, result, c1);
+    result = fma(x1, result, one);
 
     // Equation was for -(ln(red)/(1-red))
-    result *= -x1;
-    result += vfloatn<W>(exponent) * ln2;
+    result = fnma(result, x1, vfloatn<W>(exponent) * ln2);
 
     return select(exceptional, select(use_nan, NaN, neg_inf), result);
   }
 
-}  // namespace tsimd
\ No newline at end of file
+TSIMD_NAMESPACE_END  // namespace tsimd
\ No newline at end of file
@@ -28,7 +28,10 @@
 
 #include "../../pack.h"
 
-namespace tsimd {
+#include "../../operators/logic/less_than.h"
+#include "../algorithm/select.h"
+
+TSIMD_NAMESPACE_BEGIN
 
   // 1-wide //
 
@@ -44,6 +47,10 @@ namespace tsimd {
   {
 #if defined(__SSE__)
     return _mm_min_ps(p1, p2);
+#elif TSIMD_VECTOR_EXTENSIONS
+    const auto a = detail::vext(p1);
+    const auto b = detail::vext(p2);
+    return detail::from_vext<vfloat4>(b < a ? b : a);
 #else
     vfloat4 result;
 
@@ -58,6 +65,10 @@ namespace tsimd {
   {
 #if defined(__SSE__)
     return _mm_min_epi32(p1, p2);
+#elif TSIMD_VECTOR_EXTENSIONS
+    const auto a = detail::vext(p1);
+    const auto b = detail::vext(p2);
+    return detail::from_vext<vint4>(b < a ? b : a);
 #else
     vint4 result;
 
@@ -70,22 +81,85 @@ namespace tsimd {
 
   TSIMD_INLINE vdouble4 min(const vdouble4 &p1, const vdouble4 &p2)
   {
+#if defined(__AVX__)
+    return _mm256_min_pd(p1, p2);
+#elif TSIMD_VECTOR_EXTENSIONS
+    const auto a = detail::vext(p1);
+    const auto b = detail::vext(p2);
+    return detail::from_vext<vdouble4>(b < a ? b : a);
+#else
     vdouble4 result;
 
     for (int i = 0; i < 4; ++i)
       result[i] = std::min(p1[i], p2[i]);
 
     return result;
+#endif
   }
 
   TSIMD_INLINE vllong4 min(const vllong4 &p1, const vllong4 &p2)
   {
+#if defined(__AVX512VL__)
+    return _mm256_min_epi64(p1, p2);
+#elif defined(__AVX2__)
+    return _mm256_blendv_epi8(p2, p1, _mm256_cmpgt_epi64(p2, p1));
+#elif defined(__AVX__)
+    return vllong4(
+        _mm_blendv_epi8(p2.vl, p1.vl, _mm_cmpgt_epi64(p2.vl, p1.vl)),
+        _mm_blendv_epi8(p2.vh, p1.vh, _mm_cmpgt_epi64(p2.vh, p1.vh)));
+#elif TSIMD_VECTOR_EXTENSIONS
+    const auto a = detail::vext(p1);
+    const auto b = detail::vext(p2);
+    return detail::from_vext<vllong4>(b < a ? b : a);
+#else
     vllong4 result;
 
     for (int i = 0; i < 4; ++i)
       result[i] = std::min(p1[i], p2[i]);
 
     return result;
+#endif
+  }
+
+  TSIMD_INLINE vuint4 min(const vuint4 &p1, const vuint4 &p2)
+  {
+#if defined(__SSE4_1__)
+    return _mm_min_epu32(p1, p2);
+#elif TSIMD_VECTOR_EXTENSIONS
+    const auto a = detail::vext(p1);
+    const auto b = detail::vext(p2);
+    return detail::from_vext<vuint4>(b < a ? b : a);
+#else
+    vuint4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = std::min(p1[i], p2[i]);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vullong4 min(const vullong4 &p1, const vullong4 &p2)
+  {
+#if defined(__AVX512VL__)
+    return _mm256_min_epu64(p1, p2);
+#elif defined(__AVX2__)
+    const __m256i sign = _mm256_set1_epi64x((long long)0x8000000000000000ULL);
+    const __m256i p2_gt_p1 = _mm256_cmpgt_epi64(_mm256_xor_si256(p2, sign),
+                                                _mm256_xor_si256(p1, sign));
+    return _mm256_blendv_epi8(p2, p1, p2_gt_p1);
+#elif TSIMD_VECTOR_EXTENSIONS
+    const auto a = detail::vext(p1);
+    const auto b = detail::vext(p2);
+    return detail::from_vext<vullong4>(b < a ? b : a);
+#else
+    vullong4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = std::min(p1[i], p2[i]);
+
+    return result;
+#endif
   }
 
   // 8-wide //
@@ -114,14 +188,42 @@ namespace tsimd {
 
   TSIMD_INLINE vdouble8 min(const vdouble8 &p1, const vdouble8 &p2)
   {
+#if defined(__AVX512F__)
+    return _mm512_min_pd(p1, p2);
+#else
     return vdouble8(min(vdouble4(p1.vl), vdouble4(p2.vl)),
                     min(vdouble4(p1.vh), vdouble4(p2.vh)));
+#endif
   }
 
   TSIMD_INLINE vllong8 min(const vllong8 &p1, const vllong8 &p2)
   {
+#if defined(__AVX512F__)
+    return _mm512_min_epi64(p1, p2);
+#else
     return vllong8(min(vllong4(p1.vl), vllong4(p2.vl)),
                    min(vllong4(p1.vh), vllong4(p2.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vuint8 min(const vuint8 &p1, const vuint8 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_min_epu32(p1, p2);
+#else
+    return vuint8(min(vuint4(p1.vl), vuint4(p2.vl)),
+                  min(vuint4(p1.vh), vuint4(p2.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vullong8 min(const vullong8 &p1, const vullong8 &p2)
+  {
+#if defined(__AVX512F__)
+    return _mm512_min_epu64(p1, p2);
+#else
+    return vullong8(min(vullong4(p1.vl), vullong4(p2.vl)),
+                    min(vullong4(p1.vh), vullong4(p2.vh)));
+#endif
   }
 
   // 16-wide //
@@ -158,4 +260,187 @@ namespace tsimd {
                     min(vllong8(p1.vh), vllong8(p2.vh)));
   }
 
-}  // namespace tsimd
\ No newline at end of file
+  TSIMD_INLINE vuint16 min(const vuint16 &p1, const vuint16 &p2)
+  {
+#if defined(__AVX512F__)
+    return _mm512_min_epu32(p1, p2);
+#else
+    return vuint16(min(vuint8(p1.vl), vuint8(p2.vl)),
+                   min(vuint8(p1.vh), vuint8(p2.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vullong16 min(const vullong16 &p1, const vullong16 &p2)
+  {
+    return vullong16(min(vullong8(p1.vl), vullong8(p2.vl)),
+                     min(vullong8(p1.vh), vullong8(p2.vh)));
+  }
+
+  // 8/16-bit //
+
+  TSIMD_INLINE vschar16 min(const vschar16 &p1, const vschar16 &p2)
+  {
+#if defined(__SSE4_1__)
+    return _mm_min_epi8(p1, p2);
+#elif defined(__SSE__)
+    return select(p1 < p2, p1, p2);
+#elif TSIMD_VECTOR_EXTENSIONS
+    const auto a = detail::vext(p1);
+    const auto b = detail::vext(p2);
+    return detail::from_vext<vschar16>(b < a ? b : a);
+#else
+    vschar16 result;
+
+    for (int i = 0; i < 16; ++i)
+      result[i] = std::min(p1[i], p2[i]);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vuchar16 min(const vuchar16 &p1, const vuchar16 &p2)
+  {
+#if defined(__SSE__)
+    return _mm_min_epu8(p1, p2);
+#elif TSIMD_VECTOR_EXTENSIONS
+    const auto a = detail::vext(p1);
+    const auto b = detail::vext(p2);
+    return detail::from_vext<vuchar16>(b < a ? b : a);
+#else
+    vuchar16 result;
+
+    for (int i = 0; i < 16; ++i)
+      result[i] = std::min(p1[i], p2[i]);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vshort8 min(const vshort8 &p1, const vshort8 &p2)
+  {
+#if defined(__SSE__)
+    return _mm_min_epi16(p1, p2);
+#elif TSIMD_VECTOR_EXTENSIONS
+    const auto a = detail::vext(p1);
+    const auto b = detail::vext(p2);
+    return detail::from_vext<vshort8>(b < a ? b : a);
+#else
+    vshort8 result;
+
+    for (int i = 0; i < 8; ++i)
+      result[i] = std::min(p1[i], p2[i]);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vushort8 min(const vushort8 &p1, const vushort8 &p2)
+  {
+#if defined(__SSE4_1__)
+    return _mm_min_epu16(p1, p2);
+#elif defined(__SSE__)
+    return _mm_sub_epi16(p1, _mm_subs_epu16(p1, p2));
+#elif TSIMD_VECTOR_EXTENSIONS
+    const auto a = detail::vext(p1);
+    const auto b = detail::vext(p2);
+    return detail::from_vext<vushort8>(b < a ? b : a);
+#else
+    vushort8 result;
+
+    for (int i = 0; i < 8; ++i)
+      result[i] = std::min(p1[i], p2[i]);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vschar32 min(const vschar32 &p1, const vschar32 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_min_epi8(p1, p2);
+#else
+    return vschar32(min(vschar16(p1.vl), vschar16(p2.vl)),
+                    min(vschar16(p1.vh), vschar16(p2.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vuchar32 min(const vuchar32 &p1, const vuchar32 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_min_epu8(p1, p2);
+#else
+    return vuchar32(min(vuchar16(p1.vl), vuchar16(p2.vl)),
+                    min(vuchar16(p1.vh), vuchar16(p2.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vshort16 min(const vshort16 &p1, const vshort16 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_min_epi16(p1, p2);
+#else
+    return vshort16(min(vshort8(p1.vl), vshort8(p2.vl)),
+                    min(vshort8(p1.vh), vshort8(p2.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vushort16 min(const vushort16 &p1, const vushort16 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_min_epu16(p1, p2);
+#else
+    return vushort16(min(vushort8(p1.vl), vushort8(p2.vl)),
+                     min(vushort8(p1.vh), vushort8(p2.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vschar64 min(const vschar64 &p1, const vschar64 &p2)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_min_epi8(p1, p2);
+#else
+    return vschar64(min(vschar32(p1.vl), vschar32(p2.vl)),
+                    min(vschar32(p1.vh), vschar32(p2.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vuchar64 min(const vuchar64 &p1, const vuchar64 &p2)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_min_epu8(p1, p2);
+#else
+    return vuchar64(min(vuchar32(p1.vl), vuchar32(p2.vl)),
+                    min(vuchar32(p1.vh), vuchar32(p2.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vshort32 min(const vshort32 &p1, const vshort32 &p2)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_min_epi16(p1, p2);
+#else
+    return vshort32(min(vshort16(p1.vl), vshort16(p2.vl)),
+                    min(vshort16(p1.vh), vshort16(p2.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vushort32 min(const vushort32 &p1, const vushort32 &p2)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_min_epu16(p1, p2);
+#else
+    return vushort32(min(vushort16(p1.vl), vushort16(p2.vl)),
+                     min(vushort16(p1.vh), vushort16(p2.vh)));
+#endif
+  }
+
+
+  // wide //
+
+  template <typename T, int W, typename = traits::is_wide_pack_t<T, W>>
+  TSIMD_INLINE pack<T, W> min(const pack<T, W> &p1, const pack<T, W> &p2)
+  {
+    return pack<T, W>(min(p1.vl, p2.vl), min(p1.vh, p2.vh));
+  }
+
+TSIMD_NAMESPACE_END  // namespace tsimd
\ No newline at end of file
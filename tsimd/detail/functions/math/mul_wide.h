@@ -0,0 +1,119 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Intel Corporation                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+#pragma once
+
+#include "../../pack.h"
+
+TSIMD_NAMESPACE_BEGIN
+
+  // mul_wide() -- full product of 32-bit lanes as 64-bit lanes ///////////////
+
+  template <typename T, int W>
+  TSIMD_INLINE pack<typename traits::wide_type_for<T>::type, W> mul_wide(
+      const pack<T, W> &p1, const pack<T, W> &p2)
+  {
+    using WIDE_T = typename traits::wide_type_for<T>::type;
+    pack<WIDE_T, W> result;
+
+#if TSIMD_USE_OPENMP
+#  pragma omp simd
+#endif
+    for (int i = 0; i < W; ++i)
+      result[i] = WIDE_T(p1[i]) * WIDE_T(p2[i]);
+
+    return result;
+  }
+
+  // 4-wide //
+
+  TSIMD_INLINE vllong4 mul_wide(const vint4 &p1, const vint4 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_mul_epi32(_mm256_cvtepi32_epi64(p1),
+                            _mm256_cvtepi32_epi64(p2));
+#else
+    vllong4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = (long long)p1[i] * p2[i];
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vullong4 mul_wide(const vuint4 &p1, const vuint4 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_mul_epu32(_mm256_cvtepu32_epi64(p1),
+                            _mm256_cvtepu32_epi64(p2));
+#else
+    vullong4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = (unsigned long long)p1[i] * p2[i];
+
+    return result;
+#endif
+  }
+
+  // 8-wide //
+
+  TSIMD_INLINE vllong8 mul_wide(const vint8 &p1, const vint8 &p2)
+  {
+#if defined(__AVX512F__)
+    return _mm512_mul_epi32(_mm512_cvtepi32_epi64(p1),
+                            _mm512_cvtepi32_epi64(p2));
+#else
+    return vllong8(mul_wide(vint4(p1.vl), vint4(p2.vl)),
+                   mul_wide(vint4(p1.vh), vint4(p2.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vullong8 mul_wide(const vuint8 &p1, const vuint8 &p2)
+  {
+#if defined(__AVX512F__)
+    return _mm512_mul_epu32(_mm512_cvtepu32_epi64(p1),
+                            _mm512_cvtepu32_epi64(p2));
+#else
+    return vullong8(mul_wide(vuint4(p1.vl), vuint4(p2.vl)),
+                    mul_wide(vuint4(p1.vh), vuint4(p2.vh)));
+#endif
+  }
+
+  // 16-wide //
+
+  TSIMD_INLINE vllong16 mul_wide(const vint16 &p1, const vint16 &p2)
+  {
+    return vllong16(mul_wide(vint8(p1.vl), vint8(p2.vl)),
+                    mul_wide(vint8(p1.vh), vint8(p2.vh)));
+  }
+
+  TSIMD_INLINE vullong16 mul_wide(const vuint16 &p1, const vuint16 &p2)
+  {
+    return vullong16(mul_wide(vuint8(p1.vl), vuint8(p2.vl)),
+                     mul_wide(vuint8(p1.vh), vuint8(p2.vh)));
+  }
+
+TSIMD_NAMESPACE_END  // namespace tsimd
\ No newline at end of file
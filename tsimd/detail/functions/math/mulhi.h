@@ -0,0 +1,103 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Intel Corporation                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+#pragma once
+
+#include "../../pack.h"
+
+TSIMD_NAMESPACE_BEGIN
+
+  // mulhi() -- upper 16 bits of the 16-bit lane products /////////////////////
+
+  // 16-bit //
+
+  TSIMD_INLINE vshort8 mulhi(const vshort8 &p1, const vshort8 &p2)
+  {
+#if defined(__SSE__)
+    return _mm_mulhi_epi16(p1, p2);
+#else
+    vshort8 result;
+
+    for (int i = 0; i < 8; ++i)
+      result[i] = (int(p1[i]) * p2[i]) >> 16;
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vushort8 mulhi(const vushort8 &p1, const vushort8 &p2)
+  {
+#if defined(__SSE__)
+    return _mm_mulhi_epu16(p1, p2);
+#else
+    vushort8 result;
+
+    for (int i = 0; i < 8; ++i)
+      result[i] = (static_cast<unsigned int>(p1[i]) * p2[i]) >> 16;
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vshort16 mulhi(const vshort16 &p1, const vshort16 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_mulhi_epi16(p1, p2);
+#else
+    return vshort16(mulhi(vshort8(p1.vl), vshort8(p2.vl)),
+                    mulhi(vshort8(p1.vh), vshort8(p2.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vushort16 mulhi(const vushort16 &p1, const vushort16 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_mulhi_epu16(p1, p2);
+#else
+    return vushort16(mulhi(vushort8(p1.vl), vushort8(p2.vl)),
+                     mulhi(vushort8(p1.vh), vushort8(p2.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vshort32 mulhi(const vshort32 &p1, const vshort32 &p2)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_mulhi_epi16(p1, p2);
+#else
+    return vshort32(mulhi(vshort16(p1.vl), vshort16(p2.vl)),
+                    mulhi(vshort16(p1.vh), vshort16(p2.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vushort32 mulhi(const vushort32 &p1, const vushort32 &p2)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_mulhi_epu16(p1, p2);
+#else
+    return vushort32(mulhi(vushort16(p1.vl), vushort16(p2.vl)),
+                     mulhi(vushort16(p1.vh), vushort16(p2.vh)));
+#endif
+  }
+
+TSIMD_NAMESPACE_END  // namespace tsimd
\ No newline at end of file
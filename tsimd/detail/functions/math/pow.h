@@ -29,7 +29,7 @@
 #include "exp.h"
 #include "log.h"
 
-namespace tsimd {
+TSIMD_NAMESPACE_BEGIN
 
   template <typename T, int W, typename = traits::is_floating_point_t<T>>
   TSIMD_INLINE pack<T, W> pow(const pack<T, W> &v, const float b)
@@ -37,4 +37,4 @@ namespace tsimd {
     return exp(b * log(v));
   }
 
-}  // namespace tsimd
\ No newline at end of file
+TSIMD_NAMESPACE_END  // namespace tsimd
\ No newline at end of file
@@ -28,7 +28,7 @@
 
 #include "../../pack.h"
 
-namespace tsimd {
+TSIMD_NAMESPACE_BEGIN
 
   // 1-wide //
 
@@ -56,12 +56,16 @@ namespace tsimd {
 
   TSIMD_INLINE vdouble4 sqrt(const vdouble4 &p)
   {
+#if defined(__AVX__)
+    return _mm256_sqrt_pd(p);
+#else
     vdouble4 result;
 
     for (int i = 0; i < 4; ++i)
       result[i] = std::sqrt(p[i]);
 
     return result;
+#endif
   }
 
   // 8-wide //
@@ -77,7 +81,11 @@ namespace tsimd {
 
   TSIMD_INLINE vdouble8 sqrt(const vdouble8 &p)
   {
+#if defined(__AVX512F__)
+    return _mm512_sqrt_pd(p);
+#else
     return vdouble8(sqrt(vdouble4(p.vl)), sqrt(vdouble4(p.vh)));
+#endif
   }
 
   // 16-wide //
@@ -96,4 +104,13 @@ namespace tsimd {
     return vdouble16(sqrt(vdouble8(p.vl)), sqrt(vdouble8(p.vh)));
   }
 
-}  // namespace tsimd
\ No newline at end of file
+
+  // wide //
+
+  template <typename T, int W, typename = traits::is_wide_pack_t<T, W>>
+  TSIMD_INLINE pack<T, W> sqrt(const pack<T, W> &p)
+  {
+    return pack<T, W>(sqrt(p.vl), sqrt(p.vh));
+  }
+
+TSIMD_NAMESPACE_END  // namespace tsimd
\ No newline at end of file
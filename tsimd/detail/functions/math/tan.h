@@ -32,9 +32,10 @@
 #include "../algorithm/set_if.h"
 
 #include "cos.h"
+#include "fma.h"
 #include "sin.h"
 
-namespace tsimd {
+TSIMD_NAMESPACE_BEGIN
 
   template <typename T, int W>
   TSIMD_INLINE pack<T, W> tan(const pack<T, W> &p)
@@ -63,7 +64,7 @@ namespace tsimd {
     const auto kReal = floor(scaled);
     const auto k = vintn<W>(kReal);
 
-    auto x = y - kReal * piOverFourVec;
+    auto x = fnma(kReal, piOverFourVec, y);
 
     // If k & 1, x -= Pi/4
     const auto needOffset = (k & 1) != 0;
@@ -93,12 +94,12 @@ namespace tsimd {
 
     vfloatn<W> z;
     if (any(useCotan)) {
-      auto cotVal = x2 * cotC12 + cotC10;
-      cotVal = x2 * cotVal + cotC8;
-      cotVal = x2 * cotVal + cotC6;
-      cotVal = x2 * cotVal + cotC4;
-      cotVal = x2 * cotVal + cotC2;
-      cotVal = x2 * cotVal + oneVec;
+      auto cotVal = fma(x2, cotC12, cotC10);
+      cotVal = fma(x2, cotVal, cotC8);
+      cotVal = fma(x2, cotVal, cotC6);
+      cotVal = fma(x2, cotVal, cotC4);
+      cotVal = fma(x2, cotVal, cotC2);
+      cotVal = fma(x2, cotVal, oneVec);
       // The equation is for x * cot(x) but we need -x * cot(x) for the tan part
       cotVal /= -x;
       z = cotVal;
@@ -106,12 +107,12 @@ namespace tsimd {
 
     const auto useTan = vboolfn<W>(!useCotan);
     if (any(useTan)) {
-      auto tanVal = x2 * tanC12 + tanC10;
-      tanVal = x2 * tanVal + tanC8;
-      tanVal = x2 * tanVal + tanC6;
-      tanVal = x2 * tanVal + tanC4;
-      tanVal = x2 * tanVal + tanC2;
-      tanVal = x2 * tanVal + oneVec;
+      auto tanVal = fma(x2, tanC12, tanC10);
+      tanVal = fma(x2, tanVal, tanC8);
+      tanVal = fma(x2, tanVal, tanC6);
+      tanVal = fma(x2, tanVal, tanC4);
+      tanVal = fma(x2, tanVal, tanC2);
+      tanVal = fma(x2, tanVal, oneVec);
       // Equation was for tan(x)/x
       tanVal *= x;
       set_if(z, tanVal, useTan);
@@ -120,4 +121,4 @@ namespace tsimd {
     return select(xLt0, -z, z);
   }
 
-}  // namespace tsimd
\ No newline at end of file
+TSIMD_NAMESPACE_END  // namespace tsimd
\ No newline at end of file
@@ -24,8 +24,12 @@
 
 #pragma once
 
+#include "memory/aos.h"
 #include "memory/gather.h"
 #include "memory/load.h"
+#include "memory/prefetch.h"
 #include "memory/scatter.h"
+#include "memory/scatter_add.h"
 #include "memory/store.h"
+#include "memory/stream.h"
 #include "memory/reverse_bits.h"
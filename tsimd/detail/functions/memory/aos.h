@@ -0,0 +1,328 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Intel Corporation                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+#pragma once
+
+#include <type_traits>
+
+#include "../../pack.h"
+#include "../shuffle/transpose.h"
+
+TSIMD_NAMESPACE_BEGIN
+
+  namespace detail {
+
+    // NOTE: records are loaded in groups of four, each group filling one
+    //       128-bit block of every register: block 'l' of register 'j' holds
+    //       floats [4 * (N * l + j), 4 * (N * l + j) + 4) of the input, so
+    //       that an in-lane shuffle network can (de)interleave the groups
+
+#if defined(__SSE__)
+    template <int N>
+    TSIMD_INLINE void load_blocks(const float *src, __m128 (&r)[N])
+    {
+      for (int j = 0; j < N; ++j)
+        r[j] = _mm_loadu_ps(src + 4 * j);
+    }
+
+    template <int N>
+    TSIMD_INLINE void store_blocks(float *dst, const __m128 (&r)[N])
+    {
+      for (int j = 0; j < N; ++j)
+        _mm_storeu_ps(dst + 4 * j, r[j]);
+    }
+#endif
+
+#if defined(__AVX__)
+    template <int N>
+    TSIMD_INLINE void load_blocks(const float *src, __m256 (&r)[N])
+    {
+      for (int j = 0; j < N; ++j) {
+        r[j] = _mm256_insertf128_ps(
+            _mm256_castps128_ps256(_mm_loadu_ps(src + 4 * j)),
+            _mm_loadu_ps(src + 4 * (N + j)),
+            1);
+      }
+    }
+
+    template <int N>
+    TSIMD_INLINE void store_blocks(float *dst, const __m256 (&r)[N])
+    {
+      for (int j = 0; j < N; ++j) {
+        _mm_storeu_ps(dst + 4 * j, _mm256_castps256_ps128(r[j]));
+        _mm_storeu_ps(dst + 4 * (N + j), _mm256_extractf128_ps(r[j], 1));
+      }
+    }
+#endif
+
+#if defined(__AVX512F__)
+    template <int N>
+    TSIMD_INLINE void load_blocks(const float *src, __m512 (&r)[N])
+    {
+      for (int j = 0; j < N; ++j) {
+        __m512 v = _mm512_castps128_ps512(_mm_loadu_ps(src + 4 * j));
+        v = _mm512_insertf32x4(v, _mm_loadu_ps(src + 4 * (N + j)), 1);
+        v = _mm512_insertf32x4(v, _mm_loadu_ps(src + 4 * (2 * N + j)), 2);
+        v = _mm512_insertf32x4(v, _mm_loadu_ps(src + 4 * (3 * N + j)), 3);
+        r[j] = v;
+      }
+    }
+
+    template <int N>
+    TSIMD_INLINE void store_blocks(float *dst, const __m512 (&r)[N])
+    {
+      for (int j = 0; j < N; ++j) {
+        _mm_storeu_ps(dst + 4 * j, _mm512_castps512_ps128(r[j]));
+        _mm_storeu_ps(dst + 4 * (N + j), _mm512_extractf32x4_ps(r[j], 1));
+        _mm_storeu_ps(dst + 4 * (2 * N + j), _mm512_extractf32x4_ps(r[j], 2));
+        _mm_storeu_ps(dst + 4 * (3 * N + j), _mm512_extractf32x4_ps(r[j], 3));
+      }
+    }
+#endif
+
+    // NOTE: per 128-bit block, {x0 y0 z0 x1} {y1 z1 x2 y2} {z2 x3 y3 z3}
+    //       <-> {x0 x1 x2 x3} {y0 y1 y2 y3} {z0 z1 z2 z3}, 4-component
+    //       records are a plain 4x4 transpose
+
+#if defined(__SSE__)
+    template <typename R>
+    TSIMD_INLINE void deinterleave_in_lanes(R (&r)[3])
+    {
+      const R a = r[0];
+      const R b = r[1];
+      const R c = r[2];
+
+      const R xt = shuffle_ps_lanes<_MM_SHUFFLE(0, 1, 0, 2)>(b, c);
+      const R yt = shuffle_ps_lanes<_MM_SHUFFLE(0, 0, 1, 1)>(a, b);
+      const R yu = shuffle_ps_lanes<_MM_SHUFFLE(2, 2, 3, 3)>(b, c);
+      const R zt = shuffle_ps_lanes<_MM_SHUFFLE(1, 1, 2, 2)>(a, b);
+
+      r[0] = shuffle_ps_lanes<_MM_SHUFFLE(2, 0, 3, 0)>(a, xt);
+      r[1] = shuffle_ps_lanes<_MM_SHUFFLE(2, 0, 2, 0)>(yt, yu);
+      r[2] = shuffle_ps_lanes<_MM_SHUFFLE(3, 0, 2, 0)>(zt, c);
+    }
+
+    template <typename R>
+    TSIMD_INLINE void interleave_in_lanes(R (&r)[3])
+    {
+      const R x = r[0];
+      const R y = r[1];
+      const R z = r[2];
+
+      const R at = shuffle_ps_lanes<_MM_SHUFFLE(0, 0, 0, 0)>(x, y);
+      const R au = shuffle_ps_lanes<_MM_SHUFFLE(1, 1, 0, 0)>(z, x);
+      const R bt = shuffle_ps_lanes<_MM_SHUFFLE(1, 1, 1, 1)>(y, z);
+      const R bu = shuffle_ps_lanes<_MM_SHUFFLE(2, 2, 2, 2)>(x, y);
+      const R ct = shuffle_ps_lanes<_MM_SHUFFLE(3, 3, 2, 2)>(z, x);
+      const R cu = shuffle_ps_lanes<_MM_SHUFFLE(3, 3, 3, 3)>(y, z);
+
+      r[0] = shuffle_ps_lanes<_MM_SHUFFLE(2, 0, 2, 0)>(at, au);
+      r[1] = shuffle_ps_lanes<_MM_SHUFFLE(2, 0, 2, 0)>(bt, bu);
+      r[2] = shuffle_ps_lanes<_MM_SHUFFLE(2, 0, 2, 0)>(ct, cu);
+    }
+
+    template <typename R>
+    TSIMD_INLINE void deinterleave_in_lanes(R (&r)[4])
+    {
+      transpose4_in_lanes(r[0], r[1], r[2], r[3]);
+    }
+
+    template <typename R>
+    TSIMD_INLINE void interleave_in_lanes(R (&r)[4])
+    {
+      transpose4_in_lanes(r[0], r[1], r[2], r[3]);
+    }
+#endif
+
+    // load_aos_rows()/store_aos_rows() ///////////////////////////////////////
+
+    enum class aos_path
+    {
+      lanes,   // scalar loop over the records
+      blocks,  // in-lane shuffle network on groups of four records
+      halves   // the halves take the first and last W/2 records
+    };
+
+    template <aos_path PATH>
+    using aos_path_t = std::integral_constant<aos_path, PATH>;
+
+    template <typename T, int W, int N>
+    struct aos_path_for
+    {
+      static constexpr bool has_blocks =
+          sizeof(T) == 4 && (N == 3 || N == 4) &&
+          (
+#if defined(__SSE__)
+              W == 4 ||
+#endif
+#if defined(__AVX__)
+              W == 8 ||
+#endif
+#if defined(__AVX512F__)
+              W == 16 ||
+#endif
+              false);
+
+      static constexpr aos_path value =
+          has_blocks ? aos_path::blocks
+                     : (W >= 8 ? aos_path::halves : aos_path::lanes);
+    };
+
+    template <int N, typename T, int W>
+    TSIMD_INLINE void load_aos_rows(const T *src,
+                                    pack<T, W> (&out)[N],
+                                    aos_path_t<aos_path::lanes>)
+    {
+      for (int i = 0; i < W; ++i)
+        for (int c = 0; c < N; ++c)
+          out[c][i] = src[i * N + c];
+    }
+
+    template <int N, typename T, int W>
+    TSIMD_INLINE void store_aos_rows(T *dst,
+                                     const pack<T, W> (&in)[N],
+                                     aos_path_t<aos_path::lanes>)
+    {
+      for (int i = 0; i < W; ++i)
+        for (int c = 0; c < N; ++c)
+          dst[i * N + c] = in[c][i];
+    }
+
+    template <int N, typename T, int W>
+    TSIMD_INLINE void load_aos_rows(const T *src,
+                                    pack<T, W> (&out)[N],
+                                    aos_path_t<aos_path::blocks>)
+    {
+      using R = typename vfloatn<W>::intrinsic_t;
+
+      R r[N];
+      load_blocks(reinterpret_cast<const float *>(src), r);
+      deinterleave_in_lanes(r);
+
+      for (int c = 0; c < N; ++c)
+        out[c] = reinterpret_elements_as<T>(vfloatn<W>(r[c]));
+    }
+
+    template <int N, typename T, int W>
+    TSIMD_INLINE void store_aos_rows(T *dst,
+                                     const pack<T, W> (&in)[N],
+                                     aos_path_t<aos_path::blocks>)
+    {
+      using R = typename vfloatn<W>::intrinsic_t;
+
+      R r[N];
+
+      for (int c = 0; c < N; ++c)
+        r[c] = reinterpret_elements_as<float>(in[c]).v;
+
+      interleave_in_lanes(r);
+      store_blocks(reinterpret_cast<float *>(dst), r);
+    }
+
+    template <int N, typename T, int W>
+    TSIMD_INLINE void load_aos_rows(const T *src,
+                                    pack<T, W> (&out)[N],
+                                    aos_path_t<aos_path::halves>);
+
+    template <int N, typename T, int W>
+    TSIMD_INLINE void store_aos_rows(T *dst,
+                                     const pack<T, W> (&in)[N],
+                                     aos_path_t<aos_path::halves>);
+
+    template <int N, typename T, int W>
+    TSIMD_INLINE void load_aos_rows(const T *src, pack<T, W> (&out)[N])
+    {
+      load_aos_rows(src, out, aos_path_t<aos_path_for<T, W, N>::value>());
+    }
+
+    template <int N, typename T, int W>
+    TSIMD_INLINE void store_aos_rows(T *dst, const pack<T, W> (&in)[N])
+    {
+      store_aos_rows(dst, in, aos_path_t<aos_path_for<T, W, N>::value>());
+    }
+
+    template <int N, typename T, int W>
+    TSIMD_INLINE void load_aos_rows(const T *src,
+                                    pack<T, W> (&out)[N],
+                                    aos_path_t<aos_path::halves>)
+    {
+      constexpr int H = W / 2;
+
+      pack<T, H> lo[N], hi[N];
+      load_aos_rows(src, lo);
+      load_aos_rows(src + N * H, hi);
+
+      for (int c = 0; c < N; ++c)
+        out[c] = pack<T, W>(lo[c], hi[c]);
+    }
+
+    template <int N, typename T, int W>
+    TSIMD_INLINE void store_aos_rows(T *dst,
+                                     const pack<T, W> (&in)[N],
+                                     aos_path_t<aos_path::halves>)
+    {
+      constexpr int H = W / 2;
+      using half_t    = pack<T, H>;
+
+      half_t lo[N], hi[N];
+
+      for (int c = 0; c < N; ++c) {
+        lo[c] = half_t(in[c].vl);
+        hi[c] = half_t(in[c].vh);
+      }
+
+      store_aos_rows(dst, lo);
+      store_aos_rows(dst + N * H, hi);
+    }
+
+  }  // namespace detail
+
+  // load_aos() ///////////////////////////////////////////////////////////////
+
+  // NOTE: reads W consecutive records of N components each from 'src' (no
+  //       alignment needed), component 'c' of record 'i' ends up in lane 'i'
+  //       of out[c]
+
+  template <int N, typename T, int W>
+  TSIMD_INLINE void load_aos(const T *src, pack<T, W> (&out)[N])
+  {
+    static_assert(!traits::is_bool<T>::value,
+                  "tsimd::load_aos() can only be used with non-bool packs");
+    detail::load_aos_rows(src, out);
+  }
+
+  // store_aos() //////////////////////////////////////////////////////////////
+
+  // NOTE: the inverse of load_aos(), lane 'i' of in[c] is written to
+  //       component 'c' of record 'i' at 'dst'
+
+  template <int N, typename T, int W>
+  TSIMD_INLINE void store_aos(T *dst, const pack<T, W> (&in)[N])
+  {
+    static_assert(!traits::is_bool<T>::value,
+                  "tsimd::store_aos() can only be used with non-bool packs");
+    detail::store_aos_rows(dst, in);
+  }
+
+TSIMD_NAMESPACE_END  // namespace tsimd
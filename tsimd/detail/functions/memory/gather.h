@@ -24,43 +24,452 @@
 
 #pragma once
 
+#include <type_traits>
+
 #include "../../pack.h"
+#include "../shuffle/permute.h"
 
-namespace tsimd {
+TSIMD_NAMESPACE_BEGIN
 
-  template <typename PACK_T, typename OFFSET_T>
-  TSIMD_INLINE PACK_T gather(void *_src,
-                             const pack<OFFSET_T, PACK_T::static_size> &o)
-  {
-    auto *src = (const typename PACK_T::value_t *)_src;
-    PACK_T result;
+  namespace detail {
+
+    // NOTE: element 'i' is read from (or written to) the byte address
+    //       'base + o[i] * SCALE', which is what the hardware instructions
+    //       encode directly
+
+    template <int SCALE>
+    using scale_t = std::integral_constant<int, SCALE>;
+
+    template <int SCALE>
+    struct is_valid_scale
+    {
+      static constexpr bool value =
+          SCALE == 1 || SCALE == 2 || SCALE == 4 || SCALE == 8;
+    };
+
+    // NOTE: the hardware only moves 32/64-bit integer lanes with signed
+    //       offsets, so elements are viewed as their same-sized signed
+    //       integer. 64-bit unsigned offsets are reinterpreted (addresses
+    //       can't exceed the signed range anyway), but unsigned 32-bit
+    //       offsets would be sign extended and stay on the per-lane path.
+
+    template <typename OFFSET_T>
+    struct gather_offset_type
+    {
+      using type = typename std::conditional<
+          sizeof(OFFSET_T) == 8 && std::is_integral<OFFSET_T>::value,
+          long long,
+          OFFSET_T>::type;
+    };
+
+    template <typename OFFSET_T, int W>
+    TSIMD_INLINE pack<typename gather_offset_type<OFFSET_T>::type, W>
+    as_gather_offsets(const pack<OFFSET_T, W> &o)
+    {
+      return reinterpret_elements_as<
+          typename gather_offset_type<OFFSET_T>::type>(o);
+    }
+
+    template <typename T, int W>
+    using gather_in_halves =
+        std::integral_constant<bool, (W >= 8 && sizeof(T) >= 4)>;
+
+    template <typename T>
+    TSIMD_INLINE const T *gather_address(const void *base,
+                                         long long offset,
+                                         int scale)
+    {
+      return (const T *)((const char *)base + offset * scale);
+    }
+
+    // Native gathers /////////////////////////////////////////////////////////
+
+    // 4-wide //
+
+#if defined(__AVX2__)
+    template <int SCALE>
+    TSIMD_INLINE void gather_into(vint4 &r,
+                                  const void *base,
+                                  const vint4 &o,
+                                  scale_t<SCALE>)
+    {
+      r = _mm_i32gather_epi32((const int *)base, o, SCALE);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE void gather_into(vint4 &r,
+                                  const void *base,
+                                  const vint4 &o,
+                                  const vboolf4 &m,
+                                  scale_t<SCALE>)
+    {
+#  if defined(__AVX512VL__)
+      r = _mm_mmask_i32gather_epi32(_mm_setzero_si128(), m, o, base, SCALE);
+#  else
+      r = _mm_mask_i32gather_epi32(
+          _mm_setzero_si128(), (const int *)base, o, _mm_castps_si128(m), SCALE);
+#  endif
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE void gather_into(vint4 &r,
+                                  const void *base,
+                                  const vllong4 &o,
+                                  scale_t<SCALE>)
+    {
+      r = _mm256_i64gather_epi32((const int *)base, o, SCALE);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE void gather_into(vint4 &r,
+                                  const void *base,
+                                  const vllong4 &o,
+                                  const vboolf4 &m,
+                                  scale_t<SCALE>)
+    {
+#  if defined(__AVX512VL__)
+      r = _mm256_mmask_i64gather_epi32(_mm_setzero_si128(), m, o, base, SCALE);
+#  else
+      r = _mm256_mask_i64gather_epi32(
+          _mm_setzero_si128(), (const int *)base, o, _mm_castps_si128(m), SCALE);
+#  endif
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE void gather_into(vllong4 &r,
+                                  const void *base,
+                                  const vint4 &o,
+                                  scale_t<SCALE>)
+    {
+      r = _mm256_i32gather_epi64((const long long *)base, o, SCALE);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE void gather_into(vllong4 &r,
+                                  const void *base,
+                                  const vint4 &o,
+                                  const vboold4 &m,
+                                  scale_t<SCALE>)
+    {
+#  if defined(__AVX512VL__)
+      r = _mm256_mmask_i32gather_epi64(
+          _mm256_setzero_si256(), m, o, base, SCALE);
+#  else
+      r = _mm256_mask_i32gather_epi64(_mm256_setzero_si256(),
+                                      (const long long *)base,
+                                      o,
+                                      _mm256_castpd_si256(m),
+                                      SCALE);
+#  endif
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE void gather_into(vllong4 &r,
+                                  const void *base,
+                                  const vllong4 &o,
+                                  scale_t<SCALE>)
+    {
+      r = _mm256_i64gather_epi64((const long long *)base, o, SCALE);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE void gather_into(vllong4 &r,
+                                  const void *base,
+                                  const vllong4 &o,
+                                  const vboold4 &m,
+                                  scale_t<SCALE>)
+    {
+#  if defined(__AVX512VL__)
+      r = _mm256_mmask_i64gather_epi64(
+          _mm256_setzero_si256(), m, o, base, SCALE);
+#  else
+      r = _mm256_mask_i64gather_epi64(_mm256_setzero_si256(),
+                                      (const long long *)base,
+                                      o,
+                                      _mm256_castpd_si256(m),
+                                      SCALE);
+#  endif
+    }
+
+    // 8-wide //
+
+    template <int SCALE>
+    TSIMD_INLINE void gather_into(vint8 &r,
+                                  const void *base,
+                                  const vint8 &o,
+                                  scale_t<SCALE>)
+    {
+      r = _mm256_i32gather_epi32((const int *)base, o, SCALE);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE void gather_into(vint8 &r,
+                                  const void *base,
+                                  const vint8 &o,
+                                  const vboolf8 &m,
+                                  scale_t<SCALE>)
+    {
+#  if defined(__AVX512VL__)
+      r = _mm256_mmask_i32gather_epi32(
+          _mm256_setzero_si256(), m, o, base, SCALE);
+#  else
+      r = _mm256_mask_i32gather_epi32(_mm256_setzero_si256(),
+                                      (const int *)base,
+                                      o,
+                                      _mm256_castps_si256(m),
+                                      SCALE);
+#  endif
+    }
+#endif
+
+#if defined(__AVX512F__)
+    template <int SCALE>
+    TSIMD_INLINE void gather_into(vint8 &r,
+                                  const void *base,
+                                  const vllong8 &o,
+                                  scale_t<SCALE>)
+    {
+      r = _mm512_i64gather_epi32(o, base, SCALE);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE void gather_into(vllong8 &r,
+                                  const void *base,
+                                  const vint8 &o,
+                                  scale_t<SCALE>)
+    {
+      r = _mm512_i32gather_epi64(o, base, SCALE);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE void gather_into(vllong8 &r,
+                                  const void *base,
+                                  const vint8 &o,
+                                  const vboold8 &m,
+                                  scale_t<SCALE>)
+    {
+      r = _mm512_mask_i32gather_epi64(_mm512_setzero_si512(), m, o, base, SCALE);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE void gather_into(vllong8 &r,
+                                  const void *base,
+                                  const vllong8 &o,
+                                  scale_t<SCALE>)
+    {
+      r = _mm512_i64gather_epi64(o, base, SCALE);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE void gather_into(vllong8 &r,
+                                  const void *base,
+                                  const vllong8 &o,
+                                  const vboold8 &m,
+                                  scale_t<SCALE>)
+    {
+      r = _mm512_mask_i64gather_epi64(_mm512_setzero_si512(), m, o, base, SCALE);
+    }
+
+    // 16-wide //
+
+    template <int SCALE>
+    TSIMD_INLINE void gather_into(vint16 &r,
+                                  const void *base,
+                                  const vint16 &o,
+                                  scale_t<SCALE>)
+    {
+      r = _mm512_i32gather_epi32(o, base, SCALE);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE void gather_into(vint16 &r,
+                                  const void *base,
+                                  const vint16 &o,
+                                  const vboolf16 &m,
+                                  scale_t<SCALE>)
+    {
+      r = _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), m, o, base, SCALE);
+    }
+#endif
+
+#if defined(__AVX512VL__)
+    // NOTE: 8-wide 32-bit masks are only kmasks with AVX512VL
+    template <int SCALE>
+    TSIMD_INLINE void gather_into(vint8 &r,
+                                  const void *base,
+                                  const vllong8 &o,
+                                  const vboolf8 &m,
+                                  scale_t<SCALE>)
+    {
+      r = _mm512_mask_i64gather_epi32(_mm256_setzero_si256(), m, o, base, SCALE);
+    }
+#endif
+
+    // Generic gathers ////////////////////////////////////////////////////////
 
+    template <typename T, int W, typename OFFSET_T, int SCALE>
+    TSIMD_INLINE void gather_into(pack<T, W> &r,
+                                  const void *base,
+                                  const pack<OFFSET_T, W> &o,
+                                  scale_t<SCALE>,
+                                  std::false_type /*in_halves*/)
+    {
 #if TSIMD_USE_OPENMP
 #  pragma omp simd
 #endif
-    for (int i = 0; i < PACK_T::static_size; ++i)
-      result[i] = src[o[i]];
+      for (int i = 0; i < W; ++i)
+        r[i] = *gather_address<T>(base, o[i], SCALE);
+    }
 
-    return result;
+    template <typename T, int W, typename OFFSET_T, int SCALE>
+    TSIMD_INLINE void gather_into(pack<T, W> &r,
+                                  const void *base,
+                                  const pack<OFFSET_T, W> &o,
+                                  const mask<T, W> &m,
+                                  scale_t<SCALE>,
+                                  std::false_type /*in_halves*/)
+    {
+      // NOTE: inactive lanes are zeroed and their addresses never touched
+#if TSIMD_USE_OPENMP
+#  pragma omp simd
+#endif
+      for (int i = 0; i < W; ++i)
+        r[i] = m[i] ? *gather_address<T>(base, o[i], SCALE) : T(0);
+    }
+
+    template <typename T, int W, typename OFFSET_T, int SCALE>
+    TSIMD_INLINE void gather_into(pack<T, W> &r,
+                                  const void *base,
+                                  const pack<OFFSET_T, W> &o,
+                                  scale_t<SCALE>,
+                                  std::true_type /*in_halves*/);
+
+    template <typename T, int W, typename OFFSET_T, int SCALE>
+    TSIMD_INLINE void gather_into(pack<T, W> &r,
+                                  const void *base,
+                                  const pack<OFFSET_T, W> &o,
+                                  const mask<T, W> &m,
+                                  scale_t<SCALE>,
+                                  std::true_type /*in_halves*/);
+
+    template <typename T, int W, typename OFFSET_T, int SCALE>
+    TSIMD_INLINE void gather_into(pack<T, W> &r,
+                                  const void *base,
+                                  const pack<OFFSET_T, W> &o,
+                                  scale_t<SCALE> s)
+    {
+      gather_into(r, base, o, s, gather_in_halves<T, W>());
+    }
+
+    template <typename T, int W, typename OFFSET_T, int SCALE>
+    TSIMD_INLINE void gather_into(pack<T, W> &r,
+                                  const void *base,
+                                  const pack<OFFSET_T, W> &o,
+                                  const mask<T, W> &m,
+                                  scale_t<SCALE> s)
+    {
+      gather_into(r, base, o, m, s, gather_in_halves<T, W>());
+    }
+
+    // NOTE: packs without a native gather of their own width split in two,
+    //       which reaches the native gathers of the narrower registers
+
+    template <typename T, int W, typename OFFSET_T, int SCALE>
+    TSIMD_INLINE void gather_into(pack<T, W> &r,
+                                  const void *base,
+                                  const pack<OFFSET_T, W> &o,
+                                  scale_t<SCALE> s,
+                                  std::true_type /*in_halves*/)
+    {
+      using HALF_T = pack<T, W / 2>;
+      using HALF_O = pack<OFFSET_T, W / 2>;
+
+      HALF_T lo, hi;
+      gather_into(lo, base, HALF_O(o.vl), s);
+      gather_into(hi, base, HALF_O(o.vh), s);
+      r = pack<T, W>(lo, hi);
+    }
+
+    template <typename T, int W, typename OFFSET_T, int SCALE>
+    TSIMD_INLINE void gather_into(pack<T, W> &r,
+                                  const void *base,
+                                  const pack<OFFSET_T, W> &o,
+                                  const mask<T, W> &m,
+                                  scale_t<SCALE> s,
+                                  std::true_type /*in_halves*/)
+    {
+      using HALF_T = pack<T, W / 2>;
+      using HALF_O = pack<OFFSET_T, W / 2>;
+      using HALF_M = mask<T, W / 2>;
+
+      HALF_T lo, hi;
+      gather_into(lo, base, HALF_O(o.vl), HALF_M(m.vl), s);
+      gather_into(hi, base, HALF_O(o.vh), HALF_M(m.vh), s);
+      r = pack<T, W>(lo, hi);
+    }
+
+  }  // namespace detail
+
+  // gather() /////////////////////////////////////////////////////////////////
+
+  // NOTE: 'SCALE' is the byte distance between consecutive offsets (1, 2, 4
+  //       or 8), which lets offsets index into arrays of structures
+
+  template <typename PACK_T, int SCALE, typename OFFSET_T>
+  TSIMD_INLINE PACK_T gather(const void *_src,
+                             const pack<OFFSET_T, PACK_T::static_size> &o)
+  {
+    static_assert(detail::is_valid_scale<SCALE>::value,
+                  "gather<>() scale must be 1, 2, 4 or 8!");
+
+    using T = typename PACK_T::value_t;
+    using ELEMENT_T = typename detail::lane_index_type<T>::type;
+
+    pack<ELEMENT_T, PACK_T::static_size> result;
+    detail::gather_into(result,
+                        _src,
+                        detail::as_gather_offsets(o),
+                        detail::scale_t<SCALE>());
+    return reinterpret_elements_as<T>(result);
   }
 
-  template <typename PACK_T, typename OFFSET_T>
+  template <typename PACK_T, int SCALE, typename OFFSET_T>
   TSIMD_INLINE PACK_T
-  gather(void *_src,
+  gather(const void *_src,
          const pack<OFFSET_T, PACK_T::static_size> &o,
          const mask<typename PACK_T::value_t, PACK_T::static_size> &m)
   {
-    auto *src = (const typename PACK_T::value_t *)_src;
-    PACK_T result;
+    static_assert(detail::is_valid_scale<SCALE>::value,
+                  "gather<>() scale must be 1, 2, 4 or 8!");
 
-#if TSIMD_USE_OPENMP
-#  pragma omp simd
-#endif
-    for (int i = 0; i < PACK_T::static_size; ++i)
-      if (m[i])
-        result[i] = src[o[i]];
+    using T = typename PACK_T::value_t;
+    using ELEMENT_T = typename detail::lane_index_type<T>::type;
+
+    pack<ELEMENT_T, PACK_T::static_size> result;
+    detail::gather_into(result,
+                        _src,
+                        detail::as_gather_offsets(o),
+                        m,
+                        detail::scale_t<SCALE>());
+    return reinterpret_elements_as<T>(result);
+  }
+
+  // NOTE: without a scale, offsets count elements of the gathered type
+
+  template <typename PACK_T, typename OFFSET_T>
+  TSIMD_INLINE PACK_T gather(const void *_src,
+                             const pack<OFFSET_T, PACK_T::static_size> &o)
+  {
+    return gather<PACK_T, sizeof(typename PACK_T::value_t)>(_src, o);
+  }
 
-    return result;
+  template <typename PACK_T, typename OFFSET_T>
+  TSIMD_INLINE PACK_T
+  gather(const void *_src,
+         const pack<OFFSET_T, PACK_T::static_size> &o,
+         const mask<typename PACK_T::value_t, PACK_T::static_size> &m)
+  {
+    return gather<PACK_T, sizeof(typename PACK_T::value_t)>(_src, o, m);
   }
 
-}  // namespace tsimd
+TSIMD_NAMESPACE_END  // namespace tsimd
@@ -24,19 +24,46 @@
 
 #pragma once
 
+#include <cstring>
+#include <type_traits>
+
 #include "../../pack.h"
 
-namespace tsimd {
+TSIMD_NAMESPACE_BEGIN
 
   // load() ///////////////////////////////////////////////////////////////////
 
+  // NOTE: only wide packs use the primary templates, which split the load
+  //       over their two halves
+
   template <typename PACK_T>
-  TSIMD_INLINE PACK_T load(const void *_src);
+  TSIMD_INLINE PACK_T load(const void *_src)
+  {
+    using T      = typename PACK_T::value_t;
+    using HALF_T = pack<T, PACK_T::static_size / 2>;
+
+    static_assert(traits::is_wide_pack<T, PACK_T::static_size>::value,
+                  "load<>() isn't implemented for this pack type!");
+
+    auto *src = (const T *)_src;
+    return PACK_T(load<HALF_T>(src), load<HALF_T>(src + HALF_T::static_size));
+  }
 
   template <typename PACK_T>
   TSIMD_INLINE PACK_T
   load(const void *_src,
-       const mask<typename PACK_T::value_t, PACK_T::static_size> &m);
+       const mask<typename PACK_T::value_t, PACK_T::static_size> &m)
+  {
+    using T      = typename PACK_T::value_t;
+    using HALF_T = pack<T, PACK_T::static_size / 2>;
+
+    static_assert(traits::is_wide_pack<T, PACK_T::static_size>::value,
+                  "load<>() isn't implemented for this pack type!");
+
+    auto *src = (const T *)_src;
+    return PACK_T(load<HALF_T>(src, m.vl),
+                  load<HALF_T>(src + HALF_T::static_size, m.vh));
+  }
 
   // 1-wide //
 
@@ -105,6 +132,30 @@ namespace tsimd {
     return detail::load1<vllong1>(_src, m);
   }
 
+  template <>
+  TSIMD_INLINE vuint1 load(const void *_src)
+  {
+    return detail::load1<vuint1>(_src);
+  }
+
+  template <>
+  TSIMD_INLINE vuint1 load(const void *_src, const vboolf1 &m)
+  {
+    return detail::load1<vuint1>(_src, m);
+  }
+
+  template <>
+  TSIMD_INLINE vullong1 load(const void *_src)
+  {
+    return detail::load1<vullong1>(_src);
+  }
+
+  template <>
+  TSIMD_INLINE vullong1 load(const void *_src, const vboold1 &m)
+  {
+    return detail::load1<vullong1>(_src, m);
+  }
+
   // 4-wide //
 
   template <>
@@ -126,7 +177,11 @@ namespace tsimd {
   template <>
   TSIMD_INLINE vfloat4 load(const void *_src, const vboolf4 &mask)
   {
-#if defined(__SSE__)
+#if defined(__AVX512VL__)
+    return _mm_mask_load_ps(_mm_setzero_ps(), mask, (const float *)_src);
+#elif defined(__AVX__)
+    return _mm_maskload_ps((const float *)_src, _mm_castps_si128(mask));
+#elif defined(__SSE__) && TSIMD_MASKED_MEMORY_RMW
     return _mm_and_ps(_mm_load_ps((const float *)_src), mask);
 #else
     auto *src = (const typename vfloat4::value_t *)_src;
@@ -159,7 +214,14 @@ namespace tsimd {
   template <>
   TSIMD_INLINE vint4 load(const void *_src, const vboolf4 &mask)
   {
-#if defined(__SSE__)
+#if defined(__AVX512VL__)
+    return _mm_mask_load_epi32(_mm_setzero_si128(), mask, _src);
+#elif defined(__AVX2__)
+    return _mm_maskload_epi32((const int *)_src, mask);
+#elif defined(__AVX__)
+    return _mm_castps_si128(
+        _mm_maskload_ps((const float *)_src, _mm_castps_si128(mask)));
+#elif defined(__SSE__) && TSIMD_MASKED_MEMORY_RMW
     return _mm_and_si128(_mm_load_si128((const __m128i *)_src), mask);
 #else
     auto *src = (const typename vint4::value_t *)_src;
@@ -176,6 +238,9 @@ namespace tsimd {
   template <>
   TSIMD_INLINE vdouble4 load(const void *_src)
   {
+#if defined(__AVX__)
+    return _mm256_load_pd((const double *)_src);
+#else
     auto *src = (const typename vdouble4::value_t *)_src;
     vdouble4 result;
 
@@ -183,11 +248,18 @@ namespace tsimd {
       result[i] = src[i];
 
     return result;
+#endif
   }
 
   template <>
   TSIMD_INLINE vdouble4 load(const void *_src, const vboold4 &mask)
   {
+#if defined(__AVX512VL__)
+    return _mm256_mask_load_pd(
+        _mm256_setzero_pd(), mask, (const double *)_src);
+#elif defined(__AVX__)
+    return _mm256_maskload_pd((const double *)_src, _mm256_castpd_si256(mask));
+#else
     auto *src = (const typename vdouble4::value_t *)_src;
     vdouble4 result;
 
@@ -196,11 +268,15 @@ namespace tsimd {
         result[i] = src[i];
 
     return result;
+#endif
   }
 
   template <>
   TSIMD_INLINE vllong4 load(const void *_src)
   {
+#if defined(__AVX__)
+    return _mm256_load_si256((const __m256i *)_src);
+#else
     auto *src = (const typename vllong4::value_t *)_src;
     vllong4 result;
 
@@ -208,11 +284,21 @@ namespace tsimd {
       result[i] = src[i];
 
     return result;
+#endif
   }
 
   template <>
   TSIMD_INLINE vllong4 load(const void *_src, const vboold4 &mask)
   {
+#if defined(__AVX512VL__)
+    return _mm256_mask_load_epi64(_mm256_setzero_si256(), mask, _src);
+#elif defined(__AVX2__)
+    return _mm256_maskload_epi64((const long long *)_src,
+                                 _mm256_castpd_si256(mask));
+#elif defined(__AVX__)
+    return _mm256_castpd_si256(
+        _mm256_maskload_pd((const double *)_src, _mm256_castpd_si256(mask)));
+#else
     auto *src = (const typename vllong4::value_t *)_src;
     vllong4 result;
 
@@ -221,6 +307,31 @@ namespace tsimd {
         result[i] = src[i];
 
     return result;
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vuint4 load(const void *_src)
+  {
+    return detail::as_unsigned(load<vint4>(_src));
+  }
+
+  template <>
+  TSIMD_INLINE vuint4 load(const void *_src, const vboolf4 &mask)
+  {
+    return detail::as_unsigned(load<vint4>(_src, mask));
+  }
+
+  template <>
+  TSIMD_INLINE vullong4 load(const void *_src)
+  {
+    return detail::as_unsigned(load<vllong4>(_src));
+  }
+
+  template <>
+  TSIMD_INLINE vullong4 load(const void *_src, const vboold4 &mask)
+  {
+    return detail::as_unsigned(load<vllong4>(_src, mask));
   }
 
   // 8-wide //
@@ -239,8 +350,8 @@ namespace tsimd {
   template <>
   TSIMD_INLINE vfloat8 load(const void *_src, const vboolf8 &mask)
   {
-#if 0  // defined(__AVX512__)
-    return _mm256_mask_load_ps(_mm256_setzero_ps(), mask, (float*)_src);
+#if defined(__AVX512VL__)
+    return _mm256_mask_load_ps(_mm256_setzero_ps(), mask, (const float *)_src);
 #elif defined(__AVX__)
     return _mm256_maskload_ps((const float *)_src, _mm256_castps_si256(mask));
 #else
@@ -264,8 +375,8 @@ namespace tsimd {
   template <>
   TSIMD_INLINE vint8 load(const void *_src, const vboolf8 &mask)
   {
-#if 0  // defined(__AVX512__)
-    return _mm256_castps_si256(_mm256_maskload_ps((float*)_src, mask));
+#if defined(__AVX512VL__)
+    return _mm256_mask_load_epi32(_mm256_setzero_si256(), mask, _src);
 #elif defined(__AVX__)
     return _mm256_castps_si256(
         _mm256_maskload_ps((const float *)_src, _mm256_castps_si256(mask)));
@@ -279,31 +390,72 @@ namespace tsimd {
   template <>
   TSIMD_INLINE vdouble8 load(const void *_src)
   {
+#if defined(__AVX512F__)
+    return _mm512_load_pd((const double *)_src);
+#else
     auto *src = (const typename vdouble8::value_t *)_src;
     return vdouble8(load<vdouble4>(src), load<vdouble4>(src + 4));
+#endif
   }
 
   template <>
   TSIMD_INLINE vdouble8 load(const void *_src, const vboold8 &mask)
   {
+#if defined(__AVX512F__)
+    return _mm512_mask_load_pd(
+        _mm512_setzero_pd(), mask, (const double *)_src);
+#else
     auto *src = (const typename vdouble16::value_t *)_src;
     return vdouble8(load<vdouble4>(src, vboold4(mask.vl)),
                     load<vdouble4>(src + 4, vboold4(mask.vh)));
+#endif
   }
 
   template <>
   TSIMD_INLINE vllong8 load(const void *_src)
   {
+#if defined(__AVX512F__)
+    return _mm512_load_si512(_src);
+#else
     auto *src = (const typename vllong16::value_t *)_src;
     return vllong8(load<vllong4>(src), load<vllong4>(src + 4));
+#endif
   }
 
   template <>
   TSIMD_INLINE vllong8 load(const void *_src, const vboold8 &mask)
   {
+#if defined(__AVX512F__)
+    return _mm512_mask_load_epi64(_mm512_setzero_si512(), mask, _src);
+#else
     auto *src = (const typename vllong16::value_t *)_src;
     return vllong8(load<vllong4>(src, vboold4(mask.vl)),
                   load<vllong4>(src + 4, vboold4(mask.vh)));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vuint8 load(const void *_src)
+  {
+    return detail::as_unsigned(load<vint8>(_src));
+  }
+
+  template <>
+  TSIMD_INLINE vuint8 load(const void *_src, const vboolf8 &mask)
+  {
+    return detail::as_unsigned(load<vint8>(_src, mask));
+  }
+
+  template <>
+  TSIMD_INLINE vullong8 load(const void *_src)
+  {
+    return detail::as_unsigned(load<vllong8>(_src));
+  }
+
+  template <>
+  TSIMD_INLINE vullong8 load(const void *_src, const vboold8 &mask)
+  {
+    return detail::as_unsigned(load<vllong8>(_src, mask));
   }
 
   // 16-wide //
@@ -384,4 +536,392 @@ namespace tsimd {
                     load<vllong8>(src + 8, vboold8(mask.vh)));
   }
 
-}  // namespace tsimd
\ No newline at end of file
+  template <>
+  TSIMD_INLINE vuint16 load(const void *_src)
+  {
+    return detail::as_unsigned(load<vint16>(_src));
+  }
+
+  template <>
+  TSIMD_INLINE vuint16 load(const void *_src, const vboolf16 &mask)
+  {
+    return detail::as_unsigned(load<vint16>(_src, mask));
+  }
+
+  template <>
+  TSIMD_INLINE vullong16 load(const void *_src)
+  {
+    return detail::as_unsigned(load<vllong16>(_src));
+  }
+
+  template <>
+  TSIMD_INLINE vullong16 load(const void *_src, const vboold16 &mask)
+  {
+    return detail::as_unsigned(load<vllong16>(_src, mask));
+  }
+
+  // 8/16-bit //
+
+  template <>
+  TSIMD_INLINE vschar16 load(const void *_src)
+  {
+#if defined(__SSE__)
+    return _mm_load_si128((const __m128i *)_src);
+#else
+    auto *src = (const typename vschar16::value_t *)_src;
+    vschar16 result;
+
+    for (int i = 0; i < 16; ++i)
+      result[i] = src[i];
+
+    return result;
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vschar16 load(const void *_src, const vboolc16 &mask)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    return _mm_mask_loadu_epi8(_mm_setzero_si128(), mask, _src);
+#elif defined(__SSE__) && TSIMD_MASKED_MEMORY_RMW
+    return _mm_and_si128(load<vschar16>(_src), mask);
+#else
+    auto *src = (const typename vschar16::value_t *)_src;
+    vschar16 result;
+
+    for (int i = 0; i < 16; ++i)
+      if (mask[i])
+        result[i] = src[i];
+
+    return result;
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vuchar16 load(const void *_src)
+  {
+    return detail::as_unsigned(load<vschar16>(_src));
+  }
+
+  template <>
+  TSIMD_INLINE vuchar16 load(const void *_src, const vboolc16 &mask)
+  {
+    return detail::as_unsigned(load<vschar16>(_src, mask));
+  }
+
+  template <>
+  TSIMD_INLINE vshort8 load(const void *_src)
+  {
+#if defined(__SSE__)
+    return _mm_load_si128((const __m128i *)_src);
+#else
+    auto *src = (const typename vshort8::value_t *)_src;
+    vshort8 result;
+
+    for (int i = 0; i < 8; ++i)
+      result[i] = src[i];
+
+    return result;
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vshort8 load(const void *_src, const vbools8 &mask)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    return _mm_mask_loadu_epi16(_mm_setzero_si128(), mask, _src);
+#elif defined(__SSE__) && TSIMD_MASKED_MEMORY_RMW
+    return _mm_and_si128(load<vshort8>(_src), mask);
+#else
+    auto *src = (const typename vshort8::value_t *)_src;
+    vshort8 result;
+
+    for (int i = 0; i < 8; ++i)
+      if (mask[i])
+        result[i] = src[i];
+
+    return result;
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vushort8 load(const void *_src)
+  {
+    return detail::as_unsigned(load<vshort8>(_src));
+  }
+
+  template <>
+  TSIMD_INLINE vushort8 load(const void *_src, const vbools8 &mask)
+  {
+    return detail::as_unsigned(load<vshort8>(_src, mask));
+  }
+
+  template <>
+  TSIMD_INLINE vschar32 load(const void *_src)
+  {
+#if defined(__AVX__)
+    return _mm256_load_si256((const __m256i *)_src);
+#else
+    auto *src = (const typename vschar32::value_t *)_src;
+    return vschar32(load<vschar16>(src), load<vschar16>(src + 16));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vschar32 load(const void *_src, const vboolc32 &mask)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    return _mm256_mask_loadu_epi8(_mm256_setzero_si256(), mask, _src);
+#elif defined(__AVX2__) && TSIMD_MASKED_MEMORY_RMW
+    return _mm256_and_si256(load<vschar32>(_src), mask);
+#else
+    auto *src = (const typename vschar32::value_t *)_src;
+    return vschar32(load<vschar16>(src, vboolc16(mask.vl)),
+                    load<vschar16>(src + 16, vboolc16(mask.vh)));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vuchar32 load(const void *_src)
+  {
+    return detail::as_unsigned(load<vschar32>(_src));
+  }
+
+  template <>
+  TSIMD_INLINE vuchar32 load(const void *_src, const vboolc32 &mask)
+  {
+    return detail::as_unsigned(load<vschar32>(_src, mask));
+  }
+
+  template <>
+  TSIMD_INLINE vshort16 load(const void *_src)
+  {
+#if defined(__AVX__)
+    return _mm256_load_si256((const __m256i *)_src);
+#else
+    auto *src = (const typename vshort16::value_t *)_src;
+    return vshort16(load<vshort8>(src), load<vshort8>(src + 8));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vshort16 load(const void *_src, const vbools16 &mask)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    return _mm256_mask_loadu_epi16(_mm256_setzero_si256(), mask, _src);
+#elif defined(__AVX2__) && TSIMD_MASKED_MEMORY_RMW
+    return _mm256_and_si256(load<vshort16>(_src), mask);
+#else
+    auto *src = (const typename vshort16::value_t *)_src;
+    return vshort16(load<vshort8>(src, vbools8(mask.vl)),
+                    load<vshort8>(src + 8, vbools8(mask.vh)));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vushort16 load(const void *_src)
+  {
+    return detail::as_unsigned(load<vshort16>(_src));
+  }
+
+  template <>
+  TSIMD_INLINE vushort16 load(const void *_src, const vbools16 &mask)
+  {
+    return detail::as_unsigned(load<vshort16>(_src, mask));
+  }
+
+  template <>
+  TSIMD_INLINE vschar64 load(const void *_src)
+  {
+#if defined(__AVX512F__)
+    return _mm512_load_si512(_src);
+#else
+    auto *src = (const typename vschar64::value_t *)_src;
+    return vschar64(load<vschar32>(src), load<vschar32>(src + 32));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vschar64 load(const void *_src, const vboolc64 &mask)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_mask_loadu_epi8(_mm512_setzero_si512(), mask, _src);
+#else
+    auto *src = (const typename vschar64::value_t *)_src;
+    return vschar64(load<vschar32>(src, vboolc32(mask.vl)),
+                    load<vschar32>(src + 32, vboolc32(mask.vh)));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vuchar64 load(const void *_src)
+  {
+    return detail::as_unsigned(load<vschar64>(_src));
+  }
+
+  template <>
+  TSIMD_INLINE vuchar64 load(const void *_src, const vboolc64 &mask)
+  {
+    return detail::as_unsigned(load<vschar64>(_src, mask));
+  }
+
+  template <>
+  TSIMD_INLINE vshort32 load(const void *_src)
+  {
+#if defined(__AVX512F__)
+    return _mm512_load_si512(_src);
+#else
+    auto *src = (const typename vshort32::value_t *)_src;
+    return vshort32(load<vshort16>(src), load<vshort16>(src + 16));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vshort32 load(const void *_src, const vbools32 &mask)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_mask_loadu_epi16(_mm512_setzero_si512(), mask, _src);
+#else
+    auto *src = (const typename vshort32::value_t *)_src;
+    return vshort32(load<vshort16>(src, vbools16(mask.vl)),
+                    load<vshort16>(src + 16, vbools16(mask.vh)));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vushort32 load(const void *_src)
+  {
+    return detail::as_unsigned(load<vshort32>(_src));
+  }
+
+  template <>
+  TSIMD_INLINE vushort32 load(const void *_src, const vbools32 &mask)
+  {
+    return detail::as_unsigned(load<vshort32>(_src, mask));
+  }
+
+  // loadu() //////////////////////////////////////////////////////////////////
+
+  // NOTE: like load(), but 'src' needs no alignment
+
+  namespace detail {
+
+    // NOTE: packs without a native register (scalars, arrays, compiler
+    //       vector types) copy their lanes, which compilers turn into
+    //       unaligned vector loads
+
+    template <typename PACK_T, typename R>
+    TSIMD_INLINE void loadu_register(PACK_T &p, R &, const void *src)
+    {
+      using T = typename PACK_T::value_t;
+      std::memcpy(&p, src, sizeof(T) * PACK_T::static_size);
+    }
+
+#if defined(__SSE__)
+    template <typename PACK_T>
+    TSIMD_INLINE void loadu_register(PACK_T &, __m128 &r, const void *src)
+    {
+      r = _mm_loadu_ps((const float *)src);
+    }
+
+    template <typename PACK_T>
+    TSIMD_INLINE void loadu_register(PACK_T &, __m128i &r, const void *src)
+    {
+      r = _mm_loadu_si128((const __m128i *)src);
+    }
+
+    template <typename PACK_T>
+    TSIMD_INLINE void loadu_register(PACK_T &, __m128d &r, const void *src)
+    {
+      r = _mm_loadu_pd((const double *)src);
+    }
+#endif
+
+#if defined(__AVX__)
+    template <typename PACK_T>
+    TSIMD_INLINE void loadu_register(PACK_T &, __m256 &r, const void *src)
+    {
+      r = _mm256_loadu_ps((const float *)src);
+    }
+
+    template <typename PACK_T>
+    TSIMD_INLINE void loadu_register(PACK_T &, __m256i &r, const void *src)
+    {
+      r = _mm256_loadu_si256((const __m256i *)src);
+    }
+
+    template <typename PACK_T>
+    TSIMD_INLINE void loadu_register(PACK_T &, __m256d &r, const void *src)
+    {
+      r = _mm256_loadu_pd((const double *)src);
+    }
+#endif
+
+#if defined(__AVX512F__)
+    template <typename PACK_T>
+    TSIMD_INLINE void loadu_register(PACK_T &, __m512 &r, const void *src)
+    {
+      r = _mm512_loadu_ps(src);
+    }
+
+    template <typename PACK_T>
+    TSIMD_INLINE void loadu_register(PACK_T &, __m512i &r, const void *src)
+    {
+      r = _mm512_loadu_si512(src);
+    }
+
+    template <typename PACK_T>
+    TSIMD_INLINE void loadu_register(PACK_T &, __m512d &r, const void *src)
+    {
+      r = _mm512_loadu_pd(src);
+    }
+#endif
+
+    // NOTE: wide packs, and packs with registers only for their halves (e.g.
+    //       vint8 on AVX), are loaded/stored half by half
+
+    template <typename T, int W>
+    using memory_in_halves = std::integral_constant<
+        bool,
+        traits::is_wide_pack<T, W>::value ||
+            (W >= 8 && !traits::simd_type_is_native<T, W>::value &&
+             !traits::half_simd_is_array<T, W>::value)>;
+
+    template <typename PACK_T>
+    TSIMD_INLINE PACK_T loadu_pack(const void *src,
+                                   std::false_type /*in_halves*/)
+    {
+      PACK_T p;
+      loadu_register(p, p.v, src);
+      return p;
+    }
+
+    template <typename PACK_T>
+    TSIMD_INLINE PACK_T loadu_pack(const void *src,
+                                   std::true_type /*in_halves*/)
+    {
+      using T      = typename PACK_T::value_t;
+      using HALF_T = pack<T, PACK_T::static_size / 2>;
+      using in_halves = memory_in_halves<T, HALF_T::static_size>;
+
+      auto *s = (const T *)src;
+      return PACK_T(loadu_pack<HALF_T>(s, in_halves()),
+                    loadu_pack<HALF_T>(s + HALF_T::static_size,
+                                       in_halves()));
+    }
+
+  }  // namespace detail
+
+  template <typename PACK_T>
+  TSIMD_INLINE PACK_T loadu(const void *src)
+  {
+    using T = typename PACK_T::value_t;
+
+    static_assert(!traits::is_bool<T>::value,
+                  "loadu<>() can only be used with non-bool packs!");
+
+    using in_halves = detail::memory_in_halves<T, PACK_T::static_size>;
+    return detail::loadu_pack<PACK_T>(src, in_halves());
+  }
+
+TSIMD_NAMESPACE_END  // namespace tsimd
\ No newline at end of file
@@ -0,0 +1,79 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Intel Corporation                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+#pragma once
+
+#include "../../pack.h"
+
+TSIMD_NAMESPACE_BEGIN
+
+  // prefetch() ///////////////////////////////////////////////////////////////
+
+  enum class prefetch_hint
+  {
+    t0,  // into all cache levels
+    t1,  // into L2 and below
+    t2,  // into L3 and below
+    nta  // non-temporal, keeps cache pollution to a minimum
+  };
+
+  template <prefetch_hint HINT = prefetch_hint::t0>
+  TSIMD_INLINE void prefetch(const void *addr)
+  {
+#if defined(__SSE__)
+    switch (HINT) {
+    case prefetch_hint::t0:
+      _mm_prefetch((const char *)addr, _MM_HINT_T0);
+      break;
+    case prefetch_hint::t1:
+      _mm_prefetch((const char *)addr, _MM_HINT_T1);
+      break;
+    case prefetch_hint::t2:
+      _mm_prefetch((const char *)addr, _MM_HINT_T2);
+      break;
+    case prefetch_hint::nta:
+      _mm_prefetch((const char *)addr, _MM_HINT_NTA);
+      break;
+    }
+#elif defined(__GNUC__)
+    switch (HINT) {
+    case prefetch_hint::t0:
+      __builtin_prefetch(addr, 0, 3);
+      break;
+    case prefetch_hint::t1:
+      __builtin_prefetch(addr, 0, 2);
+      break;
+    case prefetch_hint::t2:
+      __builtin_prefetch(addr, 0, 1);
+      break;
+    case prefetch_hint::nta:
+      __builtin_prefetch(addr, 0, 0);
+      break;
+    }
+#else
+    (void)addr;
+#endif
+  }
+
+TSIMD_NAMESPACE_END  // namespace tsimd
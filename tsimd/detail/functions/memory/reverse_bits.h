@@ -28,7 +28,7 @@
 
 #include "../../pack.h"
 
-namespace tsimd {
+TSIMD_NAMESPACE_BEGIN
 
   // 1-wide //
 
@@ -59,7 +59,7 @@ namespace tsimd {
     pack<T, 4> result;
 
     for (int i = 0; i < 4; ++i)
-      result[i] = reverse_bits(p[i]);
+      result[i] = reverse_bits(pack<T, 1>(p[i]))[0];
 
     return result;
 #endif
@@ -102,5 +102,16 @@ namespace tsimd {
     return pack<T, 16>(reverse_bits(pack<T, 8>(p.vl)), reverse_bits(pack<T, 8>(p.vh)));
 #endif
   }
-}
+
+  // wide //
+
+  template<typename T,
+           int W,
+           typename = traits::is_n_bytes_t<T, 4>,
+           typename = traits::is_wide_pack_t<T, W>>
+  TSIMD_INLINE pack<T, W> reverse_bits(const pack<T, W> &p)
+  {
+    return pack<T, W>(reverse_bits(p.vl), reverse_bits(p.vh));
+  }
+TSIMD_NAMESPACE_END
 
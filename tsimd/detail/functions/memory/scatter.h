@@ -24,39 +24,360 @@
 
 #pragma once
 
-#include "../../pack.h"
+#include "gather.h"
 
-namespace tsimd {
+TSIMD_NAMESPACE_BEGIN
 
-  template <typename PACK_T, typename OFFSET_T>
+  namespace detail {
+
+    template <typename T>
+    TSIMD_INLINE T *scatter_address(void *base, long long offset, int scale)
+    {
+      return (T *)((char *)base + offset * scale);
+    }
+
+    // Native scatters ////////////////////////////////////////////////////////
+
+    // NOTE: like the per-lane loop, the hardware writes overlapping lanes in
+    //       order, so the highest active lane wins
+
+#if defined(__AVX512F__)
+    // 8-wide //
+
+    template <int SCALE>
+    TSIMD_INLINE void scatter_from(const vint8 &p,
+                                   void *base,
+                                   const vllong8 &o,
+                                   scale_t<SCALE>)
+    {
+      _mm512_i64scatter_epi32(base, o, p, SCALE);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE void scatter_from(const vllong8 &p,
+                                   void *base,
+                                   const vint8 &o,
+                                   scale_t<SCALE>)
+    {
+      _mm512_i32scatter_epi64(base, o, p, SCALE);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE void scatter_from(const vllong8 &p,
+                                   void *base,
+                                   const vint8 &o,
+                                   const vboold8 &m,
+                                   scale_t<SCALE>)
+    {
+      _mm512_mask_i32scatter_epi64(base, m, o, p, SCALE);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE void scatter_from(const vllong8 &p,
+                                   void *base,
+                                   const vllong8 &o,
+                                   scale_t<SCALE>)
+    {
+      _mm512_i64scatter_epi64(base, o, p, SCALE);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE void scatter_from(const vllong8 &p,
+                                   void *base,
+                                   const vllong8 &o,
+                                   const vboold8 &m,
+                                   scale_t<SCALE>)
+    {
+      _mm512_mask_i64scatter_epi64(base, m, o, p, SCALE);
+    }
+
+    // 16-wide //
+
+    template <int SCALE>
+    TSIMD_INLINE void scatter_from(const vint16 &p,
+                                   void *base,
+                                   const vint16 &o,
+                                   scale_t<SCALE>)
+    {
+      _mm512_i32scatter_epi32(base, o, p, SCALE);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE void scatter_from(const vint16 &p,
+                                   void *base,
+                                   const vint16 &o,
+                                   const vboolf16 &m,
+                                   scale_t<SCALE>)
+    {
+      _mm512_mask_i32scatter_epi32(base, m, o, p, SCALE);
+    }
+#endif
+
+#if defined(__AVX512VL__)
+    // 4-wide //
+
+    template <int SCALE>
+    TSIMD_INLINE void scatter_from(const vint4 &p,
+                                   void *base,
+                                   const vint4 &o,
+                                   scale_t<SCALE>)
+    {
+      _mm_i32scatter_epi32(base, o, p, SCALE);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE void scatter_from(const vint4 &p,
+                                   void *base,
+                                   const vint4 &o,
+                                   const vboolf4 &m,
+                                   scale_t<SCALE>)
+    {
+      _mm_mask_i32scatter_epi32(base, m, o, p, SCALE);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE void scatter_from(const vint4 &p,
+                                   void *base,
+                                   const vllong4 &o,
+                                   scale_t<SCALE>)
+    {
+      _mm256_i64scatter_epi32(base, o, p, SCALE);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE void scatter_from(const vint4 &p,
+                                   void *base,
+                                   const vllong4 &o,
+                                   const vboolf4 &m,
+                                   scale_t<SCALE>)
+    {
+      _mm256_mask_i64scatter_epi32(base, m, o, p, SCALE);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE void scatter_from(const vllong4 &p,
+                                   void *base,
+                                   const vint4 &o,
+                                   scale_t<SCALE>)
+    {
+      _mm256_i32scatter_epi64(base, o, p, SCALE);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE void scatter_from(const vllong4 &p,
+                                   void *base,
+                                   const vint4 &o,
+                                   const vboold4 &m,
+                                   scale_t<SCALE>)
+    {
+      _mm256_mask_i32scatter_epi64(base, m, o, p, SCALE);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE void scatter_from(const vllong4 &p,
+                                   void *base,
+                                   const vllong4 &o,
+                                   scale_t<SCALE>)
+    {
+      _mm256_i64scatter_epi64(base, o, p, SCALE);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE void scatter_from(const vllong4 &p,
+                                   void *base,
+                                   const vllong4 &o,
+                                   const vboold4 &m,
+                                   scale_t<SCALE>)
+    {
+      _mm256_mask_i64scatter_epi64(base, m, o, p, SCALE);
+    }
+
+    // 8-wide //
+
+    template <int SCALE>
+    TSIMD_INLINE void scatter_from(const vint8 &p,
+                                   void *base,
+                                   const vint8 &o,
+                                   scale_t<SCALE>)
+    {
+      _mm256_i32scatter_epi32(base, o, p, SCALE);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE void scatter_from(const vint8 &p,
+                                   void *base,
+                                   const vint8 &o,
+                                   const vboolf8 &m,
+                                   scale_t<SCALE>)
+    {
+      _mm256_mask_i32scatter_epi32(base, m, o, p, SCALE);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE void scatter_from(const vint8 &p,
+                                   void *base,
+                                   const vllong8 &o,
+                                   const vboolf8 &m,
+                                   scale_t<SCALE>)
+    {
+      _mm512_mask_i64scatter_epi32(base, m, o, p, SCALE);
+    }
+#endif
+
+    // Generic scatters ///////////////////////////////////////////////////////
+
+    template <typename T, int W, typename OFFSET_T, int SCALE>
+    TSIMD_INLINE void scatter_from(const pack<T, W> &p,
+                                   void *base,
+                                   const pack<OFFSET_T, W> &o,
+                                   scale_t<SCALE>,
+                                   std::false_type /*in_halves*/)
+    {
+      // NOTE: no 'omp simd' here, overlapping offsets must keep lane order
+      for (int i = 0; i < W; ++i)
+        *scatter_address<T>(base, o[i], SCALE) = p[i];
+    }
+
+    template <typename T, int W, typename OFFSET_T, int SCALE>
+    TSIMD_INLINE void scatter_from(const pack<T, W> &p,
+                                   void *base,
+                                   const pack<OFFSET_T, W> &o,
+                                   const mask<T, W> &m,
+                                   scale_t<SCALE>,
+                                   std::false_type /*in_halves*/)
+    {
+      for (int i = 0; i < W; ++i)
+        if (m[i])
+          *scatter_address<T>(base, o[i], SCALE) = p[i];
+    }
+
+    template <typename T, int W, typename OFFSET_T, int SCALE>
+    TSIMD_INLINE void scatter_from(const pack<T, W> &p,
+                                   void *base,
+                                   const pack<OFFSET_T, W> &o,
+                                   scale_t<SCALE>,
+                                   std::true_type /*in_halves*/);
+
+    template <typename T, int W, typename OFFSET_T, int SCALE>
+    TSIMD_INLINE void scatter_from(const pack<T, W> &p,
+                                   void *base,
+                                   const pack<OFFSET_T, W> &o,
+                                   const mask<T, W> &m,
+                                   scale_t<SCALE>,
+                                   std::true_type /*in_halves*/);
+
+    template <typename T, int W, typename OFFSET_T, int SCALE>
+    TSIMD_INLINE void scatter_from(const pack<T, W> &p,
+                                   void *base,
+                                   const pack<OFFSET_T, W> &o,
+                                   scale_t<SCALE> s)
+    {
+      scatter_from(p, base, o, s, gather_in_halves<T, W>());
+    }
+
+    template <typename T, int W, typename OFFSET_T, int SCALE>
+    TSIMD_INLINE void scatter_from(const pack<T, W> &p,
+                                   void *base,
+                                   const pack<OFFSET_T, W> &o,
+                                   const mask<T, W> &m,
+                                   scale_t<SCALE> s)
+    {
+      scatter_from(p, base, o, m, s, gather_in_halves<T, W>());
+    }
+
+    // NOTE: the low half is written first to keep the lane order
+
+    template <typename T, int W, typename OFFSET_T, int SCALE>
+    TSIMD_INLINE void scatter_from(const pack<T, W> &p,
+                                   void *base,
+                                   const pack<OFFSET_T, W> &o,
+                                   scale_t<SCALE> s,
+                                   std::true_type /*in_halves*/)
+    {
+      using HALF_T = pack<T, W / 2>;
+      using HALF_O = pack<OFFSET_T, W / 2>;
+
+      scatter_from(HALF_T(p.vl), base, HALF_O(o.vl), s);
+      scatter_from(HALF_T(p.vh), base, HALF_O(o.vh), s);
+    }
+
+    template <typename T, int W, typename OFFSET_T, int SCALE>
+    TSIMD_INLINE void scatter_from(const pack<T, W> &p,
+                                   void *base,
+                                   const pack<OFFSET_T, W> &o,
+                                   const mask<T, W> &m,
+                                   scale_t<SCALE> s,
+                                   std::true_type /*in_halves*/)
+    {
+      using HALF_T = pack<T, W / 2>;
+      using HALF_O = pack<OFFSET_T, W / 2>;
+      using HALF_M = mask<T, W / 2>;
+
+      scatter_from(HALF_T(p.vl), base, HALF_O(o.vl), HALF_M(m.vl), s);
+      scatter_from(HALF_T(p.vh), base, HALF_O(o.vh), HALF_M(m.vh), s);
+    }
+
+  }  // namespace detail
+
+  // scatter() ////////////////////////////////////////////////////////////////
+
+  // NOTE: element 'i' is written to the byte address '_dst + o[i] * SCALE'
+
+  template <int SCALE, typename PACK_T, typename OFFSET_T>
   TSIMD_INLINE void scatter(const PACK_T &p,
                             void *_dst,
                             const pack<OFFSET_T, PACK_T::static_size> &o)
   {
-    auto *dst = (typename PACK_T::value_t *)_dst;
+    static_assert(detail::is_valid_scale<SCALE>::value,
+                  "scatter<>() scale must be 1, 2, 4 or 8!");
 
-#if TSIMD_USE_OPENMP
-#  pragma omp simd
-#endif
-    for (int i = 0; i < PACK_T::static_size; ++i)
-      dst[o[i]] = p[i];
+    using T = typename PACK_T::value_t;
+    using ELEMENT_T = typename detail::lane_index_type<T>::type;
+
+    detail::scatter_from(reinterpret_elements_as<ELEMENT_T>(p),
+                         _dst,
+                         detail::as_gather_offsets(o),
+                         detail::scale_t<SCALE>());
   }
 
-  template <typename PACK_T, typename OFFSET_T>
+  template <int SCALE, typename PACK_T, typename OFFSET_T>
   TSIMD_INLINE void scatter(
       const PACK_T &p,
       void *_dst,
       const pack<OFFSET_T, PACK_T::static_size> &o,
       const mask<typename PACK_T::value_t, PACK_T::static_size> &m)
   {
-    auto *dst = (typename PACK_T::value_t *)_dst;
+    static_assert(detail::is_valid_scale<SCALE>::value,
+                  "scatter<>() scale must be 1, 2, 4 or 8!");
 
-#if TSIMD_USE_OPENMP
-#  pragma omp simd
-#endif
-    for (int i = 0; i < PACK_T::static_size; ++i)
-      if (m[i])
-        dst[o[i]] = p[i];
+    using T = typename PACK_T::value_t;
+    using ELEMENT_T = typename detail::lane_index_type<T>::type;
+
+    detail::scatter_from(reinterpret_elements_as<ELEMENT_T>(p),
+                         _dst,
+                         detail::as_gather_offsets(o),
+                         m,
+                         detail::scale_t<SCALE>());
+  }
+
+  // NOTE: without a scale, offsets count elements of the scattered type
+
+  template <typename PACK_T, typename OFFSET_T>
+  TSIMD_INLINE void scatter(const PACK_T &p,
+                            void *_dst,
+                            const pack<OFFSET_T, PACK_T::static_size> &o)
+  {
+    scatter<sizeof(typename PACK_T::value_t)>(p, _dst, o);
+  }
+
+  template <typename PACK_T, typename OFFSET_T>
+  TSIMD_INLINE void scatter(
+      const PACK_T &p,
+      void *_dst,
+      const pack<OFFSET_T, PACK_T::static_size> &o,
+      const mask<typename PACK_T::value_t, PACK_T::static_size> &m)
+  {
+    scatter<sizeof(typename PACK_T::value_t)>(p, _dst, o, m);
   }
 
-}  // namespace tsimd
+TSIMD_NAMESPACE_END  // namespace tsimd
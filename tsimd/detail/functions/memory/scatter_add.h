@@ -0,0 +1,357 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Intel Corporation                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+#pragma once
+
+#include <type_traits>
+
+#include "../../pack.h"
+
+#include "../../operators/logic/greater_than_or_equal.h"
+#include "../algorithm/any.h"
+#include "../algorithm/reduce.h"
+#include "../algorithm/select.h"
+#include "../shuffle/permute.h"
+#include "../shuffle/shift_lanes.h"
+#include "gather.h"
+#include "scatter.h"
+
+TSIMD_NAMESPACE_BEGIN
+
+  namespace detail {
+
+    // NOTE: lanes that hit the same address are first merged in-register,
+    //       leaving one active lane per distinct offset (the last one). A
+    //       single masked gather/combine/scatter then updates memory, which
+    //       is only correct once the offsets are unique.
+
+    // Conflict detection /////////////////////////////////////////////////////
+
+    template <typename IDX_T, int W>
+    struct has_conflict_detection : std::false_type
+    {
+    };
+
+#if defined(__AVX512CD__)
+    template <>
+    struct has_conflict_detection<int, 16> : std::true_type
+    {
+    };
+
+    template <>
+    struct has_conflict_detection<long long, 8> : std::true_type
+    {
+    };
+
+    // NOTE: 'conflict' sets bit j of lane i when the earlier lane j has the
+    //       same offset, so its highest set bit is the nearest duplicate
+    //       (31 - lzcnt(0) == -1 when there is none). Any bit set across all
+    //       lanes marks a lane which isn't the last of its offset.
+
+    TSIMD_INLINE vint16 nearest_duplicate(const vint16 &idx,
+                                          const vboolf16 &m,
+                                          vboolf16 &last)
+    {
+      const __mmask16 k = m;
+      const __m512i conflicts = _mm512_and_si512(
+          _mm512_maskz_conflict_epi32(k, idx), _mm512_set1_epi32(k));
+
+      last = vboolf16(__mmask16(k & ~_mm512_reduce_or_epi32(conflicts)));
+      return _mm512_sub_epi32(_mm512_set1_epi32(31),
+                              _mm512_lzcnt_epi32(conflicts));
+    }
+
+    TSIMD_INLINE vllong8 nearest_duplicate(const vllong8 &idx,
+                                           const vboold8 &m,
+                                           vboold8 &last)
+    {
+      const __mmask8 k = m;
+      const __m512i conflicts = _mm512_and_si512(
+          _mm512_maskz_conflict_epi64(k, idx), _mm512_set1_epi64(k));
+
+      last = vboold8(__mmask8(k & ~_mm512_reduce_or_epi64(conflicts)));
+      return _mm512_sub_epi64(_mm512_set1_epi64(63),
+                              _mm512_lzcnt_epi64(conflicts));
+    }
+
+#  if defined(__AVX512VL__)
+    template <>
+    struct has_conflict_detection<int, 8> : std::true_type
+    {
+    };
+
+    template <>
+    struct has_conflict_detection<long long, 4> : std::true_type
+    {
+    };
+
+    TSIMD_INLINE int reduce_or_bits(__m256i v)
+    {
+      __m128i x = _mm_or_si128(_mm256_castsi256_si128(v),
+                               _mm256_extracti128_si256(v, 1));
+      x = _mm_or_si128(x, _mm_unpackhi_epi64(x, x));
+      x = _mm_or_si128(x, _mm_srli_epi64(x, 32));
+      return _mm_cvtsi128_si32(x);
+    }
+
+    TSIMD_INLINE vint8 nearest_duplicate(const vint8 &idx,
+                                         const vboolf8 &m,
+                                         vboolf8 &last)
+    {
+      const __mmask8 k = m;
+      const __m256i conflicts = _mm256_and_si256(
+          _mm256_maskz_conflict_epi32(k, idx), _mm256_set1_epi32(k));
+
+      last = vboolf8(__mmask8(k & ~reduce_or_bits(conflicts)));
+      return _mm256_sub_epi32(_mm256_set1_epi32(31),
+                              _mm256_lzcnt_epi32(conflicts));
+    }
+
+    TSIMD_INLINE vllong4 nearest_duplicate(const vllong4 &idx,
+                                           const vboold4 &m,
+                                           vboold4 &last)
+    {
+      const __mmask8 k = m;
+      const __m256i conflicts = _mm256_and_si256(
+          _mm256_maskz_conflict_epi64(k, idx), _mm256_set1_epi64x(k));
+
+      last = vboold4(__mmask8(k & ~reduce_or_bits(conflicts)));
+      return _mm256_sub_epi64(_mm256_set1_epi64x(63),
+                              _mm256_lzcnt_epi64(conflicts));
+    }
+#  endif
+#endif
+
+    // Merging duplicate lanes ////////////////////////////////////////////////
+
+    // NOTE: each lane follows its chain of earlier duplicates by pointer
+    //       jumping, which takes log2(W) steps for a chain through all lanes
+
+    template <typename OP, typename T, int W, typename IDX_T>
+    TSIMD_INLINE void merge_duplicates(OP op,
+                                       pack<T, W> &acc,
+                                       mask<T, W> &last,
+                                       const pack<IDX_T, W> &idx,
+                                       const mask<T, W> &m)
+    {
+      const pack<IDX_T, W> none(-1);
+
+      pack<IDX_T, W> prev = nearest_duplicate(idx, m, last);
+      auto linked         = prev >= pack<IDX_T, W>(0);
+
+      while (any(linked)) {
+        acc    = select(linked, op(acc, permute(acc, prev)), acc);
+        prev   = select(linked, permute(prev, prev), none);
+        linked = prev >= pack<IDX_T, W>(0);
+      }
+    }
+
+    // Scatter updates ////////////////////////////////////////////////////////
+
+    template <typename OP, typename T, int W, typename IDX_T>
+    TSIMD_INLINE void update_lanes(OP op,
+                                   const pack<T, W> &p,
+                                   void *_dst,
+                                   const pack<IDX_T, W> &idx,
+                                   const mask<T, W> &m,
+                                   std::true_type /*conflict detection*/)
+    {
+      pack<T, W> acc = p;
+      mask<T, W> last;
+
+      merge_duplicates(op, acc, last, idx, m);
+
+      const pack<T, W> old = gather<pack<T, W>>(_dst, idx, last);
+      scatter(op(old, acc), _dst, idx, last);
+    }
+
+    // NOTE: without conflict detection there is no hardware scatter either,
+    //       so the lanes are stored one by one anyway: updating memory in
+    //       lane order handles duplicates without merging them first
+
+    template <typename OP, typename T, int W, typename IDX_T>
+    TSIMD_INLINE void update_lanes(OP op,
+                                   const pack<T, W> &p,
+                                   void *_dst,
+                                   const pack<IDX_T, W> &idx,
+                                   const mask<T, W> &m,
+                                   std::false_type /*conflict detection*/)
+    {
+      auto *dst = (T *)_dst;
+
+      for (int i = 0; i < W; ++i)
+        if (m[i])
+          dst[idx[i]] = op(dst[idx[i]], p[i]);
+    }
+
+    template <typename OP, typename T, int W, typename IDX_T>
+    TSIMD_INLINE void scatter_update(OP op,
+                                     const pack<T, W> &p,
+                                     void *_dst,
+                                     const pack<IDX_T, W> &idx,
+                                     const mask<T, W> &m,
+                                     std::false_type /*in_halves*/)
+    {
+      update_lanes(
+          op,
+          p,
+          _dst,
+          idx,
+          m,
+          std::integral_constant<bool,
+                                 has_conflict_detection<IDX_T, W>::value>());
+    }
+
+    // NOTE: the halves update memory one after the other, so duplicates
+    //       across them are accumulated in memory instead of in-register
+
+    template <typename OP, typename T, int W, typename IDX_T>
+    TSIMD_INLINE void scatter_update(OP op,
+                                     const pack<T, W> &p,
+                                     void *_dst,
+                                     const pack<IDX_T, W> &idx,
+                                     const mask<T, W> &m,
+                                     std::true_type /*in_halves*/)
+    {
+      using HALF_T = pack<T, W / 2>;
+      using HALF_I = pack<IDX_T, W / 2>;
+      using HALF_M = mask<T, W / 2>;
+
+      scatter_update(op,
+                     HALF_T(p.vl),
+                     _dst,
+                     HALF_I(idx.vl),
+                     HALF_M(m.vl),
+                     shift_in_halves<T, W / 2>());
+      scatter_update(op,
+                     HALF_T(p.vh),
+                     _dst,
+                     HALF_I(idx.vh),
+                     HALF_M(m.vh),
+                     shift_in_halves<T, W / 2>());
+    }
+
+    // NOTE: offsets are compared in lanes of the element width, narrower
+    //       offsets are widened first
+
+    template <typename T, typename OFFSET_T, int W>
+    TSIMD_INLINE pack<typename lane_index_type<T>::type, W> as_update_offsets(
+        const pack<OFFSET_T, W> &o, std::true_type /*same size*/)
+    {
+      return reinterpret_elements_as<typename lane_index_type<T>::type>(o);
+    }
+
+    template <typename T, typename OFFSET_T, int W>
+    TSIMD_INLINE pack<typename lane_index_type<T>::type, W> as_update_offsets(
+        const pack<OFFSET_T, W> &o, std::false_type /*same size*/)
+    {
+      return convert_elements_to<typename lane_index_type<T>::type>(o);
+    }
+
+    template <typename OP, typename T, int W, typename OFFSET_T>
+    TSIMD_INLINE void scatter_update(OP op,
+                                     const pack<T, W> &p,
+                                     void *_dst,
+                                     const pack<OFFSET_T, W> &o,
+                                     const mask<T, W> &m)
+    {
+      static_assert(std::is_integral<OFFSET_T>::value &&
+                        sizeof(OFFSET_T) <= sizeof(T),
+                    "scatter_add/min/max() offsets must be integers no wider"
+                    " than the elements!");
+
+      scatter_update(
+          op,
+          p,
+          _dst,
+          as_update_offsets<T>(
+              o,
+              std::integral_constant<bool,
+                                     traits::same_size<T, OFFSET_T>::value>()),
+          m,
+          shift_in_halves<T, W>());
+    }
+
+  }  // namespace detail
+
+  // scatter_add()/scatter_min()/scatter_max() ////////////////////////////////
+
+  // NOTE: '_dst[o[i]] = OP(_dst[o[i]], p[i])' for each (active) lane, where
+  //       lanes with the same offset all contribute (e.g. histogram bins)
+
+  template <typename T, int W, typename OFFSET_T>
+  TSIMD_INLINE void scatter_add(const pack<T, W> &p,
+                                void *_dst,
+                                const pack<OFFSET_T, W> &o)
+  {
+    detail::scatter_update(
+        detail::reduce_add_op(), p, _dst, o, mask<T, W>(true));
+  }
+
+  template <typename T, int W, typename OFFSET_T>
+  TSIMD_INLINE void scatter_add(const pack<T, W> &p,
+                                void *_dst,
+                                const pack<OFFSET_T, W> &o,
+                                const mask<T, W> &m)
+  {
+    detail::scatter_update(detail::reduce_add_op(), p, _dst, o, m);
+  }
+
+  template <typename T, int W, typename OFFSET_T>
+  TSIMD_INLINE void scatter_min(const pack<T, W> &p,
+                                void *_dst,
+                                const pack<OFFSET_T, W> &o)
+  {
+    detail::scatter_update(
+        detail::reduce_min_op(), p, _dst, o, mask<T, W>(true));
+  }
+
+  template <typename T, int W, typename OFFSET_T>
+  TSIMD_INLINE void scatter_min(const pack<T, W> &p,
+                                void *_dst,
+                                const pack<OFFSET_T, W> &o,
+                                const mask<T, W> &m)
+  {
+    detail::scatter_update(detail::reduce_min_op(), p, _dst, o, m);
+  }
+
+  template <typename T, int W, typename OFFSET_T>
+  TSIMD_INLINE void scatter_max(const pack<T, W> &p,
+                                void *_dst,
+                                const pack<OFFSET_T, W> &o)
+  {
+    detail::scatter_update(
+        detail::reduce_max_op(), p, _dst, o, mask<T, W>(true));
+  }
+
+  template <typename T, int W, typename OFFSET_T>
+  TSIMD_INLINE void scatter_max(const pack<T, W> &p,
+                                void *_dst,
+                                const pack<OFFSET_T, W> &o,
+                                const mask<T, W> &m)
+  {
+    detail::scatter_update(detail::reduce_max_op(), p, _dst, o, m);
+  }
+
+TSIMD_NAMESPACE_END  // namespace tsimd
@@ -24,21 +24,47 @@
 
 #pragma once
 
+#include <cstring>
+#include <type_traits>
+
 #include "../../pack.h"
 #include "load.h"
 
-namespace tsimd {
+TSIMD_NAMESPACE_BEGIN
 
   // store() //////////////////////////////////////////////////////////////////
 
+  // NOTE: only wide packs use the primary templates, which split the store
+  //       over their two halves
+
   template <typename PACK_T>
-  TSIMD_INLINE void store(const PACK_T &p, void *_dst);
+  TSIMD_INLINE void store(const PACK_T &p, void *_dst)
+  {
+    using T = typename PACK_T::value_t;
+
+    static_assert(traits::is_wide_pack<T, PACK_T::static_size>::value,
+                  "store() isn't implemented for this pack type!");
+
+    auto *dst = (T *)_dst;
+    store(p.vl, dst);
+    store(p.vh, dst + PACK_T::static_size / 2);
+  }
 
   template <typename PACK_T>
   TSIMD_INLINE void store(
       const PACK_T &p,
       void *_dst,
-      const mask<typename PACK_T::value_t, PACK_T::static_size> &m);
+      const mask<typename PACK_T::value_t, PACK_T::static_size> &m)
+  {
+    using T = typename PACK_T::value_t;
+
+    static_assert(traits::is_wide_pack<T, PACK_T::static_size>::value,
+                  "store() isn't implemented for this pack type!");
+
+    auto *dst = (T *)_dst;
+    store(p.vl, dst, m.vl);
+    store(p.vh, dst + PACK_T::static_size / 2, m.vh);
+  }
 
   // 1-wide //
 
@@ -49,7 +75,9 @@ namespace tsimd {
   }
 
   template <typename T>
-  TSIMD_INLINE void store(const pack<T, 1> &v, void *_dst, const vboolf1 &mask)
+  TSIMD_INLINE void store(const pack<T, 1> &v,
+                          void *_dst,
+                          const mask<T, 1> &mask)
   {
     if (mask[0])
       *((T *)_dst) = v[0];
@@ -73,7 +101,11 @@ namespace tsimd {
   template <>
   TSIMD_INLINE void store(const vfloat4 &v, void *_dst, const vboolf4 &mask)
   {
-#if defined(__SSE__)
+#if defined(__AVX512VL__)
+    _mm_mask_store_ps((float *)_dst, mask, v);
+#elif defined(__AVX__)
+    _mm_maskstore_ps((float *)_dst, _mm_castps_si128(mask), v);
+#elif defined(__SSE__) && TSIMD_MASKED_MEMORY_RMW
     store(select(mask, v, load<vfloat4>(_dst)), _dst);
 #else
     auto *dst = (typename vfloat4::value_t *)_dst;
@@ -100,7 +132,14 @@ namespace tsimd {
   template <>
   TSIMD_INLINE void store(const vint4 &v, void *_dst, const vboolf4 &mask)
   {
-#if defined(__SSE__)
+#if defined(__AVX512VL__)
+    _mm_mask_store_epi32(_dst, mask, v);
+#elif defined(__AVX2__)
+    _mm_maskstore_epi32((int *)_dst, mask, v);
+#elif defined(__AVX__)
+    _mm_maskstore_ps(
+        (float *)_dst, _mm_castps_si128(mask), _mm_castsi128_ps(v));
+#elif defined(__SSE__) && TSIMD_MASKED_MEMORY_RMW
     store(select(mask, v, load<vint4>(_dst)), _dst);
 #else
     auto *dst = (typename vint4::value_t *)_dst;
@@ -114,31 +153,86 @@ namespace tsimd {
   template <>
   TSIMD_INLINE void store(const vdouble4 &v, void *_dst)
   {
+#if defined(__AVX__)
+    _mm256_store_pd((double *)_dst, v);
+#else
     auto *dst = (typename vdouble4::value_t *)_dst;
 
     for (int i = 0; i < 4; ++i)
       dst[i] = v[i];
+#endif
   }
 
   template <>
   TSIMD_INLINE void store(const vdouble4 &v, void *_dst, const vboold4 &mask)
   {
-    store(select(mask, v, load<vdouble4>(_dst)), _dst);
+#if defined(__AVX512VL__)
+    _mm256_mask_store_pd((double *)_dst, mask, v);
+#elif defined(__AVX__)
+    _mm256_maskstore_pd((double *)_dst, _mm256_castpd_si256(mask), v);
+#else
+    auto *dst = (typename vdouble4::value_t *)_dst;
+
+    for (int i = 0; i < 4; ++i)
+      if (mask[i])
+        dst[i] = v[i];
+#endif
   }
 
   template <>
   TSIMD_INLINE void store(const vllong4 &v, void *_dst)
   {
+#if defined(__AVX__)
+    _mm256_store_si256((__m256i *)_dst, v);
+#else
     auto *dst = (typename vllong4::value_t *)_dst;
 
     for (int i = 0; i < 4; ++i)
       dst[i] = v[i];
+#endif
   }
 
   template <>
   TSIMD_INLINE void store(const vllong4 &v, void *_dst, const vboold4 &mask)
   {
-    store(select(mask, v, load<vllong4>(_dst)), _dst);
+#if defined(__AVX512VL__)
+    _mm256_mask_store_epi64(_dst, mask, v);
+#elif defined(__AVX2__)
+    _mm256_maskstore_epi64((long long *)_dst, _mm256_castpd_si256(mask), v);
+#elif defined(__AVX__)
+    _mm256_maskstore_pd(
+        (double *)_dst, _mm256_castpd_si256(mask), _mm256_castsi256_pd(v));
+#else
+    auto *dst = (typename vllong4::value_t *)_dst;
+
+    for (int i = 0; i < 4; ++i)
+      if (mask[i])
+        dst[i] = v[i];
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vuint4 &v, void *_dst)
+  {
+    store(detail::as_signed(v), _dst);
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vuint4 &v, void *_dst, const vboolf4 &mask)
+  {
+    store(detail::as_signed(v), _dst, mask);
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vullong4 &v, void *_dst)
+  {
+    store(detail::as_signed(v), _dst);
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vullong4 &v, void *_dst, const vboold4 &mask)
+  {
+    store(detail::as_signed(v), _dst, mask);
   }
 
   // 8-wide //
@@ -158,7 +252,9 @@ namespace tsimd {
   template <>
   TSIMD_INLINE void store(const vfloat8 &v, void *_dst, const vboolf8 &mask)
   {
-#if defined(__AVX2__) || defined(__AVX__)
+#if defined(__AVX512VL__)
+    _mm256_mask_store_ps((float *)_dst, mask, v);
+#elif defined(__AVX2__) || defined(__AVX__)
     _mm256_maskstore_ps((float *)_dst, mask, v);
 #else
     auto *dst = (typename vfloat8::value_t *)_dst;
@@ -184,8 +280,8 @@ namespace tsimd {
   template <>
   TSIMD_INLINE void store(const vint8 &v, void *_dst, const vboolf8 &mask)
   {
-#if 0  // defined(__AVX2__)
-    _mm256_maskstore_epi32((int*)_dst, mask, v);
+#if defined(__AVX512VL__)
+    _mm256_mask_store_epi32(_dst, mask, v);
 #elif defined(__AVX__)
     _mm256_maskstore_ps((float *)_dst, mask, v);
 #else
@@ -198,33 +294,73 @@ namespace tsimd {
   template <>
   TSIMD_INLINE void store(const vdouble8 &v, void *_dst)
   {
+#if defined(__AVX512F__)
+    _mm512_store_pd((double *)_dst, v);
+#else
     auto *dst = (typename vdouble8::value_t *)_dst;
     store(vdouble4(v.vl), dst);
     store(vdouble4(v.vh), dst + 4);
+#endif
   }
 
   template <>
   TSIMD_INLINE void store(const vdouble8 &v, void *_dst, const vboold8 &mask)
   {
+#if defined(__AVX512F__)
+    _mm512_mask_store_pd((double *)_dst, mask, v);
+#else
     auto *dst = (typename vdouble8::value_t *)_dst;
     store(vdouble4(v.vl), dst, vboold4(mask.vl));
     store(vdouble4(v.vh), dst + 4, vboold4(mask.vh));
+#endif
   }
 
   template <>
   TSIMD_INLINE void store(const vllong8 &v, void *_dst)
   {
+#if defined(__AVX512F__)
+    _mm512_store_si512(_dst, v);
+#else
     auto *dst = (typename vllong8::value_t *)_dst;
     store(vllong4(v.vl), dst);
     store(vllong4(v.vh), dst + 4);
+#endif
   }
 
   template <>
   TSIMD_INLINE void store(const vllong8 &v, void *_dst, const vboold8 &mask)
   {
+#if defined(__AVX512F__)
+    _mm512_mask_store_epi64(_dst, mask, v);
+#else
     auto *dst = (typename vllong8::value_t *)_dst;
     store(vllong4(v.vl), dst, vboold4(mask.vl));
     store(vllong4(v.vh), dst + 4, vboold4(mask.vh));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vuint8 &v, void *_dst)
+  {
+    store(detail::as_signed(v), _dst);
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vuint8 &v, void *_dst, const vboolf8 &mask)
+  {
+    store(detail::as_signed(v), _dst, mask);
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vullong8 &v, void *_dst)
+  {
+    store(detail::as_signed(v), _dst);
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vullong8 &v, void *_dst, const vboold8 &mask)
+  {
+    store(detail::as_signed(v), _dst, mask);
   }
 
   // 16-wide //
@@ -309,4 +445,387 @@ namespace tsimd {
     store(vllong8(v.vh), dst + 8, vboold8(mask.vh));
   }
 
-}  // namespace tsimd
\ No newline at end of file
+  template <>
+  TSIMD_INLINE void store(const vuint16 &v, void *_dst)
+  {
+    store(detail::as_signed(v), _dst);
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vuint16 &v, void *_dst, const vboolf16 &mask)
+  {
+    store(detail::as_signed(v), _dst, mask);
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vullong16 &v, void *_dst)
+  {
+    store(detail::as_signed(v), _dst);
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vullong16 &v, void *_dst, const vboold16 &mask)
+  {
+    store(detail::as_signed(v), _dst, mask);
+  }
+
+  // 8/16-bit //
+
+  template <>
+  TSIMD_INLINE void store(const vschar16 &v, void *_dst)
+  {
+#if defined(__SSE__)
+    _mm_store_si128((__m128i *)_dst, v);
+#else
+    auto *dst = (typename vschar16::value_t *)_dst;
+
+    for (int i = 0; i < 16; ++i)
+      dst[i] = v[i];
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vschar16 &v, void *_dst, const vboolc16 &mask)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    _mm_mask_storeu_epi8(_dst, mask, v);
+#elif defined(__SSE__) && TSIMD_MASKED_MEMORY_RMW
+    store(select(mask, v, load<vschar16>(_dst)), _dst);
+#else
+    auto *dst = (typename vschar16::value_t *)_dst;
+
+    for (int i = 0; i < 16; ++i)
+      if (mask[i])
+        dst[i] = v[i];
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vuchar16 &v, void *_dst)
+  {
+    store(detail::as_signed(v), _dst);
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vuchar16 &v, void *_dst, const vboolc16 &mask)
+  {
+    store(detail::as_signed(v), _dst, mask);
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vshort8 &v, void *_dst)
+  {
+#if defined(__SSE__)
+    _mm_store_si128((__m128i *)_dst, v);
+#else
+    auto *dst = (typename vshort8::value_t *)_dst;
+
+    for (int i = 0; i < 8; ++i)
+      dst[i] = v[i];
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vshort8 &v, void *_dst, const vbools8 &mask)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    _mm_mask_storeu_epi16(_dst, mask, v);
+#elif defined(__SSE__) && TSIMD_MASKED_MEMORY_RMW
+    store(select(mask, v, load<vshort8>(_dst)), _dst);
+#else
+    auto *dst = (typename vshort8::value_t *)_dst;
+
+    for (int i = 0; i < 8; ++i)
+      if (mask[i])
+        dst[i] = v[i];
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vushort8 &v, void *_dst)
+  {
+    store(detail::as_signed(v), _dst);
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vushort8 &v, void *_dst, const vbools8 &mask)
+  {
+    store(detail::as_signed(v), _dst, mask);
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vschar32 &v, void *_dst)
+  {
+#if defined(__AVX__)
+    _mm256_store_si256((__m256i *)_dst, v);
+#else
+    auto *dst = (typename vschar32::value_t *)_dst;
+    store(vschar16(v.vl), dst);
+    store(vschar16(v.vh), dst + 16);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vschar32 &v, void *_dst, const vboolc32 &mask)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    _mm256_mask_storeu_epi8(_dst, mask, v);
+#elif defined(__AVX2__) && TSIMD_MASKED_MEMORY_RMW
+    store(select(mask, v, load<vschar32>(_dst)), _dst);
+#else
+    auto *dst = (typename vschar32::value_t *)_dst;
+    store(vschar16(v.vl), dst, vboolc16(mask.vl));
+    store(vschar16(v.vh), dst + 16, vboolc16(mask.vh));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vuchar32 &v, void *_dst)
+  {
+    store(detail::as_signed(v), _dst);
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vuchar32 &v, void *_dst, const vboolc32 &mask)
+  {
+    store(detail::as_signed(v), _dst, mask);
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vshort16 &v, void *_dst)
+  {
+#if defined(__AVX__)
+    _mm256_store_si256((__m256i *)_dst, v);
+#else
+    auto *dst = (typename vshort16::value_t *)_dst;
+    store(vshort8(v.vl), dst);
+    store(vshort8(v.vh), dst + 8);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vshort16 &v, void *_dst, const vbools16 &mask)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    _mm256_mask_storeu_epi16(_dst, mask, v);
+#elif defined(__AVX2__) && TSIMD_MASKED_MEMORY_RMW
+    store(select(mask, v, load<vshort16>(_dst)), _dst);
+#else
+    auto *dst = (typename vshort16::value_t *)_dst;
+    store(vshort8(v.vl), dst, vbools8(mask.vl));
+    store(vshort8(v.vh), dst + 8, vbools8(mask.vh));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vushort16 &v, void *_dst)
+  {
+    store(detail::as_signed(v), _dst);
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vushort16 &v, void *_dst, const vbools16 &mask)
+  {
+    store(detail::as_signed(v), _dst, mask);
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vschar64 &v, void *_dst)
+  {
+#if defined(__AVX512F__)
+    _mm512_store_si512(_dst, v);
+#else
+    auto *dst = (typename vschar64::value_t *)_dst;
+    store(vschar32(v.vl), dst);
+    store(vschar32(v.vh), dst + 32);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vschar64 &v, void *_dst, const vboolc64 &mask)
+  {
+#if defined(__AVX512BW__)
+    _mm512_mask_storeu_epi8(_dst, mask, v);
+#else
+    auto *dst = (typename vschar64::value_t *)_dst;
+    store(vschar32(v.vl), dst, vboolc32(mask.vl));
+    store(vschar32(v.vh), dst + 32, vboolc32(mask.vh));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vuchar64 &v, void *_dst)
+  {
+    store(detail::as_signed(v), _dst);
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vuchar64 &v, void *_dst, const vboolc64 &mask)
+  {
+    store(detail::as_signed(v), _dst, mask);
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vshort32 &v, void *_dst)
+  {
+#if defined(__AVX512F__)
+    _mm512_store_si512(_dst, v);
+#else
+    auto *dst = (typename vshort32::value_t *)_dst;
+    store(vshort16(v.vl), dst);
+    store(vshort16(v.vh), dst + 16);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vshort32 &v, void *_dst, const vbools32 &mask)
+  {
+#if defined(__AVX512BW__)
+    _mm512_mask_storeu_epi16(_dst, mask, v);
+#else
+    auto *dst = (typename vshort32::value_t *)_dst;
+    store(vshort16(v.vl), dst, vbools16(mask.vl));
+    store(vshort16(v.vh), dst + 16, vbools16(mask.vh));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vushort32 &v, void *_dst)
+  {
+    store(detail::as_signed(v), _dst);
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vushort32 &v, void *_dst, const vbools32 &mask)
+  {
+    store(detail::as_signed(v), _dst, mask);
+  }
+
+  // storeu() /////////////////////////////////////////////////////////////////
+
+  // NOTE: like store(), but 'dst' needs no alignment
+
+  namespace detail {
+
+    template <typename PACK_T, typename R>
+    TSIMD_INLINE void storeu_register(const PACK_T &p, const R &, void *dst)
+    {
+      using T = typename PACK_T::value_t;
+      std::memcpy(dst, &p, sizeof(T) * PACK_T::static_size);
+    }
+
+#if defined(__SSE__)
+    template <typename PACK_T>
+    TSIMD_INLINE void storeu_register(const PACK_T &,
+                                      const __m128 &r,
+                                      void *dst)
+    {
+      _mm_storeu_ps((float *)dst, r);
+    }
+
+    template <typename PACK_T>
+    TSIMD_INLINE void storeu_register(const PACK_T &,
+                                      const __m128i &r,
+                                      void *dst)
+    {
+      _mm_storeu_si128((__m128i *)dst, r);
+    }
+
+    template <typename PACK_T>
+    TSIMD_INLINE void storeu_register(const PACK_T &,
+                                      const __m128d &r,
+                                      void *dst)
+    {
+      _mm_storeu_pd((double *)dst, r);
+    }
+#endif
+
+#if defined(__AVX__)
+    template <typename PACK_T>
+    TSIMD_INLINE void storeu_register(const PACK_T &,
+                                      const __m256 &r,
+                                      void *dst)
+    {
+      _mm256_storeu_ps((float *)dst, r);
+    }
+
+    template <typename PACK_T>
+    TSIMD_INLINE void storeu_register(const PACK_T &,
+                                      const __m256i &r,
+                                      void *dst)
+    {
+      _mm256_storeu_si256((__m256i *)dst, r);
+    }
+
+    template <typename PACK_T>
+    TSIMD_INLINE void storeu_register(const PACK_T &,
+                                      const __m256d &r,
+                                      void *dst)
+    {
+      _mm256_storeu_pd((double *)dst, r);
+    }
+#endif
+
+#if defined(__AVX512F__)
+    template <typename PACK_T>
+    TSIMD_INLINE void storeu_register(const PACK_T &,
+                                      const __m512 &r,
+                                      void *dst)
+    {
+      _mm512_storeu_ps(dst, r);
+    }
+
+    template <typename PACK_T>
+    TSIMD_INLINE void storeu_register(const PACK_T &,
+                                      const __m512i &r,
+                                      void *dst)
+    {
+      _mm512_storeu_si512(dst, r);
+    }
+
+    template <typename PACK_T>
+    TSIMD_INLINE void storeu_register(const PACK_T &,
+                                      const __m512d &r,
+                                      void *dst)
+    {
+      _mm512_storeu_pd(dst, r);
+    }
+#endif
+
+    template <typename PACK_T>
+    TSIMD_INLINE void storeu_pack(const PACK_T &p,
+                                  void *dst,
+                                  std::false_type /*in_halves*/)
+    {
+      storeu_register(p, p.v, dst);
+    }
+
+    template <typename PACK_T>
+    TSIMD_INLINE void storeu_pack(const PACK_T &p,
+                                  void *dst,
+                                  std::true_type /*in_halves*/)
+    {
+      using T      = typename PACK_T::value_t;
+      using HALF_T = pack<T, PACK_T::static_size / 2>;
+      using in_halves = memory_in_halves<T, HALF_T::static_size>;
+
+      auto *d = (T *)dst;
+      storeu_pack(HALF_T(p.vl), d, in_halves());
+      storeu_pack(HALF_T(p.vh), d + HALF_T::static_size, in_halves());
+    }
+
+  }  // namespace detail
+
+  template <typename PACK_T>
+  TSIMD_INLINE void storeu(const PACK_T &p, void *dst)
+  {
+    using T = typename PACK_T::value_t;
+
+    static_assert(!traits::is_bool<T>::value,
+                  "storeu() can only be used with non-bool packs!");
+
+    using in_halves = detail::memory_in_halves<T, PACK_T::static_size>;
+    detail::storeu_pack(p, dst, in_halves());
+  }
+
+TSIMD_NAMESPACE_END  // namespace tsimd
\ No newline at end of file
@@ -0,0 +1,305 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Intel Corporation                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+#pragma once
+
+#include <cstring>
+#include <type_traits>
+
+#include "../../pack.h"
+#include "load.h"
+
+TSIMD_NAMESPACE_BEGIN
+
+  // NOTE: non-temporal loads/stores bypass the caches for data that is only
+  //       touched once (e.g. writing out an image), 'src'/'dst' must be
+  //       aligned as for load()/store(). Packs without a native register use
+  //       regular loads/stores.
+
+  namespace detail {
+
+    template <typename PACK_T, typename R>
+    TSIMD_INLINE void stream_load_register(PACK_T &p, R &, const void *src)
+    {
+      using T = typename PACK_T::value_t;
+      std::memcpy(&p, src, sizeof(T) * PACK_T::static_size);
+    }
+
+    template <typename PACK_T, typename R>
+    TSIMD_INLINE void stream_store_register(const PACK_T &p,
+                                            const R &,
+                                            void *dst)
+    {
+      using T = typename PACK_T::value_t;
+      std::memcpy(dst, &p, sizeof(T) * PACK_T::static_size);
+    }
+
+    // 128-bit //
+
+#if defined(__SSE4_1__)
+    template <typename PACK_T>
+    TSIMD_INLINE void stream_load_register(PACK_T &,
+                                           __m128i &r,
+                                           const void *src)
+    {
+      r = _mm_stream_load_si128((__m128i *)src);
+    }
+
+    template <typename PACK_T>
+    TSIMD_INLINE void stream_load_register(PACK_T &,
+                                           __m128 &r,
+                                           const void *src)
+    {
+      r = _mm_castsi128_ps(_mm_stream_load_si128((__m128i *)src));
+    }
+
+    template <typename PACK_T>
+    TSIMD_INLINE void stream_load_register(PACK_T &,
+                                           __m128d &r,
+                                           const void *src)
+    {
+      r = _mm_castsi128_pd(_mm_stream_load_si128((__m128i *)src));
+    }
+#endif
+
+#if defined(__SSE__)
+    template <typename PACK_T>
+    TSIMD_INLINE void stream_store_register(const PACK_T &,
+                                            const __m128 &r,
+                                            void *dst)
+    {
+      _mm_stream_ps((float *)dst, r);
+    }
+
+    template <typename PACK_T>
+    TSIMD_INLINE void stream_store_register(const PACK_T &,
+                                            const __m128i &r,
+                                            void *dst)
+    {
+      _mm_stream_si128((__m128i *)dst, r);
+    }
+
+    template <typename PACK_T>
+    TSIMD_INLINE void stream_store_register(const PACK_T &,
+                                            const __m128d &r,
+                                            void *dst)
+    {
+      _mm_stream_pd((double *)dst, r);
+    }
+#endif
+
+    // 256-bit //
+
+#if defined(__AVX2__)
+    template <typename PACK_T>
+    TSIMD_INLINE void stream_load_register(PACK_T &,
+                                           __m256i &r,
+                                           const void *src)
+    {
+      r = _mm256_stream_load_si256((__m256i *)src);
+    }
+
+    template <typename PACK_T>
+    TSIMD_INLINE void stream_load_register(PACK_T &,
+                                           __m256 &r,
+                                           const void *src)
+    {
+      r = _mm256_castsi256_ps(_mm256_stream_load_si256((__m256i *)src));
+    }
+
+    template <typename PACK_T>
+    TSIMD_INLINE void stream_load_register(PACK_T &,
+                                           __m256d &r,
+                                           const void *src)
+    {
+      r = _mm256_castsi256_pd(_mm256_stream_load_si256((__m256i *)src));
+    }
+#endif
+
+#if defined(__AVX__)
+    template <typename PACK_T>
+    TSIMD_INLINE void stream_store_register(const PACK_T &,
+                                            const __m256 &r,
+                                            void *dst)
+    {
+      _mm256_stream_ps((float *)dst, r);
+    }
+
+    template <typename PACK_T>
+    TSIMD_INLINE void stream_store_register(const PACK_T &,
+                                            const __m256i &r,
+                                            void *dst)
+    {
+      _mm256_stream_si256((__m256i *)dst, r);
+    }
+
+    template <typename PACK_T>
+    TSIMD_INLINE void stream_store_register(const PACK_T &,
+                                            const __m256d &r,
+                                            void *dst)
+    {
+      _mm256_stream_pd((double *)dst, r);
+    }
+#endif
+
+    // 512-bit //
+
+#if defined(__AVX512F__)
+    template <typename PACK_T>
+    TSIMD_INLINE void stream_load_register(PACK_T &,
+                                           __m512i &r,
+                                           const void *src)
+    {
+      r = _mm512_stream_load_si512((void *)src);
+    }
+
+    template <typename PACK_T>
+    TSIMD_INLINE void stream_load_register(PACK_T &,
+                                           __m512 &r,
+                                           const void *src)
+    {
+      r = _mm512_castsi512_ps(_mm512_stream_load_si512((void *)src));
+    }
+
+    template <typename PACK_T>
+    TSIMD_INLINE void stream_load_register(PACK_T &,
+                                           __m512d &r,
+                                           const void *src)
+    {
+      r = _mm512_castsi512_pd(_mm512_stream_load_si512((void *)src));
+    }
+
+    template <typename PACK_T>
+    TSIMD_INLINE void stream_store_register(const PACK_T &,
+                                            const __m512 &r,
+                                            void *dst)
+    {
+      _mm512_stream_ps((float *)dst, r);
+    }
+
+    template <typename PACK_T>
+    TSIMD_INLINE void stream_store_register(const PACK_T &,
+                                            const __m512i &r,
+                                            void *dst)
+    {
+      _mm512_stream_si512((__m512i *)dst, r);
+    }
+
+    template <typename PACK_T>
+    TSIMD_INLINE void stream_store_register(const PACK_T &,
+                                            const __m512d &r,
+                                            void *dst)
+    {
+      _mm512_stream_pd((double *)dst, r);
+    }
+#endif
+
+    template <typename PACK_T>
+    TSIMD_INLINE PACK_T stream_load_pack(const void *src,
+                                         std::false_type /*in_halves*/)
+    {
+      PACK_T p;
+      stream_load_register(p, p.v, src);
+      return p;
+    }
+
+    template <typename PACK_T>
+    TSIMD_INLINE PACK_T stream_load_pack(const void *src,
+                                         std::true_type /*in_halves*/)
+    {
+      using T      = typename PACK_T::value_t;
+      using HALF_T = pack<T, PACK_T::static_size / 2>;
+      using in_halves = memory_in_halves<T, HALF_T::static_size>;
+
+      auto *s = (const T *)src;
+      return PACK_T(stream_load_pack<HALF_T>(s, in_halves()),
+                    stream_load_pack<HALF_T>(s + HALF_T::static_size,
+                                             in_halves()));
+    }
+
+    template <typename PACK_T>
+    TSIMD_INLINE void stream_store_pack(const PACK_T &p,
+                                        void *dst,
+                                        std::false_type /*in_halves*/)
+    {
+      stream_store_register(p, p.v, dst);
+    }
+
+    template <typename PACK_T>
+    TSIMD_INLINE void stream_store_pack(const PACK_T &p,
+                                        void *dst,
+                                        std::true_type /*in_halves*/)
+    {
+      using T      = typename PACK_T::value_t;
+      using HALF_T = pack<T, PACK_T::static_size / 2>;
+      using in_halves = memory_in_halves<T, HALF_T::static_size>;
+
+      auto *d = (T *)dst;
+      stream_store_pack(HALF_T(p.vl), d, in_halves());
+      stream_store_pack(HALF_T(p.vh), d + HALF_T::static_size, in_halves());
+    }
+
+  }  // namespace detail
+
+  // stream_load() ////////////////////////////////////////////////////////////
+
+  template <typename PACK_T>
+  TSIMD_INLINE PACK_T stream_load(const void *src)
+  {
+    using T = typename PACK_T::value_t;
+
+    static_assert(!traits::is_bool<T>::value,
+                  "stream_load<>() can only be used with non-bool packs!");
+
+    using in_halves = detail::memory_in_halves<T, PACK_T::static_size>;
+    return detail::stream_load_pack<PACK_T>(src, in_halves());
+  }
+
+  // stream_store() ///////////////////////////////////////////////////////////
+
+  template <typename PACK_T>
+  TSIMD_INLINE void stream_store(const PACK_T &p, void *dst)
+  {
+    using T = typename PACK_T::value_t;
+
+    static_assert(!traits::is_bool<T>::value,
+                  "stream_store() can only be used with non-bool packs!");
+
+    using in_halves = detail::memory_in_halves<T, PACK_T::static_size>;
+    detail::stream_store_pack(p, dst, in_halves());
+  }
+
+  // stream_fence() ///////////////////////////////////////////////////////////
+
+  // NOTE: streaming stores are weakly ordered, fence them before other
+  //       threads read the data they wrote
+
+  TSIMD_INLINE void stream_fence()
+  {
+#if defined(__SSE__)
+    _mm_sfence();
+#endif
+  }
+
+TSIMD_NAMESPACE_END  // namespace tsimd
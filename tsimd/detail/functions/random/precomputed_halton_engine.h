@@ -30,7 +30,7 @@
 
 #include <random>
 
-namespace tsimd {
+TSIMD_NAMESPACE_BEGIN
 
   namespace detail {
 
@@ -151,4 +151,4 @@ namespace tsimd {
     return engine();
   }
 
-} // namespace tsimd
\ No newline at end of file
+TSIMD_NAMESPACE_END  // namespace tsimd
\ No newline at end of file
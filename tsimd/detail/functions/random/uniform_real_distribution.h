@@ -26,7 +26,7 @@
 
 #include "../../pack.h"
 
-namespace tsimd {
+TSIMD_NAMESPACE_BEGIN
 
   // TODO: verify PACK_T is indeed a pack<>!
   template <typename PACK_T>
@@ -102,4 +102,4 @@ namespace tsimd {
     return b();
   }
 
-} // namespace tsimd
+TSIMD_NAMESPACE_END  // namespace tsimd
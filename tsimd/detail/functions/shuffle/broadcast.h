@@ -0,0 +1,76 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Intel Corporation                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+#pragma once
+
+#include "../../pack.h"
+
+#include "permute.h"
+
+TSIMD_NAMESPACE_BEGIN
+
+  namespace detail {
+
+    template <typename T, int W, int LANE>
+    TSIMD_INLINE pack<T, W> broadcast_lane(const pack<T, W> &p, lane_t<LANE>)
+    {
+      return permute1(p, pack<T, W>(T(LANE)));
+    }
+
+    template <int LANE>
+    TSIMD_INLINE vint4 broadcast_lane(const vint4 &p, lane_t<LANE>)
+    {
+#if defined(__SSE__)
+      return _mm_shuffle_epi32(p.v, LANE * 0x55);
+#else
+      return permute1(p, vint4(LANE));
+#endif
+    }
+
+    template <int LANE>
+    TSIMD_INLINE vllong4 broadcast_lane(const vllong4 &p, lane_t<LANE>)
+    {
+#if defined(__AVX2__)
+      return _mm256_permute4x64_epi64(p.v, LANE * 0x55);
+#else
+      return permute1(p, vllong4(LANE));
+#endif
+    }
+
+  }  // namespace detail
+
+  // NOTE: every lane of the result is lane 'LANE' of 'p'
+
+  template <int LANE, typename T, int W>
+  TSIMD_INLINE pack<T, W> broadcast(const pack<T, W> &p)
+  {
+    static_assert(!traits::is_bool<T>::value,
+                  "tsimd::broadcast<>() can only be used with non-bool packs");
+    static_assert(LANE >= 0 && LANE < W,
+                  "tsimd::broadcast<>() lane must be in [0, W)");
+    return reinterpret_elements_as<T>(detail::broadcast_lane(
+        detail::as_lane_indices(p), detail::lane_t<LANE>()));
+  }
+
+TSIMD_NAMESPACE_END  // namespace tsimd
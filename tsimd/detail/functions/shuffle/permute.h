@@ -0,0 +1,400 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Intel Corporation                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+#pragma once
+
+#include <type_traits>
+
+#include "../../pack.h"
+
+#include "../../operators/bitwise/and.h"
+#include "../../operators/logic/equals.h"
+#include "../algorithm/select.h"
+
+TSIMD_NAMESPACE_BEGIN
+
+  namespace detail {
+
+    // Signed integer type used to index the lanes of a pack<T> ///////////////
+
+    template <typename T>
+    struct lane_index_type
+    {
+      using type = typename std::conditional<
+          sizeof(T) == 1,
+          signed char,
+          typename std::conditional<
+              sizeof(T) == 2,
+              short,
+              typename std::conditional<sizeof(T) == 4, int, long long>::type>::
+              type>::type;
+    };
+
+    template <typename T, typename IDX_T>
+    using is_lane_index_t = traits::enable_if_t<
+        std::is_integral<IDX_T>::value && traits::same_size<T, IDX_T>::value>;
+
+    template <typename T, int W>
+    TSIMD_INLINE pack<T, W> lane_ids()
+    {
+      pack<T, W> ids;
+
+      for (int i = 0; i < W; ++i)
+        ids[i] = T(i);
+
+      return ids;
+    }
+
+    template <int N>
+    using lane_t = std::integral_constant<int, N>;
+
+    // NOTE: all permutes below work on the signed integer view of the data,
+    //       the public functions reinterpret float/unsigned packs around them
+
+    enum class permute_path
+    {
+      lanes,  // scalar loop over the lanes
+      halves  // two-source permutes of the two halves
+    };
+
+    template <permute_path PATH>
+    using permute_path_t = std::integral_constant<permute_path, PATH>;
+
+    template <typename T, int W>
+    struct permute_path_for
+    {
+      static constexpr permute_path value =
+          (W >= 8 && W * sizeof(T) > 16) ? permute_path::halves
+                                         : permute_path::lanes;
+    };
+
+    // NOTE: the per-width overloads fall back to these, which in turn use the
+    //       per-width overloads on the halves (defined further below)
+
+    template <typename T, int W>
+    TSIMD_INLINE pack<T, W> permute1(const pack<T, W> &p,
+                                     const pack<T, W> &idx,
+                                     permute_path_t<permute_path::lanes>);
+
+    template <typename T, int W>
+    TSIMD_INLINE pack<T, W> permute1(const pack<T, W> &p,
+                                     const pack<T, W> &idx,
+                                     permute_path_t<permute_path::halves>);
+
+    // 4-wide //
+
+    TSIMD_INLINE vint4 permute1(const vint4 &p, const vint4 &idx)
+    {
+#if defined(__AVX__)
+      return _mm_castps_si128(_mm_permutevar_ps(_mm_castsi128_ps(p.v), idx.v));
+#elif defined(__SSE4_1__)
+      // NOTE: byte shuffle control {4i, 4i+1, 4i+2, 4i+3} for each lane 'i'
+      const __m128i i4 = _mm_and_si128(idx.v, _mm_set1_epi32(3));
+      const __m128i bytes = _mm_add_epi32(
+          _mm_mullo_epi32(i4, _mm_set1_epi32(0x04040404)),
+          _mm_set1_epi32(0x03020100));
+      return _mm_shuffle_epi8(p.v, bytes);
+#else
+      return permute1(p, idx, permute_path_t<permute_path::lanes>());
+#endif
+    }
+
+    TSIMD_INLINE vint4 permute2(const vint4 &a,
+                                const vint4 &b,
+                                const vint4 &idx)
+    {
+#if defined(__AVX512VL__)
+      return _mm_permutex2var_epi32(a.v, idx.v, b.v);
+#else
+      return select((idx & 4) != 0, permute1(b, idx), permute1(a, idx));
+#endif
+    }
+
+    TSIMD_INLINE vllong4 permute1(const vllong4 &p, const vllong4 &idx)
+    {
+#if defined(__AVX512VL__)
+      return _mm256_permutexvar_epi64(idx.v, p.v);
+#elif defined(__AVX2__)
+      // NOTE: permute the 32-bit halves, lane 'i' -> {2i, 2i+1}
+      const __m256i i2 = _mm256_slli_epi64(
+          _mm256_and_si256(idx.v, _mm256_set1_epi64x(3)), 1);
+      const __m256i halves = _mm256_or_si256(
+          _mm256_or_si256(i2, _mm256_slli_epi64(i2, 32)),
+          _mm256_set1_epi64x(1LL << 32));
+      return _mm256_permutevar8x32_epi32(p.v, halves);
+#else
+      return permute1(p, idx, permute_path_t<permute_path::lanes>());
+#endif
+    }
+
+    TSIMD_INLINE vllong4 permute2(const vllong4 &a,
+                                  const vllong4 &b,
+                                  const vllong4 &idx)
+    {
+#if defined(__AVX512VL__)
+      return _mm256_permutex2var_epi64(a.v, idx.v, b.v);
+#else
+      return select((idx & 4) != 0, permute1(b, idx), permute1(a, idx));
+#endif
+    }
+
+    // 8-wide //
+
+    TSIMD_INLINE vint8 permute1(const vint8 &p, const vint8 &idx)
+    {
+#if defined(__AVX2__)
+      return _mm256_permutevar8x32_epi32(p.v, idx.v);
+#else
+      return permute1(p, idx, permute_path_t<permute_path::halves>());
+#endif
+    }
+
+    TSIMD_INLINE vint8 permute2(const vint8 &a,
+                                const vint8 &b,
+                                const vint8 &idx)
+    {
+#if defined(__AVX512VL__)
+      return _mm256_permutex2var_epi32(a.v, idx.v, b.v);
+#else
+      return select((idx & 8) != 0, permute1(b, idx), permute1(a, idx));
+#endif
+    }
+
+    TSIMD_INLINE vllong8 permute1(const vllong8 &p, const vllong8 &idx)
+    {
+#if defined(__AVX512F__)
+      return _mm512_permutexvar_epi64(idx.v, p.v);
+#else
+      return permute1(p, idx, permute_path_t<permute_path::halves>());
+#endif
+    }
+
+    TSIMD_INLINE vllong8 permute2(const vllong8 &a,
+                                  const vllong8 &b,
+                                  const vllong8 &idx)
+    {
+#if defined(__AVX512F__)
+      return _mm512_permutex2var_epi64(a.v, idx.v, b.v);
+#else
+      return select((idx & 8) != 0, permute1(b, idx), permute1(a, idx));
+#endif
+    }
+
+    // 16-wide //
+
+    TSIMD_INLINE vint16 permute1(const vint16 &p, const vint16 &idx)
+    {
+#if defined(__AVX512F__)
+      return _mm512_permutexvar_epi32(idx.v, p.v);
+#else
+      return permute1(p, idx, permute_path_t<permute_path::halves>());
+#endif
+    }
+
+    TSIMD_INLINE vint16 permute2(const vint16 &a,
+                                 const vint16 &b,
+                                 const vint16 &idx)
+    {
+#if defined(__AVX512F__)
+      return _mm512_permutex2var_epi32(a.v, idx.v, b.v);
+#else
+      return select((idx & 16) != 0, permute1(b, idx), permute1(a, idx));
+#endif
+    }
+
+    // 8/16-bit //
+
+    TSIMD_INLINE vschar16 permute1(const vschar16 &p, const vschar16 &idx)
+    {
+#if defined(__SSSE3__)
+      return _mm_shuffle_epi8(p.v, _mm_and_si128(idx.v, _mm_set1_epi8(15)));
+#else
+      return permute1(p, idx, permute_path_t<permute_path::lanes>());
+#endif
+    }
+
+    TSIMD_INLINE vshort8 permute1(const vshort8 &p, const vshort8 &idx)
+    {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+      return _mm_permutexvar_epi16(idx.v, p.v);
+#elif defined(__SSSE3__)
+      // NOTE: byte shuffle control {2i, 2i+1} for each lane 'i'
+      const __m128i i8 = _mm_and_si128(idx.v, _mm_set1_epi16(7));
+      const __m128i bytes = _mm_add_epi16(
+          _mm_mullo_epi16(i8, _mm_set1_epi16(0x0202)), _mm_set1_epi16(0x0100));
+      return _mm_shuffle_epi8(p.v, bytes);
+#else
+      return permute1(p, idx, permute_path_t<permute_path::lanes>());
+#endif
+    }
+
+    TSIMD_INLINE vshort8 permute2(const vshort8 &a,
+                                  const vshort8 &b,
+                                  const vshort8 &idx)
+    {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+      return _mm_permutex2var_epi16(a.v, idx.v, b.v);
+#else
+      return select((idx & 8) != 0, permute1(b, idx), permute1(a, idx));
+#endif
+    }
+
+    TSIMD_INLINE vshort16 permute1(const vshort16 &p, const vshort16 &idx)
+    {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+      return _mm256_permutexvar_epi16(idx.v, p.v);
+#else
+      return permute1(p, idx, permute_path_t<permute_path::halves>());
+#endif
+    }
+
+    TSIMD_INLINE vshort16 permute2(const vshort16 &a,
+                                   const vshort16 &b,
+                                   const vshort16 &idx)
+    {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+      return _mm256_permutex2var_epi16(a.v, idx.v, b.v);
+#else
+      return select((idx & 16) != 0, permute1(b, idx), permute1(a, idx));
+#endif
+    }
+
+    TSIMD_INLINE vshort32 permute1(const vshort32 &p, const vshort32 &idx)
+    {
+#if defined(__AVX512BW__)
+      return _mm512_permutexvar_epi16(idx.v, p.v);
+#else
+      return permute1(p, idx, permute_path_t<permute_path::halves>());
+#endif
+    }
+
+    TSIMD_INLINE vshort32 permute2(const vshort32 &a,
+                                   const vshort32 &b,
+                                   const vshort32 &idx)
+    {
+#if defined(__AVX512BW__)
+      return _mm512_permutex2var_epi16(a.v, idx.v, b.v);
+#else
+      return select((idx & 32) != 0, permute1(b, idx), permute1(a, idx));
+#endif
+    }
+
+    // generic //
+
+    template <typename T, int W>
+    TSIMD_INLINE pack<T, W> permute1(const pack<T, W> &p,
+                                     const pack<T, W> &idx)
+    {
+      return permute1(p, idx, permute_path_t<permute_path_for<T, W>::value>());
+    }
+
+    // NOTE: lanes of 'idx' >= W select lane (idx - W) of 'b'
+    template <typename T, int W>
+    TSIMD_INLINE pack<T, W> permute2(const pack<T, W> &a,
+                                     const pack<T, W> &b,
+                                     const pack<T, W> &idx)
+    {
+      return select((idx & W) != 0, permute1(b, idx), permute1(a, idx));
+    }
+
+    // lanes //
+
+    template <typename T, int W>
+    TSIMD_INLINE pack<T, W> permute1(const pack<T, W> &p,
+                                     const pack<T, W> &idx,
+                                     permute_path_t<permute_path::lanes>)
+    {
+      pack<T, W> result;
+
+      for (int i = 0; i < W; ++i)
+        result[i] = p[idx[i] & (W - 1)];
+
+      return result;
+    }
+
+    // halves //
+
+    template <typename T, int W>
+    TSIMD_INLINE pack<T, W> permute1(const pack<T, W> &p,
+                                     const pack<T, W> &idx,
+                                     permute_path_t<permute_path::halves>)
+    {
+      using half_t = pack<T, W / 2>;
+
+      const half_t lo(p.vl);
+      const half_t hi(p.vh);
+
+      return pack<T, W>(permute2(lo, hi, half_t(idx.vl)),
+                        permute2(lo, hi, half_t(idx.vh)));
+    }
+
+    // Lane type conversions //
+
+    template <typename T, int W>
+    using lane_index_pack = pack<typename lane_index_type<T>::type, W>;
+
+    template <typename T, int W>
+    TSIMD_INLINE lane_index_pack<T, W> as_lane_indices(const pack<T, W> &p)
+    {
+      return reinterpret_elements_as<typename lane_index_type<T>::type>(p);
+    }
+
+  }  // namespace detail
+
+  // NOTE: lane 'i' of the result is lane 'idx[i]' of 'p', indices are taken
+  //       modulo W (as the permute instructions do)
+
+  template <typename T,
+            int W,
+            typename IDX_T,
+            typename = detail::is_lane_index_t<T, IDX_T>>
+  TSIMD_INLINE pack<T, W> permute(const pack<T, W> &p,
+                                  const pack<IDX_T, W> &idx)
+  {
+    static_assert(!traits::is_bool<T>::value,
+                  "tsimd::permute() can only be used with non-bool packs");
+    return reinterpret_elements_as<T>(detail::permute1(
+        detail::as_lane_indices(p), detail::as_lane_indices(idx)));
+  }
+
+  // NOTE: two-source form, lanes 'idx[i]' in [W, 2W) select from 'b'
+  //       (indices are taken modulo 2W)
+
+  template <typename T,
+            int W,
+            typename IDX_T,
+            typename = detail::is_lane_index_t<T, IDX_T>>
+  TSIMD_INLINE pack<T, W> permute(const pack<T, W> &a,
+                                  const pack<T, W> &b,
+                                  const pack<IDX_T, W> &idx)
+  {
+    static_assert(!traits::is_bool<T>::value,
+                  "tsimd::permute() can only be used with non-bool packs");
+    return reinterpret_elements_as<T>(
+        detail::permute2(detail::as_lane_indices(a),
+                         detail::as_lane_indices(b),
+                         detail::as_lane_indices(idx)));
+  }
+
+TSIMD_NAMESPACE_END  // namespace tsimd
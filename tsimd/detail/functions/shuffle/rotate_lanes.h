@@ -0,0 +1,125 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Intel Corporation                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+#pragma once
+
+#include "../../pack.h"
+
+#include "../../operators/arithmetic/plus.h"
+#include "permute.h"
+#include "shuffle.h"
+
+TSIMD_NAMESPACE_BEGIN
+
+  namespace detail {
+
+    template <typename T, int W, int N>
+    TSIMD_INLINE pack<T, W> rotate_lanes(const pack<T, W> &p, lane_t<N>)
+    {
+      return permute1(p, (lane_ids<T, W>() + T(N)) & T(W - 1));
+    }
+
+    // 4-wide //
+
+    template <int N>
+    TSIMD_INLINE vint4 rotate_lanes(const vint4 &p, lane_t<N>)
+    {
+#if defined(__SSSE3__)
+      return _mm_alignr_epi8(p.v, p.v, N * 4);
+#else
+      return permute1(p, (lane_ids<int, 4>() + N) & 3);
+#endif
+    }
+
+    template <int N>
+    TSIMD_INLINE vllong4 rotate_lanes(const vllong4 &p, lane_t<N>)
+    {
+#if defined(__AVX2__)
+      return _mm256_permute4x64_epi64(
+          p.v, shuffle4_imm(N, N + 1, N + 2, N + 3));
+#else
+      return permute1(p, (lane_ids<long long, 4>() + N) & 3);
+#endif
+    }
+
+    // 16-wide //
+
+    template <int N>
+    TSIMD_INLINE vint16 rotate_lanes(const vint16 &p, lane_t<N>)
+    {
+#if defined(__AVX512F__)
+      return _mm512_alignr_epi32(p.v, p.v, N);
+#else
+      return permute1(p, (lane_ids<int, 16>() + N) & 15);
+#endif
+    }
+
+    template <int N>
+    TSIMD_INLINE vllong8 rotate_lanes(const vllong8 &p, lane_t<N>)
+    {
+#if defined(__AVX512F__)
+      return _mm512_alignr_epi64(p.v, p.v, N);
+#else
+      return permute1(p, (lane_ids<long long, 8>() + N) & 7);
+#endif
+    }
+
+    // 8/16-bit //
+
+    template <int N>
+    TSIMD_INLINE vschar16 rotate_lanes(const vschar16 &p, lane_t<N>)
+    {
+#if defined(__SSSE3__)
+      return _mm_alignr_epi8(p.v, p.v, N);
+#else
+      return permute1(p, (lane_ids<signed char, 16>() + N) & 15);
+#endif
+    }
+
+    template <int N>
+    TSIMD_INLINE vshort8 rotate_lanes(const vshort8 &p, lane_t<N>)
+    {
+#if defined(__SSSE3__)
+      return _mm_alignr_epi8(p.v, p.v, N * 2);
+#else
+      return permute1(p, (lane_ids<short, 8>() + N) & 7);
+#endif
+    }
+
+  }  // namespace detail
+
+  // NOTE: lane 'i' of the result is lane '(i + N) mod W' of 'p', i.e. a
+  //       positive N rotates the lanes down (towards lane 0)
+
+  template <int N, typename T, int W>
+  TSIMD_INLINE pack<T, W> rotate_lanes(const pack<T, W> &p)
+  {
+    static_assert(!traits::is_bool<T>::value,
+                  "tsimd::rotate_lanes<>() can only be used with non-bool"
+                  " packs");
+    return reinterpret_elements_as<T>(detail::rotate_lanes(
+        detail::as_lane_indices(p), detail::lane_t<((N % W) + W) % W>()));
+  }
+
+TSIMD_NAMESPACE_END  // namespace tsimd
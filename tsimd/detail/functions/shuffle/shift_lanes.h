@@ -0,0 +1,242 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Intel Corporation                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+#pragma once
+
+#include "../../pack.h"
+
+#include "../../operators/arithmetic/minus.h"
+#include "../../operators/arithmetic/plus.h"
+#include "../../operators/bitwise/or.h"
+#include "../../operators/logic/greater_than_or_equal.h"
+#include "../../operators/logic/less_than.h"
+#include "permute.h"
+
+TSIMD_NAMESPACE_BEGIN
+
+  namespace detail {
+
+    // NOTE: N is in [1, W) here, the public functions handle the rest
+
+    template <typename T, int W, int N>
+    TSIMD_INLINE pack<T, W> shift_lanes_down(const pack<T, W> &p, lane_t<N>)
+    {
+      const pack<T, W> ids = lane_ids<T, W>() + T(N);
+      return select(ids < T(W), permute1(p, ids), pack<T, W>(T(0)));
+    }
+
+    template <typename T, int W, int N>
+    TSIMD_INLINE pack<T, W> shift_lanes_up(const pack<T, W> &p, lane_t<N>)
+    {
+      const pack<T, W> ids = lane_ids<T, W>() - T(N);
+      return select(ids >= T(0), permute1(p, ids), pack<T, W>(T(0)));
+    }
+
+    // 128-bit //
+
+#define TSIMD_SHIFT_LANES_SSE(PACK_T)                                       \
+    template <int N>                                                        \
+    TSIMD_INLINE PACK_T shift_lanes_down(const PACK_T &p, lane_t<N>)        \
+    {                                                                       \
+      return _mm_srli_si128(p.v, N * sizeof(PACK_T::value_t));              \
+    }                                                                       \
+                                                                            \
+    template <int N>                                                        \
+    TSIMD_INLINE PACK_T shift_lanes_up(const PACK_T &p, lane_t<N>)          \
+    {                                                                       \
+      return _mm_slli_si128(p.v, N * sizeof(PACK_T::value_t));              \
+    }
+
+#if defined(__SSE__)
+    TSIMD_SHIFT_LANES_SSE(vint4)
+    TSIMD_SHIFT_LANES_SSE(vschar16)
+    TSIMD_SHIFT_LANES_SSE(vshort8)
+#endif
+
+#undef TSIMD_SHIFT_LANES_SSE
+
+    // 512-bit //
+
+    // NOTE: valignd/valignq shift in lanes of the (zero) second source
+
+#if defined(__AVX512F__)
+    template <int N>
+    TSIMD_INLINE vint16 shift_lanes_down(const vint16 &p, lane_t<N>)
+    {
+      return _mm512_alignr_epi32(_mm512_setzero_si512(), p.v, N);
+    }
+
+    template <int N>
+    TSIMD_INLINE vint16 shift_lanes_up(const vint16 &p, lane_t<N>)
+    {
+      return _mm512_alignr_epi32(p.v, _mm512_setzero_si512(), 16 - N);
+    }
+
+    template <int N>
+    TSIMD_INLINE vllong8 shift_lanes_down(const vllong8 &p, lane_t<N>)
+    {
+      return _mm512_alignr_epi64(_mm512_setzero_si512(), p.v, N);
+    }
+
+    template <int N>
+    TSIMD_INLINE vllong8 shift_lanes_up(const vllong8 &p, lane_t<N>)
+    {
+      return _mm512_alignr_epi64(p.v, _mm512_setzero_si512(), 8 - N);
+    }
+#endif
+
+    // halves //
+
+    // NOTE: packs wider than one register shift their halves, the lanes
+    //       crossing over between them are shifted out of the other half
+    //       (defined further below)
+
+#if defined(__AVX512F__)
+    constexpr int shift_register_bytes = 64;
+#elif defined(__AVX__)
+    constexpr int shift_register_bytes = 32;
+#else
+    constexpr int shift_register_bytes = 16;
+#endif
+
+    template <typename T, int W>
+    using shift_in_halves = std::integral_constant<
+        bool,
+        (W >= 8 && W * int(sizeof(T)) > shift_register_bytes)>;
+
+    template <typename T, int W, int N>
+    TSIMD_INLINE pack<T, W> shift_lanes_down(const pack<T, W> &p,
+                                             lane_t<N>,
+                                             std::true_type /*in_halves*/);
+
+    template <typename T, int W, int N>
+    TSIMD_INLINE pack<T, W> shift_lanes_up(const pack<T, W> &p,
+                                           lane_t<N>,
+                                           std::true_type /*in_halves*/);
+
+    template <typename T, int W, int N>
+    TSIMD_INLINE pack<T, W> shift_lanes_down(const pack<T, W> &p,
+                                             lane_t<N> n,
+                                             std::false_type /*in_halves*/)
+    {
+      return shift_lanes_down(p, n);
+    }
+
+    template <typename T, int W, int N>
+    TSIMD_INLINE pack<T, W> shift_lanes_up(const pack<T, W> &p,
+                                           lane_t<N> n,
+                                           std::false_type /*in_halves*/)
+    {
+      return shift_lanes_up(p, n);
+    }
+
+  }  // namespace detail
+
+  // NOTE: lane 'i' of the result is lane 'i + N' of 'p', lanes shifted in
+  //       from past the end are 0
+
+  template <int N, typename T, int W>
+  TSIMD_INLINE pack<T, W> shift_lanes_down(const pack<T, W> &p)
+  {
+    static_assert(!traits::is_bool<T>::value,
+                  "tsimd::shift_lanes_down<>() can only be used with non-bool"
+                  " packs");
+    static_assert(N >= 0, "tsimd::shift_lanes_down<>() N must be >= 0");
+
+    if (N == 0)
+      return p;
+    else if (N >= W)
+      return pack<T, W>(T(0));
+
+    using shift_t = detail::lane_t<(N > 0 && N < W) ? N : 1>;
+    return reinterpret_elements_as<T>(
+        detail::shift_lanes_down(detail::as_lane_indices(p),
+                                shift_t(),
+                                detail::shift_in_halves<T, W>()));
+  }
+
+  // NOTE: lane 'i' of the result is lane 'i - N' of 'p', lanes shifted in
+  //       from before the start are 0
+
+  template <int N, typename T, int W>
+  TSIMD_INLINE pack<T, W> shift_lanes_up(const pack<T, W> &p)
+  {
+    static_assert(!traits::is_bool<T>::value,
+                  "tsimd::shift_lanes_up<>() can only be used with non-bool"
+                  " packs");
+    static_assert(N >= 0, "tsimd::shift_lanes_up<>() N must be >= 0");
+
+    if (N == 0)
+      return p;
+    else if (N >= W)
+      return pack<T, W>(T(0));
+
+    using shift_t = detail::lane_t<(N > 0 && N < W) ? N : 1>;
+    return reinterpret_elements_as<T>(
+        detail::shift_lanes_up(detail::as_lane_indices(p),
+                                shift_t(),
+                                detail::shift_in_halves<T, W>()));
+  }
+
+  namespace detail {
+
+    template <typename T, int W, int N>
+    TSIMD_INLINE pack<T, W> shift_lanes_down(const pack<T, W> &p,
+                                             lane_t<N>,
+                                             std::true_type /*in_halves*/)
+    {
+      constexpr int H = W / 2;
+
+      const pack<T, H> lo(p.vl);
+      const pack<T, H> hi(p.vh);
+
+      const pack<T, H> from_hi =
+          N < H ? tsimd::shift_lanes_up<(N < H ? H - N : 0)>(hi)
+                : tsimd::shift_lanes_down<(N < H ? 0 : N - H)>(hi);
+
+      return pack<T, W>(tsimd::shift_lanes_down<N>(lo) | from_hi,
+                        tsimd::shift_lanes_down<N>(hi));
+    }
+
+    template <typename T, int W, int N>
+    TSIMD_INLINE pack<T, W> shift_lanes_up(const pack<T, W> &p,
+                                           lane_t<N>,
+                                           std::true_type /*in_halves*/)
+    {
+      constexpr int H = W / 2;
+
+      const pack<T, H> lo(p.vl);
+      const pack<T, H> hi(p.vh);
+
+      const pack<T, H> from_lo =
+          N < H ? tsimd::shift_lanes_down<(N < H ? H - N : 0)>(lo)
+                : tsimd::shift_lanes_up<(N < H ? 0 : N - H)>(lo);
+
+      return pack<T, W>(tsimd::shift_lanes_up<N>(lo),
+                        tsimd::shift_lanes_up<N>(hi) | from_lo);
+    }
+
+  }  // namespace detail
+
+TSIMD_NAMESPACE_END  // namespace tsimd
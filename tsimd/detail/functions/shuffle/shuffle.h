@@ -0,0 +1,223 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Intel Corporation                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+#pragma once
+
+#include <array>
+
+#include "../../pack.h"
+
+#include "permute.h"
+
+TSIMD_NAMESPACE_BEGIN
+
+  namespace detail {
+
+    template <int... I>
+    struct lane_indices
+    {
+    };
+
+    constexpr bool lanes_in_range(int)
+    {
+      return true;
+    }
+
+    template <typename... INTS>
+    constexpr bool lanes_in_range(int n, int i, INTS... rest)
+    {
+      return i >= 0 && i < n && lanes_in_range(n, rest...);
+    }
+
+    template <typename T, int W, int... I>
+    TSIMD_INLINE pack<T, W> index_pack(lane_indices<I...>)
+    {
+      return pack<T, W>(std::array<T, W>{{T(I)...}});
+    }
+
+    // NOTE: immediate of the 4-lane shuffles (same encoding as _MM_SHUFFLE())
+    constexpr int shuffle4_imm(int i0, int i1, int i2, int i3)
+    {
+      return (i0 & 3) | (i1 & 3) << 2 | (i2 & 3) << 4 | (i3 & 3) << 6;
+    }
+
+    // NOTE: _mm_shuffle_ps() takes its low two lanes from the first source
+    //       and its high two lanes from the second one
+    constexpr bool is_shufps_pattern(int i0, int i1, int i2, int i3)
+    {
+      return i0 < 4 && i1 < 4 && i2 >= 4 && i3 >= 4;
+    }
+
+    // NOTE: 8-lane patterns repeating the same 4-lane shuffle in both 128-bit
+    //       halves are a single in-lane shuffle on AVX
+    constexpr bool is_in_lane_pattern(int i0,
+                                      int i1,
+                                      int i2,
+                                      int i3,
+                                      int i4,
+                                      int i5,
+                                      int i6,
+                                      int i7)
+    {
+      return i0 < 4 && i1 < 4 && i2 < 4 && i3 < 4 && i4 == i0 + 4 &&
+             i5 == i1 + 4 && i6 == i2 + 4 && i7 == i3 + 4;
+    }
+
+    constexpr bool is_in_lane_shufps_pattern(int i0,
+                                             int i1,
+                                             int i2,
+                                             int i3,
+                                             int i4,
+                                             int i5,
+                                             int i6,
+                                             int i7)
+    {
+      return i0 < 4 && i1 < 4 && i2 >= 8 && i2 < 12 && i3 >= 8 && i3 < 12 &&
+             i4 == i0 + 4 && i5 == i1 + 4 && i6 == i2 + 4 && i7 == i3 + 4;
+    }
+
+    // generic //
+
+    template <typename T, int W, int... I>
+    TSIMD_INLINE pack<T, W> shuffle(const pack<T, W> &p, lane_indices<I...> i)
+    {
+      return permute1(p, index_pack<T, W>(i));
+    }
+
+    template <typename T, int W, int... I>
+    TSIMD_INLINE pack<T, W> shuffle(const pack<T, W> &a,
+                                    const pack<T, W> &b,
+                                    lane_indices<I...> i)
+    {
+      return permute2(a, b, index_pack<T, W>(i));
+    }
+
+    // 4-wide //
+
+    template <int I0, int I1, int I2, int I3>
+    TSIMD_INLINE vint4 shuffle(const vint4 &p,
+                               lane_indices<I0, I1, I2, I3> i)
+    {
+#if defined(__SSE__)
+      return _mm_shuffle_epi32(p.v, shuffle4_imm(I0, I1, I2, I3));
+#else
+      return permute1(p, index_pack<int, 4>(i));
+#endif
+    }
+
+    template <int I0, int I1, int I2, int I3>
+    TSIMD_INLINE vint4 shuffle(const vint4 &a,
+                               const vint4 &b,
+                               lane_indices<I0, I1, I2, I3> i)
+    {
+#if defined(__SSE__)
+      if (is_shufps_pattern(I0, I1, I2, I3)) {
+        return _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(a.v),
+                                               _mm_castsi128_ps(b.v),
+                                               shuffle4_imm(I0, I1, I2, I3)));
+      }
+#endif
+      return permute2(a, b, index_pack<int, 4>(i));
+    }
+
+    template <int I0, int I1, int I2, int I3>
+    TSIMD_INLINE vllong4 shuffle(const vllong4 &p,
+                                 lane_indices<I0, I1, I2, I3> i)
+    {
+#if defined(__AVX2__)
+      return _mm256_permute4x64_epi64(p.v, shuffle4_imm(I0, I1, I2, I3));
+#else
+      return permute1(p, index_pack<long long, 4>(i));
+#endif
+    }
+
+    // 8-wide //
+
+    template <int I0, int I1, int I2, int I3, int I4, int I5, int I6, int I7>
+    TSIMD_INLINE vint8 shuffle(const vint8 &p,
+                               lane_indices<I0, I1, I2, I3, I4, I5, I6, I7> i)
+    {
+#if defined(__AVX__)
+      if (is_in_lane_pattern(I0, I1, I2, I3, I4, I5, I6, I7)) {
+        return _mm256_castps_si256(
+            _mm256_permute_ps(_mm256_castsi256_ps(p.v),
+                              shuffle4_imm(I0, I1, I2, I3)));
+      }
+#endif
+      return permute1(p, index_pack<int, 8>(i));
+    }
+
+    template <int I0, int I1, int I2, int I3, int I4, int I5, int I6, int I7>
+    TSIMD_INLINE vint8 shuffle(const vint8 &a,
+                               const vint8 &b,
+                               lane_indices<I0, I1, I2, I3, I4, I5, I6, I7> i)
+    {
+#if defined(__AVX__)
+      if (is_in_lane_shufps_pattern(I0, I1, I2, I3, I4, I5, I6, I7)) {
+        return _mm256_castps_si256(
+            _mm256_shuffle_ps(_mm256_castsi256_ps(a.v),
+                              _mm256_castsi256_ps(b.v),
+                              shuffle4_imm(I0, I1, I2, I3)));
+      }
+#endif
+      return permute2(a, b, index_pack<int, 8>(i));
+    }
+
+  }  // namespace detail
+
+  // NOTE: lane 'i' of the result is lane 'I[i]' of 'p' (the indices are
+  //       checked at compile time), e.g. shuffle<3, 2, 1, 0>(p) reverses a
+  //       4-wide pack
+
+  template <int... I, typename T, int W>
+  TSIMD_INLINE pack<T, W> shuffle(const pack<T, W> &p)
+  {
+    static_assert(!traits::is_bool<T>::value,
+                  "tsimd::shuffle<>() can only be used with non-bool packs");
+    static_assert(sizeof...(I) == W,
+                  "tsimd::shuffle<>() takes exactly W lane indices");
+    static_assert(detail::lanes_in_range(W, I...),
+                  "tsimd::shuffle<>() lane indices must be in [0, W)");
+    return reinterpret_elements_as<T>(detail::shuffle(
+        detail::as_lane_indices(p), detail::lane_indices<I...>()));
+  }
+
+  // NOTE: two-source form, indices in [W, 2W) select lane (I[i] - W) of 'b'
+
+  template <int... I, typename T, int W>
+  TSIMD_INLINE pack<T, W> shuffle(const pack<T, W> &a, const pack<T, W> &b)
+  {
+    static_assert(!traits::is_bool<T>::value,
+                  "tsimd::shuffle<>() can only be used with non-bool packs");
+    static_assert(sizeof...(I) == W,
+                  "tsimd::shuffle<>() takes exactly W lane indices");
+    static_assert(detail::lanes_in_range(2 * W, I...),
+                  "tsimd::shuffle<>() lane indices must be in [0, 2W)");
+    return reinterpret_elements_as<T>(
+        detail::shuffle(detail::as_lane_indices(a),
+                        detail::as_lane_indices(b),
+                        detail::lane_indices<I...>()));
+  }
+
+TSIMD_NAMESPACE_END  // namespace tsimd
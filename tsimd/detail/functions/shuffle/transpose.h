@@ -0,0 +1,302 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Intel Corporation                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+#pragma once
+
+#include <type_traits>
+
+#include "../../pack.h"
+
+TSIMD_NAMESPACE_BEGIN
+
+  namespace detail {
+
+    // In-lane shuffles of 32-bit elements ////////////////////////////////////
+
+    // NOTE: these work within each 128-bit block of a register, so the same
+    //       shuffle network handles 4, 8 or 16 lanes at once
+
+#if defined(__SSE__)
+    template <int IMM>
+    TSIMD_INLINE __m128 shuffle_ps_lanes(__m128 a, __m128 b)
+    {
+      return _mm_shuffle_ps(a, b, IMM);
+    }
+
+    TSIMD_INLINE __m128 unpacklo_ps_lanes(__m128 a, __m128 b)
+    {
+      return _mm_unpacklo_ps(a, b);
+    }
+
+    TSIMD_INLINE __m128 unpackhi_ps_lanes(__m128 a, __m128 b)
+    {
+      return _mm_unpackhi_ps(a, b);
+    }
+#endif
+
+#if defined(__AVX__)
+    template <int IMM>
+    TSIMD_INLINE __m256 shuffle_ps_lanes(__m256 a, __m256 b)
+    {
+      return _mm256_shuffle_ps(a, b, IMM);
+    }
+
+    TSIMD_INLINE __m256 unpacklo_ps_lanes(__m256 a, __m256 b)
+    {
+      return _mm256_unpacklo_ps(a, b);
+    }
+
+    TSIMD_INLINE __m256 unpackhi_ps_lanes(__m256 a, __m256 b)
+    {
+      return _mm256_unpackhi_ps(a, b);
+    }
+#endif
+
+#if defined(__AVX512F__)
+    template <int IMM>
+    TSIMD_INLINE __m512 shuffle_ps_lanes(__m512 a, __m512 b)
+    {
+      return _mm512_shuffle_ps(a, b, IMM);
+    }
+
+    TSIMD_INLINE __m512 unpacklo_ps_lanes(__m512 a, __m512 b)
+    {
+      return _mm512_unpacklo_ps(a, b);
+    }
+
+    TSIMD_INLINE __m512 unpackhi_ps_lanes(__m512 a, __m512 b)
+    {
+      return _mm512_unpackhi_ps(a, b);
+    }
+#endif
+
+    // NOTE: transposes the 4x4 matrix in each 128-bit block of r0..r3
+
+#if defined(__SSE__)
+    template <typename R>
+    TSIMD_INLINE void transpose4_in_lanes(R &r0, R &r1, R &r2, R &r3)
+    {
+      const R t0 = unpacklo_ps_lanes(r0, r1);
+      const R t1 = unpacklo_ps_lanes(r2, r3);
+      const R t2 = unpackhi_ps_lanes(r0, r1);
+      const R t3 = unpackhi_ps_lanes(r2, r3);
+
+      r0 = shuffle_ps_lanes<_MM_SHUFFLE(1, 0, 1, 0)>(t0, t1);
+      r1 = shuffle_ps_lanes<_MM_SHUFFLE(3, 2, 3, 2)>(t0, t1);
+      r2 = shuffle_ps_lanes<_MM_SHUFFLE(1, 0, 1, 0)>(t2, t3);
+      r3 = shuffle_ps_lanes<_MM_SHUFFLE(3, 2, 3, 2)>(t2, t3);
+    }
+#endif
+
+    // Register transposes ////////////////////////////////////////////////////
+
+#if defined(__SSE__)
+    TSIMD_INLINE void transpose_registers(__m128 (&r)[4])
+    {
+      transpose4_in_lanes(r[0], r[1], r[2], r[3]);
+    }
+#endif
+
+#if defined(__AVX__)
+    TSIMD_INLINE void transpose_registers(__m256d (&r)[4])
+    {
+      const __m256d t0 = _mm256_unpacklo_pd(r[0], r[1]);
+      const __m256d t1 = _mm256_unpackhi_pd(r[0], r[1]);
+      const __m256d t2 = _mm256_unpacklo_pd(r[2], r[3]);
+      const __m256d t3 = _mm256_unpackhi_pd(r[2], r[3]);
+
+      r[0] = _mm256_permute2f128_pd(t0, t2, 0x20);
+      r[1] = _mm256_permute2f128_pd(t1, t3, 0x20);
+      r[2] = _mm256_permute2f128_pd(t0, t2, 0x31);
+      r[3] = _mm256_permute2f128_pd(t1, t3, 0x31);
+    }
+
+    // NOTE: transpose the 4x4 blocks of rows 0-3 and 4-7 in their 128-bit
+    //       lanes, then pair up the matching lanes of both
+
+    TSIMD_INLINE void transpose_registers(__m256 (&r)[8])
+    {
+      transpose4_in_lanes(r[0], r[1], r[2], r[3]);
+      transpose4_in_lanes(r[4], r[5], r[6], r[7]);
+
+      for (int i = 0; i < 4; ++i) {
+        const __m256 lo = r[i];
+        const __m256 hi = r[i + 4];
+        r[i]     = _mm256_permute2f128_ps(lo, hi, 0x20);
+        r[i + 4] = _mm256_permute2f128_ps(lo, hi, 0x31);
+      }
+    }
+#endif
+
+#if defined(__AVX512F__)
+    // NOTE: as the 8x8 transpose, but the 128-bit blocks of each group of
+    //       four rows are transposed in turn (two rounds of vshuff32x4)
+
+    TSIMD_INLINE void transpose_registers(__m512 (&r)[16])
+    {
+      for (int g = 0; g < 16; g += 4)
+        transpose4_in_lanes(r[g], r[g + 1], r[g + 2], r[g + 3]);
+
+      for (int k = 0; k < 4; ++k) {
+        const __m512 u0 = _mm512_shuffle_f32x4(
+            r[k], r[k + 4], _MM_SHUFFLE(1, 0, 1, 0));
+        const __m512 u1 = _mm512_shuffle_f32x4(
+            r[k + 8], r[k + 12], _MM_SHUFFLE(1, 0, 1, 0));
+        const __m512 u2 = _mm512_shuffle_f32x4(
+            r[k], r[k + 4], _MM_SHUFFLE(3, 2, 3, 2));
+        const __m512 u3 = _mm512_shuffle_f32x4(
+            r[k + 8], r[k + 12], _MM_SHUFFLE(3, 2, 3, 2));
+
+        r[k]      = _mm512_shuffle_f32x4(u0, u1, _MM_SHUFFLE(2, 0, 2, 0));
+        r[k + 4]  = _mm512_shuffle_f32x4(u0, u1, _MM_SHUFFLE(3, 1, 3, 1));
+        r[k + 8]  = _mm512_shuffle_f32x4(u2, u3, _MM_SHUFFLE(2, 0, 2, 0));
+        r[k + 12] = _mm512_shuffle_f32x4(u2, u3, _MM_SHUFFLE(3, 1, 3, 1));
+      }
+    }
+#endif
+
+    // transpose_rows() ///////////////////////////////////////////////////////
+
+    enum class transpose_path
+    {
+      lanes,      // scalar loop over the lanes
+      registers,  // shuffle network on the native registers
+      halves      // transposes of the four W/2 x W/2 blocks
+    };
+
+    template <transpose_path PATH>
+    using transpose_path_t = std::integral_constant<transpose_path, PATH>;
+
+    template <typename T, int W>
+    struct has_transpose_registers
+    {
+      static constexpr bool value =
+#if defined(__SSE__)
+          (sizeof(T) == 4 && W == 4) ||
+#endif
+#if defined(__AVX__)
+          (sizeof(T) == 4 && W == 8) || (sizeof(T) == 8 && W == 4) ||
+#endif
+#if defined(__AVX512F__)
+          (sizeof(T) == 4 && W == 16) ||
+#endif
+          false;
+    };
+
+    template <typename T, int W>
+    struct transpose_path_for
+    {
+      static constexpr transpose_path value =
+          has_transpose_registers<T, W>::value
+              ? transpose_path::registers
+              : (W >= 8 ? transpose_path::halves : transpose_path::lanes);
+    };
+
+    template <typename T, int W>
+    TSIMD_INLINE void transpose_rows(pack<T, W> (&rows)[W],
+                                     transpose_path_t<transpose_path::lanes>)
+    {
+      for (int i = 0; i < W; ++i) {
+        for (int j = i + 1; j < W; ++j) {
+          const T tmp = rows[i][j];
+          rows[i][j]  = rows[j][i];
+          rows[j][i]  = tmp;
+        }
+      }
+    }
+
+    template <typename T, int W>
+    TSIMD_INLINE void transpose_rows(
+        pack<T, W> (&rows)[W], transpose_path_t<transpose_path::registers>)
+    {
+      using F = typename std::conditional<sizeof(T) == 4, float, double>::type;
+      using R = typename pack<F, W>::intrinsic_t;
+
+      R r[W];
+
+      for (int i = 0; i < W; ++i)
+        r[i] = reinterpret_elements_as<F>(rows[i]).v;
+
+      transpose_registers(r);
+
+      for (int i = 0; i < W; ++i)
+        rows[i] = reinterpret_elements_as<T>(pack<F, W>(r[i]));
+    }
+
+    template <typename T, int W>
+    TSIMD_INLINE void transpose_rows(pack<T, W> (&rows)[W],
+                                     transpose_path_t<transpose_path::halves>);
+
+    template <typename T, int W>
+    TSIMD_INLINE void transpose_rows(pack<T, W> (&rows)[W])
+    {
+      transpose_rows(
+          rows,
+          transpose_path_t<transpose_path_for<T, W>::value>());
+    }
+
+    // NOTE: with rows = [A B; C D] in W/2 x W/2 blocks, the result is
+    //       [A' C'; B' D'] for the transposed blocks A', B', C' and D'
+
+    template <typename T, int W>
+    TSIMD_INLINE void transpose_rows(pack<T, W> (&rows)[W],
+                                     transpose_path_t<transpose_path::halves>)
+    {
+      constexpr int H = W / 2;
+      using half_t    = pack<T, H>;
+
+      half_t a[H], b[H], c[H], d[H];
+
+      for (int i = 0; i < H; ++i) {
+        a[i] = half_t(rows[i].vl);
+        b[i] = half_t(rows[i].vh);
+        c[i] = half_t(rows[i + H].vl);
+        d[i] = half_t(rows[i + H].vh);
+      }
+
+      transpose_rows(a);
+      transpose_rows(b);
+      transpose_rows(c);
+      transpose_rows(d);
+
+      for (int i = 0; i < H; ++i) {
+        rows[i]     = pack<T, W>(a[i], c[i]);
+        rows[i + H] = pack<T, W>(b[i], d[i]);
+      }
+    }
+
+  }  // namespace detail
+
+  // NOTE: transposes the W x W matrix held in 'rows' in place, so lane 'j' of
+  //       rows[i] ends up in lane 'i' of rows[j]
+
+  template <typename T, int W>
+  TSIMD_INLINE void transpose(pack<T, W> (&rows)[W])
+  {
+    static_assert(!traits::is_bool<T>::value,
+                  "tsimd::transpose() can only be used with non-bool packs");
+    detail::transpose_rows(rows);
+  }
+
+TSIMD_NAMESPACE_END  // namespace tsimd
@@ -0,0 +1,154 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Intel Corporation                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+
+#include "config.h"
+
+TSIMD_NAMESPACE_BEGIN
+
+  namespace detail {
+
+    // IEEE half <--> float bit conversions ///////////////////////////////////
+
+    TSIMD_INLINE float half_bits_to_float(uint16_t h)
+    {
+#if defined(__F16C__)
+      return _cvtsh_ss(h);
+#else
+      const uint32_t sign = uint32_t(h & 0x8000) << 16;
+      const uint32_t exp  = (h >> 10) & 0x1F;
+      const uint32_t mant = h & 0x3FF;
+
+      uint32_t bits;
+
+      if (exp == 0x1F)
+        bits = sign | 0x7F800000 | (mant << 13);
+      else if (exp != 0)
+        bits = sign | ((exp + 112) << 23) | (mant << 13);
+      else if (mant == 0)
+        bits = sign;
+      else {
+        // subnormal: the value is exactly mant * 2^-24
+        const float f = float(mant) * 5.9604644775390625e-8f;
+        return sign ? -f : f;
+      }
+
+      float f;
+      std::memcpy(&f, &bits, sizeof(f));
+      return f;
+#endif
+    }
+
+    // NOTE: rounds to nearest even, like _mm_cvtps_ph() with
+    //       _MM_FROUND_TO_NEAREST_INT
+    TSIMD_INLINE uint16_t float_to_half_bits(float f)
+    {
+#if defined(__F16C__)
+      return _cvtss_sh(f, _MM_FROUND_TO_NEAREST_INT);
+#else
+      uint32_t x;
+      std::memcpy(&x, &f, sizeof(x));
+
+      const uint32_t sign = (x >> 16) & 0x8000;
+      const uint32_t absx = x & 0x7FFFFFFF;
+
+      // inf/nan (nans stay quiet)
+      if (absx >= 0x7F800000) {
+        const uint32_t nan = absx > 0x7F800000 ? 0x200 | (absx >> 13) : 0;
+        return uint16_t(sign | 0x7C00 | (nan & 0x3FF));
+      }
+
+      // >= 65520 rounds up past the largest half
+      if (absx >= 0x477FF000)
+        return uint16_t(sign | 0x7C00);
+
+      // below the smallest normal half, round into a subnormal
+      if (absx < 0x38800000) {
+        const uint32_t e = absx >> 23;
+
+        if (e < 102)
+          return uint16_t(sign);
+
+        const uint32_t m     = (absx & 0x7FFFFF) | 0x800000;
+        const uint32_t shift = 126 - e;
+        const uint32_t rem   = m & ((1u << shift) - 1);
+        const uint32_t tie   = 1u << (shift - 1);
+
+        uint32_t h = m >> shift;
+        if (rem > tie || (rem == tie && (h & 1)))
+          ++h;
+
+        return uint16_t(sign | h);
+      }
+
+      // rebias the exponent, a mantissa carry correctly rolls into it
+      const uint32_t rem = absx & 0x1FFF;
+
+      uint32_t h = (absx - 0x38000000) >> 13;
+      if (rem > 0x1000 || (rem == 0x1000 && (h & 1)))
+        ++h;
+
+      return uint16_t(sign | h);
+#endif
+    }
+
+  }  // namespace detail
+
+  // 16-bit float storage type ////////////////////////////////////////////////
+
+  // NOTE: this type is only a storage format, math is done on vfloat packs
+  //       after converting with load<vfloatN>(const half_t *)
+  struct half_t
+  {
+    half_t()               = default;
+    half_t(const half_t &) = default;
+    half_t(half_t &&)      = default;
+    half_t &operator=(const half_t &) = default;
+    half_t &operator=(half_t &&) = default;
+
+    TSIMD_INLINE half_t(float f) noexcept
+        : bits(detail::float_to_half_bits(f))
+    {
+    }
+
+    TSIMD_INLINE operator float() const noexcept
+    {
+      return detail::half_bits_to_float(bits);
+    }
+
+    uint16_t bits;
+  };
+
+  TSIMD_INLINE std::ostream &operator<<(std::ostream &o, const half_t &h)
+  {
+    o << static_cast<float>(h);
+    return o;
+  }
+
+TSIMD_NAMESPACE_END  // namespace tsimd
\ No newline at end of file
@@ -26,7 +26,7 @@
 
 #include "../../pack.h"
 
-namespace tsimd {
+TSIMD_NAMESPACE_BEGIN
 
   // 1-wide //
 
@@ -42,6 +42,8 @@ namespace tsimd {
   {
 #if defined(__SSE__)
     return _mm_div_ps(p1, p2);
+#elif TSIMD_VECTOR_EXTENSIONS
+    return detail::from_vext<vfloat4>(detail::vext(p1) / detail::vext(p2));
 #else
     vfloat4 result;
 
@@ -67,12 +69,18 @@ namespace tsimd {
 
   TSIMD_INLINE vdouble4 operator/(const vdouble4 &p1, const vdouble4 &p2)
   {
+#if defined(__AVX__)
+    return _mm256_div_pd(p1, p2);
+#elif TSIMD_VECTOR_EXTENSIONS
+    return detail::from_vext<vdouble4>(detail::vext(p1) / detail::vext(p2));
+#else
     vdouble4 result;
 
     for (int i = 0; i < 4; ++i)
       result[i] = (p1[i] / p2[i]);
 
     return result;
+#endif
   }
 
   TSIMD_INLINE vllong4 operator/(const vllong4 &p1, const vllong4 &p2)
@@ -107,8 +115,12 @@ namespace tsimd {
 
   TSIMD_INLINE vdouble8 operator/(const vdouble8 &p1, const vdouble8 &p2)
   {
+#if defined(__AVX512F__)
+    return _mm512_div_pd(p1, p2);
+#else
     return vdouble8(vdouble4(p1.vl) / vdouble4(p2.vl),
                     vdouble4(p1.vh) / vdouble4(p2.vh));
+#endif
   }
 
   TSIMD_INLINE vllong8 operator/(const vllong8 &p1, const vllong8 &p2)
@@ -146,6 +158,33 @@ namespace tsimd {
                     vllong8(p1.vh) / vllong8(p2.vh));
   }
 
+  // wide //
+
+  template <typename T,
+            int W,
+            typename = traits::is_wide_pack_t<T, W>,
+            typename = void>
+  TSIMD_INLINE pack<T, W> operator/(const pack<T, W> &p1, const pack<T, W> &p2)
+  {
+    return pack<T, W>(p1.vl / p2.vl, p1.vh / p2.vh);
+  }
+
+  // unsigned //
+
+  template <typename T, int W, typename = traits::is_unsigned_pack_t<T, W>>
+  TSIMD_INLINE pack<T, W> operator/(const pack<T, W> &p1, const pack<T, W> &p2)
+  {
+    pack<T, W> result;
+
+#if TSIMD_USE_OPENMP
+#  pragma omp simd
+#endif
+    for (int i = 0; i < W; ++i)
+      result[i] = (p1[i] / p2[i]);
+
+    return result;
+  }
+
   // Inferred pack-scalar operators ///////////////////////////////////////////
 
   template <typename T,
@@ -183,4 +222,4 @@ namespace tsimd {
     return p1 = (p1 / pack<T, W>(v));
   }
 
-}  // namespace tsimd
+TSIMD_NAMESPACE_END  // namespace tsimd
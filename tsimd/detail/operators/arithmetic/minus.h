@@ -26,7 +26,7 @@
 
 #include "../../pack.h"
 
-namespace tsimd {
+TSIMD_NAMESPACE_BEGIN
 
   // 1-wide //
 
@@ -42,6 +42,8 @@ namespace tsimd {
   {
 #if defined(__SSE__)
     return _mm_sub_ps(p1, p2);
+#elif TSIMD_VECTOR_EXTENSIONS
+    return detail::from_vext<vfloat4>(detail::vext(p1) - detail::vext(p2));
 #else
     vfloat4 result;
 
@@ -56,6 +58,8 @@ namespace tsimd {
   {
 #if defined(__SSE__)
     return _mm_sub_epi32(p1, p2);
+#elif TSIMD_VECTOR_EXTENSIONS
+    return detail::from_vext<vint4>(detail::vext(p1) - detail::vext(p2));
 #else
     vint4 result;
 
@@ -68,22 +72,36 @@ namespace tsimd {
 
   TSIMD_INLINE vdouble4 operator-(const vdouble4 &p1, const vdouble4 &p2)
   {
+#if defined(__AVX__)
+    return _mm256_sub_pd(p1, p2);
+#elif TSIMD_VECTOR_EXTENSIONS
+    return detail::from_vext<vdouble4>(detail::vext(p1) - detail::vext(p2));
+#else
     vdouble4 result;
 
     for (int i = 0; i < 4; ++i)
       result[i] = (p1[i] - p2[i]);
 
     return result;
+#endif
   }
 
   TSIMD_INLINE vllong4 operator-(const vllong4 &p1, const vllong4 &p2)
   {
+#if defined(__AVX2__)
+    return _mm256_sub_epi64(p1, p2);
+#elif defined(__AVX__)
+    return vllong4(_mm_sub_epi64(p1.vl, p2.vl), _mm_sub_epi64(p1.vh, p2.vh));
+#elif TSIMD_VECTOR_EXTENSIONS
+    return detail::from_vext<vllong4>(detail::vext(p1) - detail::vext(p2));
+#else
     vllong4 result;
 
     for (int i = 0; i < 4; ++i)
       result[i] = (p1[i] - p2[i]);
 
     return result;
+#endif
   }
 
   // 8-wide //
@@ -111,14 +129,22 @@ namespace tsimd {
 
   TSIMD_INLINE vdouble8 operator-(const vdouble8 &p1, const vdouble8 &p2)
   {
+#if defined(__AVX512F__)
+    return _mm512_sub_pd(p1, p2);
+#else
     return vdouble8(vdouble4(p1.vl) - vdouble4(p2.vl),
                     vdouble4(p1.vh) - vdouble4(p2.vh));
+#endif
   }
 
   TSIMD_INLINE vllong8 operator-(const vllong8 &p1, const vllong8 &p2)
   {
+#if defined(__AVX512F__)
+    return _mm512_sub_epi64(p1, p2);
+#else
     return vllong8(vllong4(p1.vl) - vllong4(p2.vl),
                    vllong4(p1.vh) - vllong4(p2.vh));
+#endif
   }
 
   // 16-wide //
@@ -154,6 +180,99 @@ namespace tsimd {
                     vllong8(p1.vh) - vllong8(p2.vh));
   }
 
+  // 8/16-bit //
+
+  TSIMD_INLINE vschar16 operator-(const vschar16 &p1, const vschar16 &p2)
+  {
+#if defined(__SSE__)
+    return _mm_sub_epi8(p1, p2);
+#elif TSIMD_VECTOR_EXTENSIONS
+    return detail::from_vext<vschar16>(detail::vext(p1) - detail::vext(p2));
+#else
+    vschar16 result;
+
+    for (int i = 0; i < 16; ++i)
+      result[i] = (p1[i] - p2[i]);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vshort8 operator-(const vshort8 &p1, const vshort8 &p2)
+  {
+#if defined(__SSE__)
+    return _mm_sub_epi16(p1, p2);
+#elif TSIMD_VECTOR_EXTENSIONS
+    return detail::from_vext<vshort8>(detail::vext(p1) - detail::vext(p2));
+#else
+    vshort8 result;
+
+    for (int i = 0; i < 8; ++i)
+      result[i] = (p1[i] - p2[i]);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vschar32 operator-(const vschar32 &p1, const vschar32 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_sub_epi8(p1, p2);
+#else
+    return vschar32(vschar16(p1.vl) - vschar16(p2.vl),
+                    vschar16(p1.vh) - vschar16(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vshort16 operator-(const vshort16 &p1, const vshort16 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_sub_epi16(p1, p2);
+#else
+    return vshort16(vshort8(p1.vl) - vshort8(p2.vl),
+                    vshort8(p1.vh) - vshort8(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vschar64 operator-(const vschar64 &p1, const vschar64 &p2)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_sub_epi8(p1, p2);
+#else
+    return vschar64(vschar32(p1.vl) - vschar32(p2.vl),
+                    vschar32(p1.vh) - vschar32(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vshort32 operator-(const vshort32 &p1, const vshort32 &p2)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_sub_epi16(p1, p2);
+#else
+    return vshort32(vshort16(p1.vl) - vshort16(p2.vl),
+                    vshort16(p1.vh) - vshort16(p2.vh));
+#endif
+  }
+
+  // wide //
+
+  template <typename T,
+            int W,
+            typename = traits::is_wide_pack_t<T, W>,
+            typename = void>
+  TSIMD_INLINE pack<T, W> operator-(const pack<T, W> &p1, const pack<T, W> &p2)
+  {
+    return pack<T, W>(p1.vl - p2.vl, p1.vh - p2.vh);
+  }
+
+  // unsigned (same bits as signed) //
+
+  template <typename T, int W, typename = traits::is_unsigned_pack_t<T, W>>
+  TSIMD_INLINE pack<T, W> operator-(const pack<T, W> &p1, const pack<T, W> &p2)
+  {
+    return detail::as_unsigned(detail::as_signed(p1) - detail::as_signed(p2));
+  }
+
   // Inferred pack-scalar operators ///////////////////////////////////////////
 
   template <typename T,
@@ -191,4 +310,4 @@ namespace tsimd {
     return p1 = (p1 - pack<T, W>(v));
   }
 
-}  // namespace tsimd
+TSIMD_NAMESPACE_END  // namespace tsimd
@@ -26,7 +26,7 @@
 
 #include "../../pack.h"
 
-namespace tsimd {
+TSIMD_NAMESPACE_BEGIN
 
   template <typename T, int W>
   TSIMD_INLINE pack<T, W> operator-(const pack<T, W> &p)
@@ -42,4 +42,4 @@ namespace tsimd {
     return result;
   }
 
-}  // namespace tsimd
+TSIMD_NAMESPACE_END  // namespace tsimd
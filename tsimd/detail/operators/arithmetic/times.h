@@ -26,7 +26,50 @@
 
 #include "../../pack.h"
 
-namespace tsimd {
+TSIMD_NAMESPACE_BEGIN
+
+  namespace detail {
+
+    // There is no 64-bit low multiply before AVX-512DQ, so build it from
+    // 32-bit partial products: lo(a)*lo(b) + ((hi(a)*lo(b) + lo(a)*hi(b)) << 32)
+
+#if defined(__SSE4_1__)
+    TSIMD_INLINE __m128i mullo_epi64(__m128i a, __m128i b)
+    {
+      const __m128i a_hi  = _mm_srli_epi64(a, 32);
+      const __m128i b_hi  = _mm_srli_epi64(b, 32);
+      const __m128i lo    = _mm_mul_epu32(a, b);
+      const __m128i cross = _mm_add_epi64(_mm_mul_epu32(a_hi, b),
+                                          _mm_mul_epu32(a, b_hi));
+      return _mm_add_epi64(lo, _mm_slli_epi64(cross, 32));
+    }
+#endif
+
+#if defined(__AVX2__)
+    TSIMD_INLINE __m256i mullo_epi64(__m256i a, __m256i b)
+    {
+      const __m256i a_hi  = _mm256_srli_epi64(a, 32);
+      const __m256i b_hi  = _mm256_srli_epi64(b, 32);
+      const __m256i lo    = _mm256_mul_epu32(a, b);
+      const __m256i cross = _mm256_add_epi64(_mm256_mul_epu32(a_hi, b),
+                                             _mm256_mul_epu32(a, b_hi));
+      return _mm256_add_epi64(lo, _mm256_slli_epi64(cross, 32));
+    }
+#endif
+
+#if defined(__AVX512F__)
+    TSIMD_INLINE __m512i mullo_epi64(__m512i a, __m512i b)
+    {
+      const __m512i a_hi  = _mm512_srli_epi64(a, 32);
+      const __m512i b_hi  = _mm512_srli_epi64(b, 32);
+      const __m512i lo    = _mm512_mul_epu32(a, b);
+      const __m512i cross = _mm512_add_epi64(_mm512_mul_epu32(a_hi, b),
+                                             _mm512_mul_epu32(a, b_hi));
+      return _mm512_add_epi64(lo, _mm512_slli_epi64(cross, 32));
+    }
+#endif
+
+  }  // namespace detail
 
   // 1-wide //
 
@@ -42,6 +85,8 @@ namespace tsimd {
   {
 #if defined(__SSE__)
     return _mm_mul_ps(p1, p2);
+#elif TSIMD_VECTOR_EXTENSIONS
+    return detail::from_vext<vfloat4>(detail::vext(p1) * detail::vext(p2));
 #else
     vfloat4 result;
 
@@ -56,6 +101,8 @@ namespace tsimd {
   {
 #if defined(__SSE4_1__)
     return _mm_mullo_epi32(p1, p2);
+#elif TSIMD_VECTOR_EXTENSIONS
+    return detail::from_vext<vint4>(detail::vext(p1) * detail::vext(p2));
 #else
     vint4 result;
 
@@ -68,22 +115,39 @@ namespace tsimd {
 
   TSIMD_INLINE vdouble4 operator*(const vdouble4 &p1, const vdouble4 &p2)
   {
+#if defined(__AVX__)
+    return _mm256_mul_pd(p1, p2);
+#elif TSIMD_VECTOR_EXTENSIONS
+    return detail::from_vext<vdouble4>(detail::vext(p1) * detail::vext(p2));
+#else
     vdouble4 result;
 
     for (int i = 0; i < 4; ++i)
       result[i] = (p1[i] * p2[i]);
 
     return result;
+#endif
   }
 
   TSIMD_INLINE vllong4 operator*(const vllong4 &p1, const vllong4 &p2)
   {
+#if defined(__AVX512DQ__) && defined(__AVX512VL__)
+    return _mm256_mullo_epi64(p1, p2);
+#elif defined(__AVX2__)
+    return detail::mullo_epi64(p1, p2);
+#elif defined(__AVX__)
+    return vllong4(detail::mullo_epi64(p1.vl, p2.vl),
+                   detail::mullo_epi64(p1.vh, p2.vh));
+#elif TSIMD_VECTOR_EXTENSIONS
+    return detail::from_vext<vllong4>(detail::vext(p1) * detail::vext(p2));
+#else
     vllong4 result;
 
     for (int i = 0; i < 4; ++i)
       result[i] = (p1[i] * p2[i]);
 
     return result;
+#endif
   }
 
   // 8-wide //
@@ -111,14 +175,24 @@ namespace tsimd {
 
   TSIMD_INLINE vdouble8 operator*(const vdouble8 &p1, const vdouble8 &p2)
   {
+#if defined(__AVX512F__)
+    return _mm512_mul_pd(p1, p2);
+#else
     return vdouble8(vdouble4(p1.vl) * vdouble4(p2.vl),
                     vdouble4(p1.vh) * vdouble4(p2.vh));
+#endif
   }
 
   TSIMD_INLINE vllong8 operator*(const vllong8 &p1, const vllong8 &p2)
   {
+#if defined(__AVX512DQ__)
+    return _mm512_mullo_epi64(p1, p2);
+#elif defined(__AVX512F__)
+    return detail::mullo_epi64(p1, p2);
+#else
     return vllong8(vllong4(p1.vl) * vllong4(p2.vl), 
                    vllong4(p1.vh) * vllong4(p2.vh));
+#endif
   }
 
   // 16-wide //
@@ -154,6 +228,113 @@ namespace tsimd {
                     vllong8(p1.vh) * vllong8(p2.vh));
   }
 
+  // 8/16-bit //
+
+  TSIMD_INLINE vschar16 operator*(const vschar16 &p1, const vschar16 &p2)
+  {
+#if defined(__SSE__)
+    // NOTE: there is no 8-bit multiply, so multiply the even and odd
+    //       bytes as 16-bit lanes and keep the low byte of each
+    const __m128i even = _mm_mullo_epi16(p1, p2);
+    const __m128i odd  = _mm_mullo_epi16(_mm_srli_epi16(p1, 8),
+                                         _mm_srli_epi16(p2, 8));
+    return _mm_or_si128(_mm_and_si128(even, _mm_set1_epi16(0x00FF)),
+                        _mm_slli_epi16(odd, 8));
+#elif TSIMD_VECTOR_EXTENSIONS
+    return detail::from_vext<vschar16>(detail::vext(p1) * detail::vext(p2));
+#else
+    vschar16 result;
+
+    for (int i = 0; i < 16; ++i)
+      result[i] = (p1[i] * p2[i]);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vshort8 operator*(const vshort8 &p1, const vshort8 &p2)
+  {
+#if defined(__SSE__)
+    return _mm_mullo_epi16(p1, p2);
+#elif TSIMD_VECTOR_EXTENSIONS
+    return detail::from_vext<vshort8>(detail::vext(p1) * detail::vext(p2));
+#else
+    vshort8 result;
+
+    for (int i = 0; i < 8; ++i)
+      result[i] = (p1[i] * p2[i]);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vschar32 operator*(const vschar32 &p1, const vschar32 &p2)
+  {
+#if defined(__AVX2__)
+    const __m256i even = _mm256_mullo_epi16(p1, p2);
+    const __m256i odd  = _mm256_mullo_epi16(_mm256_srli_epi16(p1, 8),
+                                            _mm256_srli_epi16(p2, 8));
+    return _mm256_or_si256(_mm256_and_si256(even, _mm256_set1_epi16(0x00FF)),
+                           _mm256_slli_epi16(odd, 8));
+#else
+    return vschar32(vschar16(p1.vl) * vschar16(p2.vl),
+                    vschar16(p1.vh) * vschar16(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vshort16 operator*(const vshort16 &p1, const vshort16 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_mullo_epi16(p1, p2);
+#else
+    return vshort16(vshort8(p1.vl) * vshort8(p2.vl),
+                    vshort8(p1.vh) * vshort8(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vschar64 operator*(const vschar64 &p1, const vschar64 &p2)
+  {
+#if defined(__AVX512BW__)
+    const __m512i even = _mm512_mullo_epi16(p1, p2);
+    const __m512i odd  = _mm512_mullo_epi16(_mm512_srli_epi16(p1, 8),
+                                            _mm512_srli_epi16(p2, 8));
+    return _mm512_or_si512(_mm512_and_si512(even, _mm512_set1_epi16(0x00FF)),
+                           _mm512_slli_epi16(odd, 8));
+#else
+    return vschar64(vschar32(p1.vl) * vschar32(p2.vl),
+                    vschar32(p1.vh) * vschar32(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vshort32 operator*(const vshort32 &p1, const vshort32 &p2)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_mullo_epi16(p1, p2);
+#else
+    return vshort32(vshort16(p1.vl) * vshort16(p2.vl),
+                    vshort16(p1.vh) * vshort16(p2.vh));
+#endif
+  }
+
+  // wide //
+
+  template <typename T,
+            int W,
+            typename = traits::is_wide_pack_t<T, W>,
+            typename = void>
+  TSIMD_INLINE pack<T, W> operator*(const pack<T, W> &p1, const pack<T, W> &p2)
+  {
+    return pack<T, W>(p1.vl * p2.vl, p1.vh * p2.vh);
+  }
+
+  // unsigned (same bits as signed) //
+
+  template <typename T, int W, typename = traits::is_unsigned_pack_t<T, W>>
+  TSIMD_INLINE pack<T, W> operator*(const pack<T, W> &p1, const pack<T, W> &p2)
+  {
+    return detail::as_unsigned(detail::as_signed(p1) * detail::as_signed(p2));
+  }
+
   // Inferred pack-scalar operators ///////////////////////////////////////////
 
   template <typename T,
@@ -191,4 +372,4 @@ namespace tsimd {
     return p1 = (p1 * pack<T, W>(v));
   }
 
-}  // namespace tsimd
+TSIMD_NAMESPACE_END  // namespace tsimd
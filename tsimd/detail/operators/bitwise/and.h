@@ -26,7 +26,7 @@
 
 #include "../../pack.h"
 
-namespace tsimd {
+TSIMD_NAMESPACE_BEGIN
 
   // binary operator&() ///////////////////////////////////////////////////////
 
@@ -44,6 +44,8 @@ namespace tsimd {
   {
 #if defined(__SSE__)
     return _mm_and_si128(p1, p2);
+#elif TSIMD_VECTOR_EXTENSIONS
+    return detail::from_vext<vint4>(detail::vext(p1) & detail::vext(p2));
 #else
     vint4 result;
 
@@ -56,8 +58,12 @@ namespace tsimd {
 
   TSIMD_INLINE vboolf4 operator&(const vboolf4 &p1, const vboolf4 &p2)
   {
-#if defined(__SSE__)
+#if defined(__AVX512VL__)
+    return _mm512_kand(p1, p2);
+#elif defined(__SSE__)
     return _mm_and_ps(p1, p2);
+#elif TSIMD_VECTOR_EXTENSIONS
+    return detail::from_vext<vboolf4>(detail::vext(p1) & detail::vext(p2));
 #else
     vboolf4 result;
 
@@ -70,22 +76,39 @@ namespace tsimd {
   
   TSIMD_INLINE vllong4 operator&(const vllong4 &p1, const vllong4 &p2)
   {
+#if defined(__AVX2__)
+    return _mm256_and_si256(p1, p2);
+#elif defined(__AVX__)
+    return _mm256_castpd_si256(
+        _mm256_and_pd(_mm256_castsi256_pd(p1), _mm256_castsi256_pd(p2)));
+#elif TSIMD_VECTOR_EXTENSIONS
+    return detail::from_vext<vllong4>(detail::vext(p1) & detail::vext(p2));
+#else
     vllong4 result;
 
     for (int i = 0; i < 4; ++i)
       result[i] = p1[i] & p2[i];
 
     return result;
+#endif
   }
 
   TSIMD_INLINE vboold4 operator&(const vboold4 &p1, const vboold4 &p2)
   {
+#if defined(__AVX512VL__)
+    return _mm512_kand(p1, p2);
+#elif defined(__AVX__)
+    return _mm256_and_pd(p1, p2);
+#elif TSIMD_VECTOR_EXTENSIONS
+    return detail::from_vext<vboold4>(detail::vext(p1) & detail::vext(p2));
+#else
     vboold4 result;
 
     for (int i = 0; i < 4; ++i)
       result[i] = p1[i] & p2[i];
 
     return result;
+#endif
   }
 
   // 8-wide //
@@ -104,7 +127,9 @@ namespace tsimd {
 
   TSIMD_INLINE vboolf8 operator&(const vboolf8 &p1, const vboolf8 &p2)
   {
-#if defined(__AVX512F__) || defined(__AVX2__) || defined(__AVX__)
+#if defined(__AVX512VL__)
+    return _mm512_kand(p1, p2);
+#elif defined(__AVX512F__) || defined(__AVX2__) || defined(__AVX__)
     return _mm256_and_ps(p1, p2);
 #else
     return vboolf8(vboolf4(p1.vl) & vboolf4(p2.vl),
@@ -114,14 +139,22 @@ namespace tsimd {
 
   TSIMD_INLINE vllong8 operator&(const vllong8 &p1, const vllong8 &p2)
   {
+#if defined(__AVX512F__)
+    return _mm512_and_epi64(p1, p2);
+#else
     return vllong8(vllong4(p1.vl) & vllong4(p2.vl),
                    vllong4(p1.vh) & vllong4(p2.vh));
+#endif
   }
 
   TSIMD_INLINE vboold8 operator&(const vboold8 &p1, const vboold8 &p2)
   {
+#if defined(__AVX512F__)
+    return _mm512_kand(p1, p2);
+#else
     return vboold8(vboold4(p1.vl) & vboold4(p2.vl),
                    vboold4(p1.vh) & vboold4(p2.vh));
+#endif
   }
 
   // 16-wide //
@@ -153,8 +186,191 @@ namespace tsimd {
 
   TSIMD_INLINE vboold16 operator&(const vboold16 &p1, const vboold16 &p2)
   {
+#if defined(__AVX512F__)
+    return _mm512_kand(p1, p2);
+#else
     return vboold16(vboold8(p1.vl) & vboold8(p2.vl),
                     vboold8(p1.vh) & vboold8(p2.vh));
+#endif
+  }
+
+  // 8/16-bit //
+
+  TSIMD_INLINE vschar16 operator&(const vschar16 &p1, const vschar16 &p2)
+  {
+#if defined(__SSE__)
+    return _mm_and_si128(p1, p2);
+#elif TSIMD_VECTOR_EXTENSIONS
+    return detail::from_vext<vschar16>(detail::vext(p1) & detail::vext(p2));
+#else
+    vschar16 result;
+
+    for (int i = 0; i < 16; ++i)
+      result[i] = p1[i] & p2[i];
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vshort8 operator&(const vshort8 &p1, const vshort8 &p2)
+  {
+#if defined(__SSE__)
+    return _mm_and_si128(p1, p2);
+#elif TSIMD_VECTOR_EXTENSIONS
+    return detail::from_vext<vshort8>(detail::vext(p1) & detail::vext(p2));
+#else
+    vshort8 result;
+
+    for (int i = 0; i < 8; ++i)
+      result[i] = p1[i] & p2[i];
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vschar32 operator&(const vschar32 &p1, const vschar32 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_and_si256(p1, p2);
+#else
+    return vschar32(vschar16(p1.vl) & vschar16(p2.vl),
+                    vschar16(p1.vh) & vschar16(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vshort16 operator&(const vshort16 &p1, const vshort16 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_and_si256(p1, p2);
+#else
+    return vshort16(vshort8(p1.vl) & vshort8(p2.vl),
+                    vshort8(p1.vh) & vshort8(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vschar64 operator&(const vschar64 &p1, const vschar64 &p2)
+  {
+#if defined(__AVX512F__)
+    return _mm512_and_si512(p1, p2);
+#else
+    return vschar64(vschar32(p1.vl) & vschar32(p2.vl),
+                    vschar32(p1.vh) & vschar32(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vshort32 operator&(const vshort32 &p1, const vshort32 &p2)
+  {
+#if defined(__AVX512F__)
+    return _mm512_and_si512(p1, p2);
+#else
+    return vshort32(vshort16(p1.vl) & vshort16(p2.vl),
+                    vshort16(p1.vh) & vshort16(p2.vh));
+#endif
+  }
+
+  // 8/16-bit masks //
+
+  TSIMD_INLINE vboolc16 operator&(const vboolc16 &p1, const vboolc16 &p2)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    return _mm512_kand(p1, p2);
+#elif defined(__SSE__)
+    return _mm_and_si128(p1, p2);
+#elif TSIMD_VECTOR_EXTENSIONS
+    return detail::from_vext<vboolc16>(detail::vext(p1) & detail::vext(p2));
+#else
+    vboolc16 result;
+
+    for (int i = 0; i < 16; ++i)
+      result[i] = p1[i] & p2[i];
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vbools8 operator&(const vbools8 &p1, const vbools8 &p2)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    return _mm512_kand(p1, p2);
+#elif defined(__SSE__)
+    return _mm_and_si128(p1, p2);
+#elif TSIMD_VECTOR_EXTENSIONS
+    return detail::from_vext<vbools8>(detail::vext(p1) & detail::vext(p2));
+#else
+    vbools8 result;
+
+    for (int i = 0; i < 8; ++i)
+      result[i] = p1[i] & p2[i];
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vboolc32 operator&(const vboolc32 &p1, const vboolc32 &p2)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    return _kand_mask32(p1, p2);
+#elif defined(__AVX2__)
+    return _mm256_and_si256(p1, p2);
+#else
+    return vboolc32(vboolc16(p1.vl) & vboolc16(p2.vl),
+                    vboolc16(p1.vh) & vboolc16(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vbools16 operator&(const vbools16 &p1, const vbools16 &p2)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    return _mm512_kand(p1, p2);
+#elif defined(__AVX2__)
+    return _mm256_and_si256(p1, p2);
+#else
+    return vbools16(vbools8(p1.vl) & vbools8(p2.vl),
+                    vbools8(p1.vh) & vbools8(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vboolc64 operator&(const vboolc64 &p1, const vboolc64 &p2)
+  {
+#if defined(__AVX512BW__)
+    return _kand_mask64(p1, p2);
+#elif defined(__AVX512F__)
+    return _mm512_and_si512(p1, p2);
+#else
+    return vboolc64(vboolc32(p1.vl) & vboolc32(p2.vl),
+                    vboolc32(p1.vh) & vboolc32(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vbools32 operator&(const vbools32 &p1, const vbools32 &p2)
+  {
+#if defined(__AVX512BW__)
+    return _kand_mask32(p1, p2);
+#elif defined(__AVX512F__)
+    return _mm512_and_si512(p1, p2);
+#else
+    return vbools32(vbools16(p1.vl) & vbools16(p2.vl),
+                    vbools16(p1.vh) & vbools16(p2.vh));
+#endif
+  }
+
+  // wide //
+
+  template <typename T,
+            int W,
+            typename = traits::is_wide_pack_t<T, W>,
+            typename = void>
+  TSIMD_INLINE pack<T, W> operator&(const pack<T, W> &p1, const pack<T, W> &p2)
+  {
+    return pack<T, W>(p1.vl & p2.vl, p1.vh & p2.vh);
+  }
+
+  // unsigned (same bits as signed) //
+
+  template <typename T, int W, typename = traits::is_unsigned_pack_t<T, W>>
+  TSIMD_INLINE pack<T, W> operator&(const pack<T, W> &p1, const pack<T, W> &p2)
+  {
+    return detail::as_unsigned(detail::as_signed(p1) & detail::as_signed(p2));
   }
 
   // Inferred pack-scalar operators ///////////////////////////////////////////
@@ -194,4 +410,4 @@ namespace tsimd {
     return p1 = p1 & pack<T, W>(v);
   }
 
-}  // namespace tsimd
\ No newline at end of file
+TSIMD_NAMESPACE_END  // namespace tsimd
\ No newline at end of file
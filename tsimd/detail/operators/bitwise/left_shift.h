@@ -26,7 +26,7 @@
 
 #include "../../pack.h"
 
-namespace tsimd {
+TSIMD_NAMESPACE_BEGIN
 
   template <typename T, int W>
   TSIMD_INLINE pack<T, W> operator<<(const pack<T, W> &p1, const pack<T, W> &p2)
@@ -62,4 +62,4 @@ namespace tsimd {
     return pack<T, W>(v) << p1;
   }
 
-}  // namespace tsimd
+TSIMD_NAMESPACE_END  // namespace tsimd
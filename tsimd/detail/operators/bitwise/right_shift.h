@@ -26,7 +26,7 @@
 
 #include "../../pack.h"
 
-namespace tsimd {
+TSIMD_NAMESPACE_BEGIN
 
   template <typename T, int W>
   TSIMD_INLINE pack<T, W> operator>>(const pack<T, W> &p1, const pack<T, W> &p2)
@@ -42,6 +42,82 @@ namespace tsimd {
     return result;
   }
 
+  // unsigned (logical shift) //
+
+  // 4-wide //
+
+  TSIMD_INLINE vuint4 operator>>(const vuint4 &p1, const vuint4 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm_srlv_epi32(p1, p2);
+#elif TSIMD_VECTOR_EXTENSIONS
+    return detail::from_vext<vuint4>(detail::vext(p1) >> detail::vext(p2));
+#else
+    vuint4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = (p1[i] >> p2[i]);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vullong4 operator>>(const vullong4 &p1, const vullong4 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_srlv_epi64(p1, p2);
+#elif TSIMD_VECTOR_EXTENSIONS
+    return detail::from_vext<vullong4>(detail::vext(p1) >> detail::vext(p2));
+#else
+    vullong4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = (p1[i] >> p2[i]);
+
+    return result;
+#endif
+  }
+
+  // 8-wide //
+
+  TSIMD_INLINE vuint8 operator>>(const vuint8 &p1, const vuint8 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_srlv_epi32(p1, p2);
+#else
+    return vuint8(vuint4(p1.vl) >> vuint4(p2.vl),
+                  vuint4(p1.vh) >> vuint4(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vullong8 operator>>(const vullong8 &p1, const vullong8 &p2)
+  {
+#if defined(__AVX512F__)
+    return _mm512_srlv_epi64(p1, p2);
+#else
+    return vullong8(vullong4(p1.vl) >> vullong4(p2.vl),
+                    vullong4(p1.vh) >> vullong4(p2.vh));
+#endif
+  }
+
+  // 16-wide //
+
+  TSIMD_INLINE vuint16 operator>>(const vuint16 &p1, const vuint16 &p2)
+  {
+#if defined(__AVX512F__)
+    return _mm512_srlv_epi32(p1, p2);
+#else
+    return vuint16(vuint8(p1.vl) >> vuint8(p2.vl),
+                   vuint8(p1.vh) >> vuint8(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vullong16 operator>>(const vullong16 &p1, const vullong16 &p2)
+  {
+    return vullong16(vullong8(p1.vl) >> vullong8(p2.vl),
+                     vullong8(p1.vh) >> vullong8(p2.vh));
+  }
+
   // Inferred pack<>/scalar operators /////////////////////////////////////////
 
   template <typename T,
@@ -62,4 +138,4 @@ namespace tsimd {
     return pack<T, W>(v) >> p1;
   }
 
-}  // namespace tsimd
+TSIMD_NAMESPACE_END  // namespace tsimd
@@ -26,7 +26,7 @@
 
 #include "../../pack.h"
 
-namespace tsimd {
+TSIMD_NAMESPACE_BEGIN
 
   // Do not allow operator&&() and operator||() ///////////////////////////////
 
@@ -82,4 +82,4 @@ namespace tsimd {
     return pack<T, W>(v) || p1;
   }
 
-}  // namespace tsimd
+TSIMD_NAMESPACE_END  // namespace tsimd
@@ -26,7 +26,7 @@
 
 #include "../../pack.h"
 
-namespace tsimd {
+TSIMD_NAMESPACE_BEGIN
 
   // 1-wide //
 
@@ -40,8 +40,12 @@ namespace tsimd {
 
   TSIMD_INLINE vboolf4 operator==(const vfloat4 &p1, const vfloat4 &p2)
   {
-#if defined(__SSE__)
+#if defined(__AVX512VL__)
+    return _mm_cmp_ps_mask(p1, p2, _CMP_EQ_OQ);
+#elif defined(__SSE__)
     return _mm_cmpeq_ps(p1, p2);
+#elif TSIMD_VECTOR_EXTENSIONS
+    return detail::from_vext<vboolf4>(detail::vext(p1) == detail::vext(p2));
 #else
     vboolf4 result;
 
@@ -54,8 +58,12 @@ namespace tsimd {
 
   TSIMD_INLINE vboolf4 operator==(const vint4 &p1, const vint4 &p2)
   {
-#if defined(__SSE__)
+#if defined(__AVX512VL__)
+    return _mm_cmp_epi32_mask(p1, p2, _MM_CMPINT_EQ);
+#elif defined(__SSE__)
     return _mm_castsi128_ps(_mm_cmpeq_epi32(p1, p2));
+#elif TSIMD_VECTOR_EXTENSIONS
+    return detail::from_vext<vboolf4>(detail::vext(p1) == detail::vext(p2));
 #else
     vboolf4 result;
 
@@ -68,8 +76,12 @@ namespace tsimd {
 
   TSIMD_INLINE vboolf4 operator==(const vboolf4 &p1, const vboolf4 &p2)
   {
-#if defined(__SSE__)
+#if defined(__AVX512VL__)
+    return _mm512_kand(_mm512_kxnor(p1, p2), 0xF);
+#elif defined(__SSE__)
     return _mm_castsi128_ps(_mm_cmpeq_epi32(p1, p2));
+#elif TSIMD_VECTOR_EXTENSIONS
+    return detail::from_vext<vboolf4>(detail::vext(p1) == detail::vext(p2));
 #else
     vboolf4 result;
 
@@ -82,39 +94,70 @@ namespace tsimd {
 
   TSIMD_INLINE vboold4 operator==(const vdouble4 &p1, const vdouble4 &p2)
   {
+#if defined(__AVX512VL__)
+    return _mm256_cmp_pd_mask(p1, p2, _CMP_EQ_OQ);
+#elif defined(__AVX__)
+    return _mm256_cmp_pd(p1, p2, _CMP_EQ_OQ);
+#elif TSIMD_VECTOR_EXTENSIONS
+    return detail::from_vext<vboold4>(detail::vext(p1) == detail::vext(p2));
+#else
     vboold4 result;
 
     for (int i = 0; i < 4; ++i)
       result[i] = (p1[i] == p2[i]);
 
     return result;
+#endif
   }
 
   TSIMD_INLINE vboold4 operator==(const vllong4 &p1, const vllong4 &p2)
   {
+#if defined(__AVX512VL__)
+    return _mm256_cmp_epi64_mask(p1, p2, _MM_CMPINT_EQ);
+#elif defined(__AVX2__)
+    return _mm256_castsi256_pd(_mm256_cmpeq_epi64(p1, p2));
+#elif defined(__AVX__)
+    return vboold4(_mm_castsi128_pd(_mm_cmpeq_epi64(p1.vl, p2.vl)),
+                   _mm_castsi128_pd(_mm_cmpeq_epi64(p1.vh, p2.vh)));
+#elif TSIMD_VECTOR_EXTENSIONS
+    return detail::from_vext<vboold4>(detail::vext(p1) == detail::vext(p2));
+#else
     vboold4 result;
 
     for (int i = 0; i < 4; ++i)
       result[i] = (p1[i] == p2[i]);
 
     return result;
+#endif
   }
 
   TSIMD_INLINE vboold4 operator==(const vboold4 &p1, const vboold4 &p2)
   {
+#if defined(__AVX512VL__)
+    return _mm512_kand(_mm512_kxnor(p1, p2), 0xF);
+#elif defined(__AVX2__)
+    return _mm256_castsi256_pd(_mm256_cmpeq_epi64(p1, p2));
+#elif defined(__AVX__)
+    return _mm256_xor_pd(_mm256_xor_pd(p1, p2), vboold4(true));
+#elif TSIMD_VECTOR_EXTENSIONS
+    return detail::from_vext<vboold4>(detail::vext(p1) == detail::vext(p2));
+#else
     vboold4 result;
 
     for (int i = 0; i < 4; ++i)
       result[i] = (p1[i] == p2[i]);
 
     return result;
+#endif
   }
 
   // 8-wide //
 
   TSIMD_INLINE vboolf8 operator==(const vfloat8 &p1, const vfloat8 &p2)
   {
-#if defined(__AVX512F__) || defined(__AVX2__) || defined(__AVX__)
+#if defined(__AVX512VL__)
+    return _mm256_cmp_ps_mask(p1, p2, _CMP_EQ_OQ);
+#elif defined(__AVX512F__) || defined(__AVX2__) || defined(__AVX__)
     return _mm256_cmp_ps(p1, p2, _CMP_EQ_OQ);
 #else
     return vboolf8(vfloat4(p1.vl) == vfloat4(p2.vl),
@@ -124,7 +167,9 @@ namespace tsimd {
 
   TSIMD_INLINE vboolf8 operator==(const vint8 &p1, const vint8 &p2)
   {
-#if defined(__AVX512F__) || defined(__AVX2__)
+#if defined(__AVX512VL__)
+    return _mm256_cmp_epi32_mask(p1, p2, _MM_CMPINT_EQ);
+#elif defined(__AVX512F__) || defined(__AVX2__)
     return _mm256_castsi256_ps(_mm256_cmpeq_epi32(p1, p2));
 #elif defined(__AVX__)
     return vboolf8(_mm_castsi128_ps(_mm_cmpeq_epi32(p1.vl, p2.vl)),
@@ -136,8 +181,12 @@ namespace tsimd {
 
   TSIMD_INLINE vboolf8 operator==(const vboolf8 &p1, const vboolf8 &p2)
   {
-#if defined(__AVX512F__) || defined(__AVX2__) || defined(__AVX__)
-    return _mm256_cmp_ps(p1, p2, _CMP_EQ_OQ);
+#if defined(__AVX512VL__)
+    return _mm512_kxnor(p1, p2);
+#elif defined(__AVX512F__) || defined(__AVX2__)
+    return _mm256_castsi256_ps(_mm256_cmpeq_epi32(p1, p2));
+#elif defined(__AVX__)
+    return _mm256_xor_ps(_mm256_xor_ps(p1, p2), vboolf8(true));
 #else
     return vboolf8(vboolf4(p1.vl) == vboolf4(p2.vl),
                    vboolf4(p1.vh) == vboolf4(p2.vh));
@@ -146,20 +195,32 @@ namespace tsimd {
 
   TSIMD_INLINE vboold8 operator==(const vdouble8 &p1, const vdouble8 &p2)
   {
+#if defined(__AVX512F__)
+    return _mm512_cmp_pd_mask(p1, p2, _CMP_EQ_OQ);
+#else
     return vboold8(vdouble4(p1.vl) == vdouble4(p2.vl),
                    vdouble4(p1.vh) == vdouble4(p2.vh));
+#endif
   }
 
   TSIMD_INLINE vboold8 operator==(const vllong8 &p1, const vllong8 &p2)
   {
+#if defined(__AVX512F__)
+    return _mm512_cmp_epi64_mask(p1, p2, _MM_CMPINT_EQ);
+#else
     return vboold8(vllong4(p1.vl) == vllong4(p2.vl), 
                    vllong4(p1.vh) == vllong4(p2.vh));
+#endif
   }
 
   TSIMD_INLINE vboold8 operator==(const vboold8 &p1, const vboold8 &p2)
   {
+#if defined(__AVX512F__)
+    return _mm512_kxnor(p1, p2);
+#else
     return vboold8(vboold4(p1.vl) == vboold4(p2.vl),
                    vboold4(p1.vh) == vboold4(p2.vh));
+#endif
   }
 
   // 16-wide //
@@ -167,7 +228,7 @@ namespace tsimd {
   TSIMD_INLINE vboolf16 operator==(const vfloat16 &p1, const vfloat16 &p2)
   {
 #if defined(__AVX512F__)
-    return _mm512_cmp_ps_mask(p1, p2, _MM_CMPINT_EQ);
+    return _mm512_cmp_ps_mask(p1, p2, _CMP_EQ_OQ);
 #else
     return vboolf16(vfloat8(p1.vl) == vfloat8(p2.vl),
                     vfloat8(p1.vh) == vfloat8(p2.vh));
@@ -207,8 +268,195 @@ namespace tsimd {
 
   TSIMD_INLINE vboold16 operator==(const vboold16 &p1, const vboold16 &p2)
   {
+#if defined(__AVX512F__)
+    return _mm512_kxnor(p1, p2);
+#else
     return vboold16(vboold8(p1.vl) == vboold8(p2.vl),
                     vboold8(p1.vh) == vboold8(p2.vh));
+#endif
+  }
+
+  // 8/16-bit //
+
+  TSIMD_INLINE vboolc16 operator==(const vschar16 &p1, const vschar16 &p2)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    return _mm_cmp_epi8_mask(p1, p2, _MM_CMPINT_EQ);
+#elif defined(__SSE__)
+    return _mm_cmpeq_epi8(p1, p2);
+#elif TSIMD_VECTOR_EXTENSIONS
+    return detail::from_vext<vboolc16>(detail::vext(p1) == detail::vext(p2));
+#else
+    vboolc16 result;
+
+    for (int i = 0; i < 16; ++i)
+      result[i] = (p1[i] == p2[i]);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vbools8 operator==(const vshort8 &p1, const vshort8 &p2)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    return _mm_cmp_epi16_mask(p1, p2, _MM_CMPINT_EQ);
+#elif defined(__SSE__)
+    return _mm_cmpeq_epi16(p1, p2);
+#elif TSIMD_VECTOR_EXTENSIONS
+    return detail::from_vext<vbools8>(detail::vext(p1) == detail::vext(p2));
+#else
+    vbools8 result;
+
+    for (int i = 0; i < 8; ++i)
+      result[i] = (p1[i] == p2[i]);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vboolc32 operator==(const vschar32 &p1, const vschar32 &p2)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    return _mm256_cmp_epi8_mask(p1, p2, _MM_CMPINT_EQ);
+#elif defined(__AVX2__)
+    return _mm256_cmpeq_epi8(p1, p2);
+#else
+    return vboolc32(vschar16(p1.vl) == vschar16(p2.vl),
+                    vschar16(p1.vh) == vschar16(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vbools16 operator==(const vshort16 &p1, const vshort16 &p2)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    return _mm256_cmp_epi16_mask(p1, p2, _MM_CMPINT_EQ);
+#elif defined(__AVX2__)
+    return _mm256_cmpeq_epi16(p1, p2);
+#else
+    return vbools16(vshort8(p1.vl) == vshort8(p2.vl),
+                    vshort8(p1.vh) == vshort8(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vboolc64 operator==(const vschar64 &p1, const vschar64 &p2)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_cmp_epi8_mask(p1, p2, _MM_CMPINT_EQ);
+#else
+    return vboolc64(vschar32(p1.vl) == vschar32(p2.vl),
+                    vschar32(p1.vh) == vschar32(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vbools32 operator==(const vshort32 &p1, const vshort32 &p2)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_cmp_epi16_mask(p1, p2, _MM_CMPINT_EQ);
+#else
+    return vbools32(vshort16(p1.vl) == vshort16(p2.vl),
+                    vshort16(p1.vh) == vshort16(p2.vh));
+#endif
+  }
+
+  // 8/16-bit masks //
+
+  TSIMD_INLINE vboolc16 operator==(const vboolc16 &p1, const vboolc16 &p2)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    return _mm512_kxnor(p1, p2);
+#elif defined(__SSE__)
+    return _mm_cmpeq_epi8(p1, p2);
+#elif TSIMD_VECTOR_EXTENSIONS
+    return detail::from_vext<vboolc16>(detail::vext(p1) == detail::vext(p2));
+#else
+    vboolc16 result;
+
+    for (int i = 0; i < 16; ++i)
+      result[i] = p1[i] == p2[i];
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vbools8 operator==(const vbools8 &p1, const vbools8 &p2)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    return _mm512_kxnor(p1, p2);
+#elif defined(__SSE__)
+    return _mm_cmpeq_epi16(p1, p2);
+#elif TSIMD_VECTOR_EXTENSIONS
+    return detail::from_vext<vbools8>(detail::vext(p1) == detail::vext(p2));
+#else
+    vbools8 result;
+
+    for (int i = 0; i < 8; ++i)
+      result[i] = p1[i] == p2[i];
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vboolc32 operator==(const vboolc32 &p1, const vboolc32 &p2)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    return _kxnor_mask32(p1, p2);
+#elif defined(__AVX2__)
+    return _mm256_cmpeq_epi8(p1, p2);
+#else
+    return vboolc32(vboolc16(p1.vl) == vboolc16(p2.vl),
+                    vboolc16(p1.vh) == vboolc16(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vbools16 operator==(const vbools16 &p1, const vbools16 &p2)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    return _mm512_kxnor(p1, p2);
+#elif defined(__AVX2__)
+    return _mm256_cmpeq_epi16(p1, p2);
+#else
+    return vbools16(vbools8(p1.vl) == vbools8(p2.vl),
+                    vbools8(p1.vh) == vbools8(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vboolc64 operator==(const vboolc64 &p1, const vboolc64 &p2)
+  {
+#if defined(__AVX512BW__)
+    return _kxnor_mask64(p1, p2);
+#else
+    return vboolc64(vboolc32(p1.vl) == vboolc32(p2.vl),
+                    vboolc32(p1.vh) == vboolc32(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vbools32 operator==(const vbools32 &p1, const vbools32 &p2)
+  {
+#if defined(__AVX512BW__)
+    return _kxnor_mask32(p1, p2);
+#else
+    return vbools32(vbools16(p1.vl) == vbools16(p2.vl),
+                    vbools16(p1.vh) == vbools16(p2.vh));
+#endif
+  }
+
+  // wide //
+
+  template <typename T,
+            int W,
+            typename = traits::is_wide_pack_t<T, W>,
+            typename = void>
+  TSIMD_INLINE mask<T, W> operator==(const pack<T, W> &p1, const pack<T, W> &p2)
+  {
+    return mask<T, W>(p1.vl == p2.vl, p1.vh == p2.vh);
+  }
+
+  // unsigned (same bits as signed) //
+
+  template <typename T, int W, typename = traits::is_unsigned_pack_t<T, W>>
+  TSIMD_INLINE mask<T, W> operator==(const pack<T, W> &p1, const pack<T, W> &p2)
+  {
+    return detail::as_signed(p1) == detail::as_signed(p2);
   }
 
   // Inferred pack-scalar operators ///////////////////////////////////////////
@@ -257,4 +505,4 @@ namespace tsimd {
     return pack<T, W>(v) != p1;
   }
 
-}  // namespace tsimd
+TSIMD_NAMESPACE_END  // namespace tsimd
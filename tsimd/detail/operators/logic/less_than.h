@@ -26,7 +26,7 @@
 
 #include "../../pack.h"
 
-namespace tsimd {
+TSIMD_NAMESPACE_BEGIN
 
   // 1-wide //
 
@@ -40,8 +40,12 @@ namespace tsimd {
 
   TSIMD_INLINE vboolf4 operator<(const vfloat4 &p1, const vfloat4 &p2)
   {
-#if defined(__SSE__)
+#if defined(__AVX512VL__)
+    return _mm_cmp_ps_mask(p1, p2, _CMP_LT_OQ);
+#elif defined(__SSE__)
     return _mm_cmplt_ps(p1, p2);
+#elif TSIMD_VECTOR_EXTENSIONS
+    return detail::from_vext<vboolf4>(detail::vext(p1) < detail::vext(p2));
 #else
     vboolf4 result;
 
@@ -54,8 +58,12 @@ namespace tsimd {
 
   TSIMD_INLINE vboolf4 operator<(const vint4 &p1, const vint4 &p2)
   {
-#if defined(__SSE__)
+#if defined(__AVX512VL__)
+    return _mm_cmp_epi32_mask(p1, p2, _MM_CMPINT_LT);
+#elif defined(__SSE__)
     return _mm_castsi128_ps(_mm_cmplt_epi32(p1, p2));
+#elif TSIMD_VECTOR_EXTENSIONS
+    return detail::from_vext<vboolf4>(detail::vext(p1) < detail::vext(p2));
 #else
     vboolf4 result;
 
@@ -68,30 +76,97 @@ namespace tsimd {
 
   TSIMD_INLINE vboold4 operator<(const vdouble4 &p1, const vdouble4 &p2)
   {
+#if defined(__AVX512VL__)
+    return _mm256_cmp_pd_mask(p1, p2, _CMP_LT_OQ);
+#elif defined(__AVX__)
+    return _mm256_cmp_pd(p1, p2, _CMP_LT_OQ);
+#elif TSIMD_VECTOR_EXTENSIONS
+    return detail::from_vext<vboold4>(detail::vext(p1) < detail::vext(p2));
+#else
     vboold4 result;
 
     for (int i = 0; i < 4; ++i)
       result[i] = (p1[i] < p2[i]);
 
     return result;
+#endif
   }
 
   TSIMD_INLINE vboold4 operator<(const vllong4 &p1, const vllong4 &p2)
   {
+#if defined(__AVX512VL__)
+    return _mm256_cmp_epi64_mask(p1, p2, _MM_CMPINT_LT);
+#elif defined(__AVX2__)
+    return _mm256_castsi256_pd(_mm256_cmpgt_epi64(p2, p1));
+#elif defined(__AVX__)
+    return vboold4(_mm_castsi128_pd(_mm_cmpgt_epi64(p2.vl, p1.vl)),
+                   _mm_castsi128_pd(_mm_cmpgt_epi64(p2.vh, p1.vh)));
+#elif TSIMD_VECTOR_EXTENSIONS
+    return detail::from_vext<vboold4>(detail::vext(p1) < detail::vext(p2));
+#else
+    vboold4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = (p1[i] < p2[i]);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vboolf4 operator<(const vuint4 &p1, const vuint4 &p2)
+  {
+#if defined(__AVX512VL__)
+    return _mm_cmp_epu32_mask(p1, p2, _MM_CMPINT_LT);
+#elif defined(__SSE__)
+    // NOTE: flipping the sign bits turns the unsigned order into signed order
+    const __m128i sign = _mm_set1_epi32(int(0x80000000));
+    return _mm_castsi128_ps(
+        _mm_cmplt_epi32(_mm_xor_si128(p1, sign), _mm_xor_si128(p2, sign)));
+#elif TSIMD_VECTOR_EXTENSIONS
+    return detail::from_vext<vboolf4>(detail::vext(p1) < detail::vext(p2));
+#else
+    vboolf4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = (p1[i] < p2[i]);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vboold4 operator<(const vullong4 &p1, const vullong4 &p2)
+  {
+#if defined(__AVX512VL__)
+    return _mm256_cmp_epu64_mask(p1, p2, _MM_CMPINT_LT);
+#elif defined(__AVX2__)
+    const __m256i sign = _mm256_set1_epi64x((long long)0x8000000000000000ULL);
+    return _mm256_castsi256_pd(_mm256_cmpgt_epi64(_mm256_xor_si256(p2, sign),
+                                                  _mm256_xor_si256(p1, sign)));
+#elif defined(__AVX__)
+    const __m128i sign = _mm_set1_epi64x((long long)0x8000000000000000ULL);
+    return vboold4(
+        _mm_castsi128_pd(_mm_cmpgt_epi64(_mm_xor_si128(p2.vl, sign),
+                                         _mm_xor_si128(p1.vl, sign))),
+        _mm_castsi128_pd(_mm_cmpgt_epi64(_mm_xor_si128(p2.vh, sign),
+                                         _mm_xor_si128(p1.vh, sign))));
+#elif TSIMD_VECTOR_EXTENSIONS
+    return detail::from_vext<vboold4>(detail::vext(p1) < detail::vext(p2));
+#else
     vboold4 result;
 
     for (int i = 0; i < 4; ++i)
       result[i] = (p1[i] < p2[i]);
 
     return result;
+#endif
   }
 
   // 8-wide //
 
   TSIMD_INLINE vboolf8 operator<(const vfloat8 &p1, const vfloat8 &p2)
   {
-#if defined(__AVX512__)
-    return _mm256_cmp_ps_mask(p1, p2, _MM_CMPINT_LT);
+#if defined(__AVX512VL__)
+    return _mm256_cmp_ps_mask(p1, p2, _CMP_LT_OQ);
 #elif defined(__AVX2__) || defined(__AVX__)
     return _mm256_cmp_ps(p1, p2, _CMP_LT_OQ);
 #else
@@ -102,7 +177,9 @@ namespace tsimd {
 
   TSIMD_INLINE vboolf8 operator<(const vint8 &p1, const vint8 &p2)
   {
-#if defined(__AVX512__) || defined(__AVX2__)
+#if defined(__AVX512VL__)
+    return _mm256_cmp_epi32_mask(p1, p2, _MM_CMPINT_LT);
+#elif defined(__AVX2__)
     return _mm256_castsi256_ps(_mm256_cmpgt_epi32(p2, p1));
 #elif defined(__AVX__)
     return vboolf8(_mm_castsi128_ps(_mm_cmplt_epi32(p1.vl, p2.vl)),
@@ -114,14 +191,46 @@ namespace tsimd {
 
   TSIMD_INLINE vboold8 operator<(const vdouble8 &p1, const vdouble8 &p2)
   {
+#if defined(__AVX512F__)
+    return _mm512_cmp_pd_mask(p1, p2, _CMP_LT_OQ);
+#else
     return vboold8(vdouble4(p1.vl) < vdouble4(p2.vl),
                    vdouble4(p1.vh) < vdouble4(p2.vh));
+#endif
   }
 
   TSIMD_INLINE vboold8 operator<(const vllong8 &p1, const vllong8 &p2)
   {
+#if defined(__AVX512F__)
+    return _mm512_cmp_epi64_mask(p1, p2, _MM_CMPINT_LT);
+#else
     return vboold8(vllong4(p1.vl) < vllong4(p2.vl), 
                    vllong4(p1.vh) < vllong4(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vboolf8 operator<(const vuint8 &p1, const vuint8 &p2)
+  {
+#if defined(__AVX512VL__)
+    return _mm256_cmp_epu32_mask(p1, p2, _MM_CMPINT_LT);
+#elif defined(__AVX2__)
+    const __m256i sign = _mm256_set1_epi32(int(0x80000000));
+    return _mm256_castsi256_ps(_mm256_cmpgt_epi32(_mm256_xor_si256(p2, sign),
+                                                  _mm256_xor_si256(p1, sign)));
+#else
+    return vboolf8(vuint4(p1.vl) < vuint4(p2.vl),
+                   vuint4(p1.vh) < vuint4(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vboold8 operator<(const vullong8 &p1, const vullong8 &p2)
+  {
+#if defined(__AVX512F__)
+    return _mm512_cmp_epu64_mask(p1, p2, _MM_CMPINT_LT);
+#else
+    return vboold8(vullong4(p1.vl) < vullong4(p2.vl),
+                   vullong4(p1.vh) < vullong4(p2.vh));
+#endif
   }
 
   // 16-wide //
@@ -129,7 +238,7 @@ namespace tsimd {
   TSIMD_INLINE vboolf16 operator<(const vfloat16 &p1, const vfloat16 &p2)
   {
 #if defined(__AVX512F__)
-    return _mm512_cmp_ps_mask(p1, p2, _MM_CMPINT_LT);
+    return _mm512_cmp_ps_mask(p1, p2, _CMP_LT_OQ);
 #else
     return vboolf16(vfloat8(p1.vl) < vfloat8(p2.vl),
                     vfloat8(p1.vh) < vfloat8(p2.vh));
@@ -157,6 +266,200 @@ namespace tsimd {
                     vllong8(p1.vh) < vllong8(p2.vh));
   }
 
+  TSIMD_INLINE vboolf16 operator<(const vuint16 &p1, const vuint16 &p2)
+  {
+#if defined(__AVX512F__)
+    return _mm512_cmp_epu32_mask(p1, p2, _MM_CMPINT_LT);
+#else
+    return vboolf16(vuint8(p1.vl) < vuint8(p2.vl),
+                    vuint8(p1.vh) < vuint8(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vboold16 operator<(const vullong16 &p1, const vullong16 &p2)
+  {
+    return vboold16(vullong8(p1.vl) < vullong8(p2.vl),
+                    vullong8(p1.vh) < vullong8(p2.vh));
+  }
+
+  // 8/16-bit //
+
+  TSIMD_INLINE vboolc16 operator<(const vschar16 &p1, const vschar16 &p2)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    return _mm_cmp_epi8_mask(p1, p2, _MM_CMPINT_LT);
+#elif defined(__SSE__)
+    return _mm_cmplt_epi8(p1, p2);
+#elif TSIMD_VECTOR_EXTENSIONS
+    return detail::from_vext<vboolc16>(detail::vext(p1) < detail::vext(p2));
+#else
+    vboolc16 result;
+
+    for (int i = 0; i < 16; ++i)
+      result[i] = (p1[i] < p2[i]);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vboolc16 operator<(const vuchar16 &p1, const vuchar16 &p2)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    return _mm_cmp_epu8_mask(p1, p2, _MM_CMPINT_LT);
+#elif defined(__SSE__)
+    // NOTE: flipping the sign bits turns the unsigned order into signed order
+    const __m128i sign = _mm_set1_epi8(-128);
+    return _mm_cmplt_epi8(_mm_xor_si128(p1, sign), _mm_xor_si128(p2, sign));
+#elif TSIMD_VECTOR_EXTENSIONS
+    return detail::from_vext<vboolc16>(detail::vext(p1) < detail::vext(p2));
+#else
+    vboolc16 result;
+
+    for (int i = 0; i < 16; ++i)
+      result[i] = (p1[i] < p2[i]);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vbools8 operator<(const vshort8 &p1, const vshort8 &p2)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    return _mm_cmp_epi16_mask(p1, p2, _MM_CMPINT_LT);
+#elif defined(__SSE__)
+    return _mm_cmplt_epi16(p1, p2);
+#elif TSIMD_VECTOR_EXTENSIONS
+    return detail::from_vext<vbools8>(detail::vext(p1) < detail::vext(p2));
+#else
+    vbools8 result;
+
+    for (int i = 0; i < 8; ++i)
+      result[i] = (p1[i] < p2[i]);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vbools8 operator<(const vushort8 &p1, const vushort8 &p2)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    return _mm_cmp_epu16_mask(p1, p2, _MM_CMPINT_LT);
+#elif defined(__SSE__)
+    // NOTE: flipping the sign bits turns the unsigned order into signed order
+    const __m128i sign = _mm_set1_epi16(-32768);
+    return _mm_cmplt_epi16(_mm_xor_si128(p1, sign), _mm_xor_si128(p2, sign));
+#elif TSIMD_VECTOR_EXTENSIONS
+    return detail::from_vext<vbools8>(detail::vext(p1) < detail::vext(p2));
+#else
+    vbools8 result;
+
+    for (int i = 0; i < 8; ++i)
+      result[i] = (p1[i] < p2[i]);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vboolc32 operator<(const vschar32 &p1, const vschar32 &p2)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    return _mm256_cmp_epi8_mask(p1, p2, _MM_CMPINT_LT);
+#elif defined(__AVX2__)
+    return _mm256_cmpgt_epi8(p2, p1);
+#else
+    return vboolc32(vschar16(p1.vl) < vschar16(p2.vl),
+                    vschar16(p1.vh) < vschar16(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vboolc32 operator<(const vuchar32 &p1, const vuchar32 &p2)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    return _mm256_cmp_epu8_mask(p1, p2, _MM_CMPINT_LT);
+#elif defined(__AVX2__)
+    const __m256i sign = _mm256_set1_epi8(-128);
+    return _mm256_cmpgt_epi8(_mm256_xor_si256(p2, sign),
+                             _mm256_xor_si256(p1, sign));
+#else
+    return vboolc32(vuchar16(p1.vl) < vuchar16(p2.vl),
+                    vuchar16(p1.vh) < vuchar16(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vbools16 operator<(const vshort16 &p1, const vshort16 &p2)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    return _mm256_cmp_epi16_mask(p1, p2, _MM_CMPINT_LT);
+#elif defined(__AVX2__)
+    return _mm256_cmpgt_epi16(p2, p1);
+#else
+    return vbools16(vshort8(p1.vl) < vshort8(p2.vl),
+                    vshort8(p1.vh) < vshort8(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vbools16 operator<(const vushort16 &p1, const vushort16 &p2)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    return _mm256_cmp_epu16_mask(p1, p2, _MM_CMPINT_LT);
+#elif defined(__AVX2__)
+    const __m256i sign = _mm256_set1_epi16(-32768);
+    return _mm256_cmpgt_epi16(_mm256_xor_si256(p2, sign),
+                              _mm256_xor_si256(p1, sign));
+#else
+    return vbools16(vushort8(p1.vl) < vushort8(p2.vl),
+                    vushort8(p1.vh) < vushort8(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vboolc64 operator<(const vschar64 &p1, const vschar64 &p2)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_cmp_epi8_mask(p1, p2, _MM_CMPINT_LT);
+#else
+    return vboolc64(vschar32(p1.vl) < vschar32(p2.vl),
+                    vschar32(p1.vh) < vschar32(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vboolc64 operator<(const vuchar64 &p1, const vuchar64 &p2)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_cmp_epu8_mask(p1, p2, _MM_CMPINT_LT);
+#else
+    return vboolc64(vuchar32(p1.vl) < vuchar32(p2.vl),
+                    vuchar32(p1.vh) < vuchar32(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vbools32 operator<(const vshort32 &p1, const vshort32 &p2)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_cmp_epi16_mask(p1, p2, _MM_CMPINT_LT);
+#else
+    return vbools32(vshort16(p1.vl) < vshort16(p2.vl),
+                    vshort16(p1.vh) < vshort16(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vbools32 operator<(const vushort32 &p1, const vushort32 &p2)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_cmp_epu16_mask(p1, p2, _MM_CMPINT_LT);
+#else
+    return vbools32(vushort16(p1.vl) < vushort16(p2.vl),
+                    vushort16(p1.vh) < vushort16(p2.vh));
+#endif
+  }
+
+  // wide //
+
+  template <typename T, int W, typename = traits::is_wide_pack_t<T, W>>
+  TSIMD_INLINE mask<T, W> operator<(const pack<T, W> &p1, const pack<T, W> &p2)
+  {
+    return mask<T, W>(p1.vl < p2.vl, p1.vh < p2.vh);
+  }
+
   // Inferred pack-scalar operators ///////////////////////////////////////////
 
   template <typename T,
@@ -177,4 +480,4 @@ namespace tsimd {
     return pack<T, W>(v) < p1;
   }
 
-}  // namespace tsimd
+TSIMD_NAMESPACE_END  // namespace tsimd
@@ -29,7 +29,7 @@
 #include "greater_than.h"
 #include "not.h"
 
-namespace tsimd {
+TSIMD_NAMESPACE_BEGIN
 
   // 1-wide //
 
@@ -43,8 +43,12 @@ namespace tsimd {
 
   TSIMD_INLINE vboolf4 operator<=(const vfloat4 &p1, const vfloat4 &p2)
   {
-#if defined(__SSE__)
+#if defined(__AVX512VL__)
+    return _mm_cmp_ps_mask(p1, p2, _CMP_LE_OQ);
+#elif defined(__SSE__)
     return _mm_cmple_ps(p1, p2);
+#elif TSIMD_VECTOR_EXTENSIONS
+    return detail::from_vext<vboolf4>(detail::vext(p1) <= detail::vext(p2));
 #else
     vboolf4 result;
 
@@ -57,29 +61,65 @@ namespace tsimd {
 
   TSIMD_INLINE vboolf4 operator<=(const vint4 &p1, const vint4 &p2)
   {
+#if defined(__AVX512VL__)
+    return _mm_cmp_epi32_mask(p1, p2, _MM_CMPINT_LE);
+#else
     return !(p1 > p2);
+#endif
   }
 
   TSIMD_INLINE vboold4 operator<=(const vdouble4 &p1, const vdouble4 &p2)
   {
+#if defined(__AVX512VL__)
+    return _mm256_cmp_pd_mask(p1, p2, _CMP_LE_OQ);
+#elif defined(__AVX__)
+    return _mm256_cmp_pd(p1, p2, _CMP_LE_OQ);
+#elif TSIMD_VECTOR_EXTENSIONS
+    return detail::from_vext<vboold4>(detail::vext(p1) <= detail::vext(p2));
+#else
     vboold4 result;
 
     for (int i = 0; i < 4; ++i)
       result[i] = (p1[i] <= p2[i]);
 
     return result;
+#endif
   }
 
   TSIMD_INLINE vboold4 operator<=(const vllong4 &p1, const vllong4 &p2)
   {
+#if defined(__AVX512VL__)
+    return _mm256_cmp_epi64_mask(p1, p2, _MM_CMPINT_LE);
+#else
+    return !(p1 > p2);
+#endif
+  }
+
+  TSIMD_INLINE vboolf4 operator<=(const vuint4 &p1, const vuint4 &p2)
+  {
+#if defined(__AVX512VL__)
+    return _mm_cmp_epu32_mask(p1, p2, _MM_CMPINT_LE);
+#else
+    return !(p1 > p2);
+#endif
+  }
+
+  TSIMD_INLINE vboold4 operator<=(const vullong4 &p1, const vullong4 &p2)
+  {
+#if defined(__AVX512VL__)
+    return _mm256_cmp_epu64_mask(p1, p2, _MM_CMPINT_LE);
+#else
     return !(p1 > p2);
+#endif
   }
 
   // 8-wide //
 
   TSIMD_INLINE vboolf8 operator<=(const vfloat8 &p1, const vfloat8 &p2)
   {
-#if defined(__AVX2__) || defined(__AVX__)
+#if defined(__AVX512VL__)
+    return _mm256_cmp_ps_mask(p1, p2, _CMP_LE_OQ);
+#elif defined(__AVX2__) || defined(__AVX__)
     return _mm256_cmp_ps(p1, p2, _CMP_LE_OQ);
 #else
     return vboolf8(vfloat4(p1.vl) <= vfloat4(p2.vl),
@@ -89,7 +129,9 @@ namespace tsimd {
 
   TSIMD_INLINE vboolf8 operator<=(const vint8 &p1, const vint8 &p2)
   {
-#if defined(__AVX2__) || defined(__AVX__)
+#if defined(__AVX512VL__)
+    return _mm256_cmp_epi32_mask(p1, p2, _MM_CMPINT_LE);
+#elif defined(__AVX2__) || defined(__AVX__)
     return !(p1 > p2);
 #else
     return vboolf8(vint4(p1.vl) <= vint4(p2.vl), vint4(p1.vh) <= vint4(p2.vh));
@@ -98,14 +140,40 @@ namespace tsimd {
 
   TSIMD_INLINE vboold8 operator<=(const vdouble8 &p1, const vdouble8 &p2)
   {
+#if defined(__AVX512F__)
+    return _mm512_cmp_pd_mask(p1, p2, _CMP_LE_OQ);
+#else
     return vboold8(vdouble4(p1.vl) <= vdouble4(p2.vl),
                    vdouble4(p1.vh) <= vdouble4(p2.vh));
+#endif
   }
 
   TSIMD_INLINE vboold8 operator<=(const vllong8 &p1, const vllong8 &p2)
   {
+#if defined(__AVX512F__)
+    return _mm512_cmp_epi64_mask(p1, p2, _MM_CMPINT_LE);
+#else
     return vboold8(vllong4(p1.vl) <= vllong4(p2.vl),
                    vllong4(p1.vh) <= vllong4(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vboolf8 operator<=(const vuint8 &p1, const vuint8 &p2)
+  {
+#if defined(__AVX512VL__)
+    return _mm256_cmp_epu32_mask(p1, p2, _MM_CMPINT_LE);
+#else
+    return !(p1 > p2);
+#endif
+  }
+
+  TSIMD_INLINE vboold8 operator<=(const vullong8 &p1, const vullong8 &p2)
+  {
+#if defined(__AVX512F__)
+    return _mm512_cmp_epu64_mask(p1, p2, _MM_CMPINT_LE);
+#else
+    return !(p1 > p2);
+#endif
   }
 
   // 16-wide //
@@ -113,7 +181,7 @@ namespace tsimd {
   TSIMD_INLINE vboolf16 operator<=(const vfloat16 &p1, const vfloat16 &p2)
   {
 #if defined(__AVX512F__)
-    return _mm512_cmp_ps_mask(p1, p2, _MM_CMPINT_LE);
+    return _mm512_cmp_ps_mask(p1, p2, _CMP_LE_OQ);
 #else
     return vboolf16(vfloat8(p1.vl) <= vfloat8(p2.vl),
                     vfloat8(p1.vh) <= vfloat8(p2.vh));
@@ -141,6 +209,138 @@ namespace tsimd {
                     vllong8(p1.vh) <= vllong8(p2.vh));
   }
 
+  TSIMD_INLINE vboolf16 operator<=(const vuint16 &p1, const vuint16 &p2)
+  {
+#if defined(__AVX512F__)
+    return _mm512_cmp_epu32_mask(p1, p2, _MM_CMPINT_LE);
+#else
+    return !(p1 > p2);
+#endif
+  }
+
+  TSIMD_INLINE vboold16 operator<=(const vullong16 &p1, const vullong16 &p2)
+  {
+    return !(p1 > p2);
+  }
+
+  // 8/16-bit //
+
+  TSIMD_INLINE vboolc16 operator<=(const vschar16 &p1, const vschar16 &p2)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    return _mm_cmp_epi8_mask(p1, p2, _MM_CMPINT_LE);
+#else
+    return !(p1 > p2);
+#endif
+  }
+
+  TSIMD_INLINE vboolc16 operator<=(const vuchar16 &p1, const vuchar16 &p2)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    return _mm_cmp_epu8_mask(p1, p2, _MM_CMPINT_LE);
+#else
+    return !(p1 > p2);
+#endif
+  }
+
+  TSIMD_INLINE vbools8 operator<=(const vshort8 &p1, const vshort8 &p2)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    return _mm_cmp_epi16_mask(p1, p2, _MM_CMPINT_LE);
+#else
+    return !(p1 > p2);
+#endif
+  }
+
+  TSIMD_INLINE vbools8 operator<=(const vushort8 &p1, const vushort8 &p2)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    return _mm_cmp_epu16_mask(p1, p2, _MM_CMPINT_LE);
+#else
+    return !(p1 > p2);
+#endif
+  }
+
+  TSIMD_INLINE vboolc32 operator<=(const vschar32 &p1, const vschar32 &p2)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    return _mm256_cmp_epi8_mask(p1, p2, _MM_CMPINT_LE);
+#else
+    return !(p1 > p2);
+#endif
+  }
+
+  TSIMD_INLINE vboolc32 operator<=(const vuchar32 &p1, const vuchar32 &p2)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    return _mm256_cmp_epu8_mask(p1, p2, _MM_CMPINT_LE);
+#else
+    return !(p1 > p2);
+#endif
+  }
+
+  TSIMD_INLINE vbools16 operator<=(const vshort16 &p1, const vshort16 &p2)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    return _mm256_cmp_epi16_mask(p1, p2, _MM_CMPINT_LE);
+#else
+    return !(p1 > p2);
+#endif
+  }
+
+  TSIMD_INLINE vbools16 operator<=(const vushort16 &p1, const vushort16 &p2)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    return _mm256_cmp_epu16_mask(p1, p2, _MM_CMPINT_LE);
+#else
+    return !(p1 > p2);
+#endif
+  }
+
+  TSIMD_INLINE vboolc64 operator<=(const vschar64 &p1, const vschar64 &p2)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_cmp_epi8_mask(p1, p2, _MM_CMPINT_LE);
+#else
+    return !(p1 > p2);
+#endif
+  }
+
+  TSIMD_INLINE vboolc64 operator<=(const vuchar64 &p1, const vuchar64 &p2)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_cmp_epu8_mask(p1, p2, _MM_CMPINT_LE);
+#else
+    return !(p1 > p2);
+#endif
+  }
+
+  TSIMD_INLINE vbools32 operator<=(const vshort32 &p1, const vshort32 &p2)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_cmp_epi16_mask(p1, p2, _MM_CMPINT_LE);
+#else
+    return !(p1 > p2);
+#endif
+  }
+
+  TSIMD_INLINE vbools32 operator<=(const vushort32 &p1, const vushort32 &p2)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_cmp_epu16_mask(p1, p2, _MM_CMPINT_LE);
+#else
+    return !(p1 > p2);
+#endif
+  }
+
+  // wide //
+
+  template <typename T, int W, typename = traits::is_wide_pack_t<T, W>>
+  TSIMD_INLINE mask<T, W> operator<=(const pack<T, W> &p1, const pack<T, W> &p2)
+  {
+    return mask<T, W>(p1.vl <= p2.vl, p1.vh <= p2.vh);
+  }
+
   // Inferred pack-scalar operators ///////////////////////////////////////////
 
   template <typename T,
@@ -161,4 +361,4 @@ namespace tsimd {
     return pack<T, W>(v) <= p1;
   }
 
-}  // namespace tsimd
+TSIMD_NAMESPACE_END  // namespace tsimd
@@ -26,22 +26,26 @@
 
 #include "../../pack.h"
 
-namespace tsimd {
+TSIMD_NAMESPACE_BEGIN
 
   // 1-wide //
 
   template <typename T, typename = traits::is_bool_t<T>>
-  TSIMD_INLINE mask<T, 1> operator!(const mask<T, 1> &m)
+  TSIMD_INLINE pack<T, 1> operator!(const pack<T, 1> &m)
   {
-    return mask<T, 1>(!m[0]);
+    return pack<T, 1>(!m[0]);
   }
 
   // 4-wide //
 
   TSIMD_INLINE vboolf4 operator!(const vboolf4 &m)
   {
-#if defined(__SSE__)
+#if defined(__AVX512VL__)
+    return _mm512_kxor(m, 0xF);
+#elif defined(__SSE__)
     return _mm_xor_ps(m, vboolf4(true));
+#elif TSIMD_VECTOR_EXTENSIONS
+    return detail::from_vext<vboolf4>(~detail::vext(m));
 #else
     vboolf4 result;
 
@@ -54,19 +58,29 @@ namespace tsimd {
 
   TSIMD_INLINE vboold4 operator!(const vboold4 &m)
   {
+#if defined(__AVX512VL__)
+    return _mm512_kxor(m, 0xF);
+#elif defined(__AVX__)
+    return _mm256_xor_pd(m, vboold4(true));
+#elif TSIMD_VECTOR_EXTENSIONS
+    return detail::from_vext<vboold4>(~detail::vext(m));
+#else
     vboold4 result;
 
     for (int i = 0; i < 4; ++i)
       result[i] = !m[i];
 
     return result;
+#endif
   }
 
   // 8-wide //
 
   TSIMD_INLINE vboolf8 operator!(const vboolf8 &m)
   {
-#if defined(__AVX512F__) || defined(__AVX2__) || defined(__AVX__)
+#if defined(__AVX512VL__)
+    return _mm512_knot(m);
+#elif defined(__AVX512F__) || defined(__AVX2__) || defined(__AVX__)
     return _mm256_xor_ps(m, vboolf8(true));
 #else
     return vboolf8(!vboolf4(m.vl), !vboolf4(m.vh));
@@ -75,7 +89,11 @@ namespace tsimd {
 
   TSIMD_INLINE vboold8 operator!(const vboold8 &m)
   {
+#if defined(__AVX512F__)
+    return _mm512_knot(m);
+#else
     return vboold8(!vboold4(m.vl), !vboold4(m.vh));
+#endif
   }
 
   // 16-wide //
@@ -91,7 +109,101 @@ namespace tsimd {
 
   TSIMD_INLINE vboold16 operator!(const vboold16 &m)
   {
+#if defined(__AVX512F__)
+    return _mm512_knot(m);
+#else
     return vboold16(!vboold8(m.vl), !vboold8(m.vh));
+#endif
+  }
+
+  // 8/16-bit //
+
+  TSIMD_INLINE vboolc16 operator!(const vboolc16 &m)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    return _mm512_knot(m);
+#elif defined(__SSE__)
+    return _mm_xor_si128(m, _mm_set1_epi32(-1));
+#elif TSIMD_VECTOR_EXTENSIONS
+    return detail::from_vext<vboolc16>(~detail::vext(m));
+#else
+    vboolc16 result;
+
+    for (int i = 0; i < 16; ++i)
+      result[i] = !m[i];
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vbools8 operator!(const vbools8 &m)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    return _mm512_knot(m);
+#elif defined(__SSE__)
+    return _mm_xor_si128(m, _mm_set1_epi32(-1));
+#elif TSIMD_VECTOR_EXTENSIONS
+    return detail::from_vext<vbools8>(~detail::vext(m));
+#else
+    vbools8 result;
+
+    for (int i = 0; i < 8; ++i)
+      result[i] = !m[i];
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vboolc32 operator!(const vboolc32 &m)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    return _knot_mask32(m);
+#elif defined(__AVX2__)
+    return _mm256_xor_si256(m, _mm256_set1_epi32(-1));
+#else
+    return vboolc32(!vboolc16(m.vl), !vboolc16(m.vh));
+#endif
+  }
+
+  TSIMD_INLINE vbools16 operator!(const vbools16 &m)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    return _mm512_knot(m);
+#elif defined(__AVX2__)
+    return _mm256_xor_si256(m, _mm256_set1_epi32(-1));
+#else
+    return vbools16(!vbools8(m.vl), !vbools8(m.vh));
+#endif
+  }
+
+  TSIMD_INLINE vboolc64 operator!(const vboolc64 &m)
+  {
+#if defined(__AVX512BW__)
+    return _knot_mask64(m);
+#elif defined(__AVX512F__)
+    return _mm512_xor_si512(m, _mm512_set1_epi32(-1));
+#else
+    return vboolc64(!vboolc32(m.vl), !vboolc32(m.vh));
+#endif
+  }
+
+  TSIMD_INLINE vbools32 operator!(const vbools32 &m)
+  {
+#if defined(__AVX512BW__)
+    return _knot_mask32(m);
+#elif defined(__AVX512F__)
+    return _mm512_xor_si512(m, _mm512_set1_epi32(-1));
+#else
+    return vbools32(!vbools16(m.vl), !vbools16(m.vh));
+#endif
+  }
+
+  // wide //
+
+  template <typename T, int W, typename = traits::is_wide_pack_t<T, W>>
+  TSIMD_INLINE pack<T, W> operator!(const pack<T, W> &m)
+  {
+    return pack<T, W>(!m.vl, !m.vh);
   }
 
-}  // namespace tsimd
\ No newline at end of file
+TSIMD_NAMESPACE_END  // namespace tsimd
\ No newline at end of file
@@ -25,12 +25,13 @@
 #pragma once
 
 #include <array>
+#include <cstring>
 #include <iostream>
 
 #include "config.h"
 #include "tsimd_traits.h"
 
-namespace tsimd {
+TSIMD_NAMESPACE_BEGIN
 
   template <typename T, int W = TSIMD_DEFAULT_WIDTH>
   struct pack;
@@ -38,6 +39,92 @@ namespace tsimd {
   template <typename OTHER_T, typename T, int W>
   TSIMD_INLINE pack<OTHER_T, W> convert_elements_to(const pack<T, W> &from);
 
+  namespace detail {
+
+    // NOTE: masks stored as AVX-512 mask bits have no addressable lanes, so
+    //       operator[]() hands out this proxy instead of a T&
+
+    template <typename T, typename BITS_T>
+    struct bitmask_lane_ref
+    {
+      TSIMD_INLINE operator T() const
+      {
+        return T(((bits >> lane) & 1) != 0);
+      }
+
+      TSIMD_INLINE explicit operator bool() const
+      {
+        return ((bits >> lane) & 1) != 0;
+      }
+
+      TSIMD_INLINE bitmask_lane_ref &operator=(bool b)
+      {
+        const BITS_T bit = BITS_T(1) << lane;
+        bits = b ? BITS_T(bits | bit) : BITS_T(bits & ~bit);
+        return *this;
+      }
+
+      TSIMD_INLINE bitmask_lane_ref &operator=(const T &b)
+      {
+        return *this = static_cast<bool>(b);
+      }
+
+      TSIMD_INLINE bitmask_lane_ref &operator=(const bitmask_lane_ref &o)
+      {
+        return *this = static_cast<bool>(o);
+      }
+
+      BITS_T &bits;
+      int lane;
+    };
+
+    // NOTE: lanes of a wide pack live in its two halves, which only need a
+    //       split access when the halves are stored as mask bits
+
+    enum class lane_storage
+    {
+      array,
+      bits,
+      halves
+    };
+
+    template <typename T,
+              int W,
+              bool IS_WIDE = traits::is_wide_pack<T, W>::value>
+    struct lane_traits
+    {
+      static const bool is_bits = traits::is_bitmask<T, W>::value;
+
+      static const lane_storage storage =
+          is_bits ? lane_storage::bits : lane_storage::array;
+
+      using reference_t = typename std::conditional<
+          is_bits,
+          bitmask_lane_ref<T, typename traits::simd_type<T, W>::type>,
+          T &>::type;
+
+      using const_reference_t =
+          typename std::conditional<is_bits, T, const T &>::type;
+    };
+
+    template <typename T, int W>
+    struct lane_traits<T, W, true>
+    {
+      using half_traits = lane_traits<T, W / 2>;
+
+      static const lane_storage storage =
+          half_traits::storage == lane_storage::array ? lane_storage::array
+                                                      : lane_storage::halves;
+
+      using reference_t       = typename half_traits::reference_t;
+      using const_reference_t = typename half_traits::const_reference_t;
+    };
+
+    template <lane_storage S>
+    struct lane_access;
+
+  }  // namespace detail
+
   template <typename T, int W>
   struct pack
   {
@@ -49,14 +136,30 @@ namespace tsimd {
     };
     using value_t          = typename std::decay<T>::type;
     using intrinsic_t      = typename traits::simd_type<value_t, W>::type;
-    using half_intrinsic_t = typename traits::half_simd_type<value_t, W>::type;
     using cast_intrinsic_t = typename traits::cast_simd_type<value_t, W>::type;
 
+    // NOTE: wide packs are built from two half-width packs
+    using half_intrinsic_t = typename std::conditional<
+        traits::is_wide_pack<value_t, W>::value,
+        pack<T, W / 2>,
+        typename traits::half_simd_type<value_t, W>::type>::type;
+
+    using reference_t = typename detail::lane_traits<T, W>::reference_t;
+    using const_reference_t =
+        typename detail::lane_traits<T, W>::const_reference_t;
+
     // Construction //
 
     pack() = default;
     explicit pack(T value);
 
+    // NOTE: only valid for masks stored as bits, keeps 'true' from silently
+    //       converting to the intrinsic_t (i.e. only setting lane 0)
+    template <typename B = value_t, typename = traits::is_bitmask_t<B, W>>
+    explicit pack(bool value) : pack(T(value))
+    {
+    }
+
     // NOTE: only valid for W == 4! (otherwise it's a compile error)
     pack(T v0, T v1, T v2, T v3);
 
@@ -84,6 +187,11 @@ namespace tsimd {
     pack(traits::enable_if_t<!traits::half_simd_is_array<T, W>::value, IT> a,
          half_intrinsic_t b) : vl(a), vh(b) {}
 
+    // construct from 2 x half-width pack<> (exact match beats the
+    // std::array<> conversion, which has no lanes behind it for bit masks)
+    template <int HW, typename = traits::enable_if_t<HW * 2 == W>>
+    pack(const pack<T, HW> &a, const pack<T, HW> &b);
+
     explicit pack(const std::array<T, W / 2> &a, const std::array<T, W / 2> &b);
     explicit pack(const std::array<T, W> &arr);
 
@@ -91,8 +199,8 @@ namespace tsimd {
 
     // Array access //
 
-    const T &operator[](int i) const;
-    T &operator[](int i);
+    const_reference_t operator[](int i) const;
+    reference_t operator[](int i);
 
     // Cast //
 
@@ -140,11 +248,16 @@ namespace tsimd {
     // Interface checks //
 
     static_assert(traits::valid_type_for_pack<T>::value,
-                  "pack 'T' type currently must be 'float', 'int', 'double',"
-                  " 'long long', 'bool32_t', or 'bool64_t'!");
-
-    static_assert(W == 1 || W == 4 || W == 8 || W == 16,
-                  "pack 'W' size must be 1, 4, 8, or 16!");
+                  "pack 'T' type currently must be 'float', 'int',"
+                  " 'unsigned int', 'double', 'long long',"
+                  " 'unsigned long long', 'signed char', 'unsigned char',"
+                  " 'short', 'unsigned short', or a matching 'boolN_t'!");
+
+    // NOTE: 8/16-bit elements need 32/64 lanes to fill an AVX2/AVX-512
+    //       register, wider element types unroll 32/64 lanes over 2-4
+    //       AVX-512 registers (or more on narrower ISAs)
+    static_assert(W == 1 || W == 4 || W == 8 || W == 16 || W == 32 || W == 64,
+                  "pack 'W' size must be 1, 4, 8, 16, 32, or 64!");
   };
 
   // mask types and true/false value aliases //////////////////////////////////
@@ -161,6 +274,12 @@ namespace tsimd {
   template <int W = TSIMD_DEFAULT_WIDTH>
   using maskd = pack<bool64_t, W>;
 
+  template <int W = TSIMD_DEFAULT_WIDTH * 4>
+  using maskc = pack<bool8_t, W>;
+
+  template <int W = TSIMD_DEFAULT_WIDTH * 2>
+  using masks = pack<bool16_t, W>;
+
   // Mask type for a given pack ///////////////////////////////////////////////
 
   template <typename MASK_T>
@@ -182,8 +301,17 @@ namespace tsimd {
 
   template <int W> using vdoublen = pack<double, W>;
   template <int W> using vllongn  = pack<long long, W>;
+  template <int W> using vullongn = pack<unsigned long long, W>;
   template <int W> using vbooldn  = maskd<W>;
 
+  template <int W> using vscharn  = pack<signed char, W>;
+  template <int W> using vucharn  = pack<unsigned char, W>;
+  template <int W> using vboolcn  = maskc<W>;
+
+  template <int W> using vshortn  = pack<short, W>;
+  template <int W> using vushortn = pack<unsigned short, W>;
+  template <int W> using vboolsn  = masks<W>;
+
   /* 1-wide shortcuts */
   using vfloat1  = vfloatn<1>;
   using vint1    = vintn<1>;
@@ -191,6 +319,7 @@ namespace tsimd {
   using vboolf1  = maskf<1>;
 
   using vllong1  = vllongn<1>;
+  using vullong1 = vullongn<1>;
   using vdouble1 = vdoublen<1>;
   using vboold1  = maskd<1>;
 
@@ -202,6 +331,7 @@ namespace tsimd {
 
   using vdouble4 = vdoublen<4>;
   using vllong4  = vllongn<4>;
+  using vullong4 = vullongn<4>;
   using vboold4  = maskd<4>;
 
   /* 8-wide shortcuts */
@@ -212,6 +342,7 @@ namespace tsimd {
 
   using vdouble8 = vdoublen<8>;
   using vllong8  = vllongn<8>;
+  using vullong8 = vullongn<8>;
   using vboold8  = maskd<8>;
 
   /* 16-wide shortcuts */
@@ -222,8 +353,55 @@ namespace tsimd {
 
   using vdouble16 = vdoublen<16>;
   using vllong16  = vllongn<16>;
+  using vullong16 = vullongn<16>;
   using vboold16  = maskd<16>;
 
+  /* wide shortcuts (unrolled over 2 or 4 x 16-wide packs) */
+  using vfloat32  = vfloatn<32>;
+  using vint32    = vintn<32>;
+  using vuint32   = vuintn<32>;
+  using vboolf32  = maskf<32>;
+
+  using vdouble32 = vdoublen<32>;
+  using vllong32  = vllongn<32>;
+  using vullong32 = vullongn<32>;
+  using vboold32  = maskd<32>;
+
+  using vfloat64  = vfloatn<64>;
+  using vint64    = vintn<64>;
+  using vuint64   = vuintn<64>;
+  using vboolf64  = maskf<64>;
+
+  using vdouble64 = vdoublen<64>;
+  using vllong64  = vllongn<64>;
+  using vullong64 = vullongn<64>;
+  using vboold64  = maskd<64>;
+
+  /* 8/16-bit shortcuts (named by lane count, one per register size) */
+  using vschar16  = vscharn<16>;
+  using vuchar16  = vucharn<16>;
+  using vboolc16  = maskc<16>;
+
+  using vshort8   = vshortn<8>;
+  using vushort8  = vushortn<8>;
+  using vbools8   = masks<8>;
+
+  using vschar32  = vscharn<32>;
+  using vuchar32  = vucharn<32>;
+  using vboolc32  = maskc<32>;
+
+  using vshort16  = vshortn<16>;
+  using vushort16 = vushortn<16>;
+  using vbools16  = masks<16>;
+
+  using vschar64  = vscharn<64>;
+  using vuchar64  = vucharn<64>;
+  using vboolc64  = maskc<64>;
+
+  using vshort32  = vshortn<32>;
+  using vushort32 = vushortn<32>;
+  using vbools32  = masks<32>;
+
   /* default shortcuts */
   using vfloat  = vfloatn<TSIMD_DEFAULT_WIDTH>;
   using vint    = vintn<TSIMD_DEFAULT_WIDTH>;
@@ -232,20 +410,48 @@ namespace tsimd {
 
   using vdouble = vdoublen<TSIMD_DEFAULT_WIDTH>;
   using vllong  = vllongn<TSIMD_DEFAULT_WIDTH>;
+  using vullong = vullongn<TSIMD_DEFAULT_WIDTH>;
   using vboold  = maskd<TSIMD_DEFAULT_WIDTH>;
 
+  using vschar  = vscharn<TSIMD_DEFAULT_WIDTH * 4>;
+  using vuchar  = vucharn<TSIMD_DEFAULT_WIDTH * 4>;
+  using vboolc  = maskc<TSIMD_DEFAULT_WIDTH * 4>;
+
+  using vshort  = vshortn<TSIMD_DEFAULT_WIDTH * 2>;
+  using vushort = vushortn<TSIMD_DEFAULT_WIDTH * 2>;
+  using vbools  = masks<TSIMD_DEFAULT_WIDTH * 2>;
+
   // pack<> inlined members ///////////////////////////////////////////////////
 
   // pack<>::pack(T value) + specializations //
 
-  template <typename T, int W>
-  TSIMD_INLINE pack<T, W>::pack(T value)
-  {
+  namespace detail {
+
+    template <typename T, int W>
+    TSIMD_INLINE void broadcast(pack<T, W> &p, T value, std::false_type)
+    {
 #if TSIMD_USE_OPENMP
 #  pragma omp simd
 #endif
-    for (int i = 0; i < W; ++i)
-      arr[i] = value;
+      for (int i = 0; i < W; ++i)
+        p.arr[i] = value;
+    }
+
+    template <typename T, int W>
+    TSIMD_INLINE void broadcast(pack<T, W> &p, T value, std::true_type)
+    {
+      p.vl = pack<T, W / 2>(value);
+      p.vh = p.vl;
+    }
+
+  }  // namespace detail
+
+  template <typename T, int W>
+  TSIMD_INLINE pack<T, W>::pack(T value)
+  {
+    using is_wide = traits::is_wide_pack<value_t, W>;
+    detail::broadcast(
+        *this, value, std::integral_constant<bool, is_wide::value>());
   }
 
   // 4-wide //
@@ -262,6 +468,54 @@ namespace tsimd {
       : v(_mm_set1_epi32(value))
   {
   }
+
+  template <>
+  TSIMD_INLINE vuint4::pack(unsigned int value)
+      : v(_mm_set1_epi32(value))
+  {
+  }
+#endif
+
+#if defined(__AVX512VL__)
+  template <>
+  TSIMD_INLINE vboolf4::pack(bool32_t value)
+      : v(value ? 0xF : 0x0)
+  {
+  }
+#endif
+
+#if defined(__AVX__)
+  template <>
+  TSIMD_INLINE vdouble4::pack(double value)
+      : v(_mm256_set1_pd(value))
+  {
+  }
+
+  template <>
+  TSIMD_INLINE vllong4::pack(long long value)
+      : v(_mm256_set1_epi64x(value))
+  {
+  }
+
+  template <>
+  TSIMD_INLINE vullong4::pack(unsigned long long value)
+      : v(_mm256_set1_epi64x(value))
+  {
+  }
+
+#if defined(__AVX512VL__)
+  template <>
+  TSIMD_INLINE vboold4::pack(bool64_t value)
+      : v(value ? 0xF : 0x0)
+  {
+  }
+#else
+  template <>
+  TSIMD_INLINE vboold4::pack(bool64_t value)
+      : v(_mm256_castsi256_pd(_mm256_set1_epi64x(value.value)))
+  {
+  }
+#endif
 #endif
 
   // 8-wide //
@@ -278,6 +532,46 @@ namespace tsimd {
       : v(_mm256_set1_epi32(value))
   {
   }
+
+  template <>
+  TSIMD_INLINE vuint8::pack(unsigned int value)
+      : v(_mm256_set1_epi32(value))
+  {
+  }
+#endif
+
+#if defined(__AVX512VL__)
+  template <>
+  TSIMD_INLINE vboolf8::pack(bool32_t value)
+      : v(value ? 0xFF : 0x0)
+  {
+  }
+#endif
+
+#if defined(__AVX512F__)
+  template <>
+  TSIMD_INLINE vdouble8::pack(double value)
+      : v(_mm512_set1_pd(value))
+  {
+  }
+
+  template <>
+  TSIMD_INLINE vllong8::pack(long long value)
+      : v(_mm512_set1_epi64(value))
+  {
+  }
+
+  template <>
+  TSIMD_INLINE vullong8::pack(unsigned long long value)
+      : v(_mm512_set1_epi64(value))
+  {
+  }
+
+  template <>
+  TSIMD_INLINE vboold8::pack(bool64_t value)
+      : v(value ? 0xFF : 0x0)
+  {
+  }
 #endif
 
   // 16-wide //
@@ -294,6 +588,182 @@ namespace tsimd {
       : v(_mm512_set1_epi32(value))
   {
   }
+
+  template <>
+  TSIMD_INLINE vuint16::pack(unsigned int value)
+      : v(_mm512_set1_epi32(value))
+  {
+  }
+
+  template <>
+  TSIMD_INLINE vboolf16::pack(bool32_t value)
+      : v(value ? 0xFFFF : 0x0)
+  {
+  }
+
+  template <>
+  TSIMD_INLINE vboold16::pack(bool64_t value)
+      : v(value ? 0xFFFF : 0x0)
+  {
+  }
+#endif
+
+  // 8/16-bit //
+
+#if defined(__SSE__)
+  template <>
+  TSIMD_INLINE vschar16::pack(signed char value)
+      : v(_mm_set1_epi8(value))
+  {
+  }
+
+  template <>
+  TSIMD_INLINE vuchar16::pack(unsigned char value)
+      : v(_mm_set1_epi8(value))
+  {
+  }
+
+  template <>
+  TSIMD_INLINE vshort8::pack(short value)
+      : v(_mm_set1_epi16(value))
+  {
+  }
+
+  template <>
+  TSIMD_INLINE vushort8::pack(unsigned short value)
+      : v(_mm_set1_epi16(value))
+  {
+  }
+#endif
+
+#if defined(__AVX__)
+  template <>
+  TSIMD_INLINE vschar32::pack(signed char value)
+      : v(_mm256_set1_epi8(value))
+  {
+  }
+
+  template <>
+  TSIMD_INLINE vuchar32::pack(unsigned char value)
+      : v(_mm256_set1_epi8(value))
+  {
+  }
+
+  template <>
+  TSIMD_INLINE vshort16::pack(short value)
+      : v(_mm256_set1_epi16(value))
+  {
+  }
+
+  template <>
+  TSIMD_INLINE vushort16::pack(unsigned short value)
+      : v(_mm256_set1_epi16(value))
+  {
+  }
+#endif
+
+#if defined(__AVX512F__)
+  template <>
+  TSIMD_INLINE vschar64::pack(signed char value)
+      : v(_mm512_set1_epi8(value))
+  {
+  }
+
+  template <>
+  TSIMD_INLINE vuchar64::pack(unsigned char value)
+      : v(_mm512_set1_epi8(value))
+  {
+  }
+
+  template <>
+  TSIMD_INLINE vshort32::pack(short value)
+      : v(_mm512_set1_epi16(value))
+  {
+  }
+
+  template <>
+  TSIMD_INLINE vushort32::pack(unsigned short value)
+      : v(_mm512_set1_epi16(value))
+  {
+  }
+#endif
+
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+  template <>
+  TSIMD_INLINE vboolc16::pack(bool8_t value)
+      : v(value ? 0xFFFF : 0x0)
+  {
+  }
+
+  template <>
+  TSIMD_INLINE vbools8::pack(bool16_t value)
+      : v(value ? 0xFF : 0x0)
+  {
+  }
+#elif defined(__SSE__)
+  template <>
+  TSIMD_INLINE vboolc16::pack(bool8_t value)
+      : v(_mm_set1_epi8(value.value))
+  {
+  }
+
+  template <>
+  TSIMD_INLINE vbools8::pack(bool16_t value)
+      : v(_mm_set1_epi16(value.value))
+  {
+  }
+#endif
+
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+  template <>
+  TSIMD_INLINE vboolc32::pack(bool8_t value)
+      : v(value ? 0xFFFFFFFF : 0x0)
+  {
+  }
+
+  template <>
+  TSIMD_INLINE vbools16::pack(bool16_t value)
+      : v(value ? 0xFFFF : 0x0)
+  {
+  }
+#elif defined(__AVX__)
+  template <>
+  TSIMD_INLINE vboolc32::pack(bool8_t value)
+      : v(_mm256_set1_epi8(value.value))
+  {
+  }
+
+  template <>
+  TSIMD_INLINE vbools16::pack(bool16_t value)
+      : v(_mm256_set1_epi16(value.value))
+  {
+  }
+#endif
+
+#if defined(__AVX512BW__)
+  template <>
+  TSIMD_INLINE vboolc64::pack(bool8_t value)
+      : v(value ? 0xFFFFFFFFFFFFFFFFULL : 0x0)
+  {
+  }
+
+  template <>
+  TSIMD_INLINE vbools32::pack(bool16_t value)
+      : v(value ? 0xFFFFFFFF : 0x0)
+  {
+  }
+#elif defined(__AVX512F__)
+  template <>
+  TSIMD_INLINE vboolc64::pack(bool8_t value)
+      : v(_mm512_set1_epi8(value.value))
+  {
+  }
+
+  template <>
+  TSIMD_INLINE vbools32::pack(bool16_t value)
+      : v(_mm512_set1_epi16(value.value))
+  {
+  }
 #endif
 
   // Generic pack<> members //
@@ -365,6 +835,82 @@ namespace tsimd {
       arr[i] = b[j];
   }
 
+  namespace detail {
+
+    enum class halves_storage
+    {
+      registers,
+      bits,
+      lanes
+    };
+
+    template <halves_storage S>
+    using halves_storage_t = std::integral_constant<halves_storage, S>;
+
+    template <typename T, int W, int HW>
+    TSIMD_INLINE void combine_halves(
+        pack<T, W> &p,
+        const pack<T, HW> &a,
+        const pack<T, HW> &b,
+        halves_storage_t<halves_storage::registers>)
+    {
+      p.vl = a;
+      p.vh = b;
+    }
+
+    // NOTE: 4-lane mask halves don't fill a whole byte, so shift them into
+    //       place instead of writing the vl/vh members
+    template <typename T, int W, int HW>
+    TSIMD_INLINE void combine_halves(pack<T, W> &p,
+                                     const pack<T, HW> &a,
+                                     const pack<T, HW> &b,
+                                     halves_storage_t<halves_storage::bits>)
+    {
+      using bits_t = typename pack<T, W>::intrinsic_t;
+      const unsigned int lo = a.v & ((1u << HW) - 1);
+      const unsigned int hi = b.v & ((1u << HW) - 1);
+      p.v = bits_t(lo | (hi << HW));
+    }
+
+    template <typename T, int W, int HW>
+    TSIMD_INLINE void combine_halves(pack<T, W> &p,
+                                     const pack<T, HW> &a,
+                                     const pack<T, HW> &b,
+                                     halves_storage_t<halves_storage::lanes>)
+    {
+      for (int i = 0; i < HW; ++i) {
+        p[i]      = a[i];
+        p[HW + i] = b[i];
+      }
+    }
+
+  }  // namespace detail
+
+  template <typename T, int W>
+  template <int HW, typename>
+  TSIMD_INLINE pack<T, W>::pack(const pack<T, HW> &a, const pack<T, HW> &b)
+  {
+    using storage = detail::halves_storage;
+
+    constexpr bool full_is_bits = traits::is_bitmask<value_t, W>::value;
+    constexpr bool half_is_bits = traits::is_bitmask<value_t, HW>::value;
+    constexpr bool same_storage =
+        (std::is_same<half_intrinsic_t,
+                      typename pack<T, HW>::intrinsic_t>::value &&
+         full_is_bits == half_is_bits) ||
+        std::is_same<half_intrinsic_t, pack<T, HW>>::value;
+
+    detail::combine_halves(
+        *this,
+        a,
+        b,
+        detail::halves_storage_t<same_storage
+                                     ? storage::registers
+                                     : (full_is_bits && half_is_bits
+                                            ? storage::bits
+                                            : storage::lanes)>());
+  }
+
   template <typename T, int W>
   TSIMD_INLINE pack<T, W> &pack<T, W>::operator=(const value_t &v)
   {
@@ -372,16 +918,74 @@ namespace tsimd {
     return *this;
   }
 
+  namespace detail {
+
+    template <>
+    struct lane_access<lane_storage::array>
+    {
+      template <typename T, int W>
+      static TSIMD_INLINE const T &get(const pack<T, W> &p, int i)
+      {
+        return p.arr[i];
+      }
+
+      template <typename T, int W>
+      static TSIMD_INLINE T &get(pack<T, W> &p, int i)
+      {
+        return p.arr[i];
+      }
+    };
+
+    template <>
+    struct lane_access<lane_storage::bits>
+    {
+      template <typename T, int W>
+      static TSIMD_INLINE T get(const pack<T, W> &p, int i)
+      {
+        return T(((p.v >> i) & 1) != 0);
+      }
+
+      template <typename T, int W>
+      static TSIMD_INLINE typename pack<T, W>::reference_t get(pack<T, W> &p,
+                                                              int i)
+      {
+        return {p.v, i};
+      }
+    };
+
+    template <>
+    struct lane_access<lane_storage::halves>
+    {
+      template <typename T, int W>
+      static TSIMD_INLINE typename pack<T, W>::const_reference_t get(
+          const pack<T, W> &p, int i)
+      {
+        return i < W / 2 ? p.vl[i] : p.vh[i - W / 2];
+      }
+
+      template <typename T, int W>
+      static TSIMD_INLINE typename pack<T, W>::reference_t get(pack<T, W> &p,
+                                                              int i)
+      {
+        return i < W / 2 ? p.vl[i] : p.vh[i - W / 2];
+      }
+    };
+
+  }  // namespace detail
+
   template <typename T, int W>
-  TSIMD_INLINE const T &pack<T, W>::operator[](int i) const
+  TSIMD_INLINE typename pack<T, W>::const_reference_t pack<T, W>::operator[](
+      int i) const
   {
-    return arr[i];
+    return detail::lane_access<detail::lane_traits<T, W>::storage>::get(*this,
+                                                                      i);
   }
 
   template <typename T, int W>
-  TSIMD_INLINE T &pack<T, W>::operator[](int i)
+  TSIMD_INLINE typename pack<T, W>::reference_t pack<T, W>::operator[](int i)
   {
-    return arr[i];
+    return detail::lane_access<detail::lane_traits<T, W>::storage>::get(*this,
+                                                                      i);
   }
 
   template <typename T, int W>
@@ -483,8 +1087,8 @@ namespace tsimd {
   {
     o << "{";
 
-    for (const auto &v : p)
-      o << " " << v;
+    for (int i = 0; i < W; ++i)
+      o << " " << p[i];
 
     o << " }";
 
@@ -499,18 +1103,39 @@ namespace tsimd {
 
   // pack<> cast definition ///////////////////////////////////////////////////
 
-  template <typename OTHER_T, typename T, int W>
-  TSIMD_INLINE pack<OTHER_T, W> convert_elements_to(const pack<T, W> &from)
-  {
-    pack<OTHER_T, W> to;
+  namespace detail {
+
+    template <typename OTHER_T, typename T, int W>
+    TSIMD_INLINE pack<OTHER_T, W> convert_elements(const pack<T, W> &from,
+                                                   std::false_type)
+    {
+      pack<OTHER_T, W> to;
 
 #if TSIMD_USE_OPENMP
 #  pragma omp simd
 #endif
-    for (int i = 0; i < W; ++i)
-      to[i] = from[i];
+      for (int i = 0; i < W; ++i)
+        to[i] = from[i];
+
+      return to;
+    }
+
+    template <typename OTHER_T, typename T, int W>
+    TSIMD_INLINE pack<OTHER_T, W> convert_elements(const pack<T, W> &from,
+                                                   std::true_type)
+    {
+      return pack<OTHER_T, W>(convert_elements_to<OTHER_T>(from.vl),
+                              convert_elements_to<OTHER_T>(from.vh));
+    }
 
-    return to;
+  }  // namespace detail
+
+  template <typename OTHER_T, typename T, int W>
+  TSIMD_INLINE pack<OTHER_T, W> convert_elements_to(const pack<T, W> &from)
+  {
+    using is_wide = traits::is_wide_pack<T, W>;
+    return detail::convert_elements<OTHER_T>(
+        from, std::integral_constant<bool, is_wide::value>());
   }
 
   // pack<> reinterpret_cast //////////////////////////////////////////////////
@@ -538,7 +1163,17 @@ namespace tsimd {
     static_assert(traits::valid_type_for_pack<TO_TYPE>::value,
                   "reinterpret_elements_as<> can only cast to valid pack"
                   " element types!");
-    return pack<TO_TYPE, W>((const typename pack<TO_TYPE, W>::intrinsic_t)p);
+#if !TSIMD_VECTOR_EXTENSIONS
+    // NOTE: 1-wide packs hold a plain scalar, where the cast is a value
+    //       conversion (e.g. between signed and unsigned) instead of a bit cast
+    if (W != 1)
+      return pack<TO_TYPE, W>((const typename pack<TO_TYPE, W>::intrinsic_t)p);
+#endif
+    // NOTE: compiler vector types of other lanes don't convert through the
+    //       pack's conversion operators, so copy the bits instead
+    pack<TO_TYPE, W> result;
+    std::memcpy(&result, &p, sizeof(result));
+    return result;
   }
 
   //NOTE(jda) - 'FROM_TYPE' and 'W' are implied from function parameter, user
@@ -560,8 +1195,177 @@ namespace tsimd {
                   "reinterpret_elements_as<> can only cast to valid pack"
                   " element types!");
 
-    using T = const std::array<TO_TYPE, W>;
-    return pack<TO_TYPE, W>(*(reinterpret_cast<T*>(p.begin())));
+    // NOTE: copy the bits, reading the lanes through a pointer of the other
+    //       element type breaks strict aliasing
+    pack<TO_TYPE, W> result;
+    std::memcpy(&result, &p, sizeof(result));
+    return result;
+  }
+
+  // unsigned pack<> helpers //////////////////////////////////////////////////
+
+  namespace detail {
+
+    // NOTE: unsigned packs reuse the signed implementation of any operation
+    //       where the sign of the elements doesn't change the result bits
+
+    template <typename T, int W>
+    TSIMD_INLINE pack<typename traits::signed_type_for<T>::type, W> as_signed(
+        const pack<T, W> &p)
+    {
+      return reinterpret_elements_as<
+          typename traits::signed_type_for<T>::type>(p);
+    }
+
+    template <typename T, int W>
+    TSIMD_INLINE pack<typename traits::unsigned_type_for<T>::type, W>
+    as_unsigned(const pack<T, W> &p)
+    {
+      return reinterpret_elements_as<
+          typename traits::unsigned_type_for<T>::type>(p);
+    }
+
+  }  // namespace detail
+
+  // unsigned <--> floating point conversions //
+
+  // 4-wide //
+
+  template <>
+  TSIMD_INLINE vfloat4 convert_elements_to<float>(const vuint4 &from)
+  {
+#if defined(__AVX512VL__)
+    return _mm_cvtepu32_ps(from);
+#elif defined(__SSE__)
+    // NOTE: each 16-bit half converts exactly, so only the add rounds
+    const __m128i lo = _mm_and_si128(from, _mm_set1_epi32(0xFFFF));
+    const __m128i hi = _mm_srli_epi32(from, 16);
+    return _mm_add_ps(
+        _mm_mul_ps(_mm_cvtepi32_ps(hi), _mm_set1_ps(65536.f)),
+        _mm_cvtepi32_ps(lo));
+#else
+    vfloat4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = from[i];
+
+    return result;
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vuint4 convert_elements_to<unsigned int>(const vfloat4 &from)
+  {
+#if defined(__AVX512VL__)
+    return _mm_cvttps_epu32(from);
+#elif defined(__SSE__)
+    // NOTE: lanes >= 2^31 don't fit the signed conversion, so bring them
+    //       down by 2^31 first and put the top bit back afterwards
+    const __m128 two31 = _mm_set1_ps(2147483648.f);
+    const __m128 big   = _mm_cmpge_ps(from, two31);
+    const __m128i i =
+        _mm_cvttps_epi32(_mm_sub_ps(from, _mm_and_ps(big, two31)));
+    return _mm_xor_si128(i, _mm_slli_epi32(_mm_castps_si128(big), 31));
+#else
+    vuint4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = from[i];
+
+    return result;
+#endif
   }
 
-}  // namespace tsimd
+#if defined(__AVX512VL__) && defined(__AVX512DQ__)
+  template <>
+  TSIMD_INLINE vdouble4 convert_elements_to<double>(const vullong4 &from)
+  {
+    return _mm256_cvtepu64_pd(from);
+  }
+
+  template <>
+  TSIMD_INLINE vullong4 convert_elements_to<unsigned long long>(
+      const vdouble4 &from)
+  {
+    return _mm256_cvttpd_epu64(from);
+  }
+#endif
+
+  // 8-wide //
+
+  template <>
+  TSIMD_INLINE vfloat8 convert_elements_to<float>(const vuint8 &from)
+  {
+#if defined(__AVX512VL__)
+    return _mm256_cvtepu32_ps(from);
+#elif defined(__AVX2__)
+    const __m256i lo = _mm256_and_si256(from, _mm256_set1_epi32(0xFFFF));
+    const __m256i hi = _mm256_srli_epi32(from, 16);
+    return _mm256_add_ps(
+        _mm256_mul_ps(_mm256_cvtepi32_ps(hi), _mm256_set1_ps(65536.f)),
+        _mm256_cvtepi32_ps(lo));
+#else
+    return vfloat8(convert_elements_to<float>(vuint4(from.vl)),
+                   convert_elements_to<float>(vuint4(from.vh)));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vuint8 convert_elements_to<unsigned int>(const vfloat8 &from)
+  {
+#if defined(__AVX512VL__)
+    return _mm256_cvttps_epu32(from);
+#elif defined(__AVX2__)
+    const __m256 two31 = _mm256_set1_ps(2147483648.f);
+    const __m256 big   = _mm256_cmp_ps(from, two31, _CMP_GE_OQ);
+    const __m256i i =
+        _mm256_cvttps_epi32(_mm256_sub_ps(from, _mm256_and_ps(big, two31)));
+    return _mm256_xor_si256(i, _mm256_slli_epi32(_mm256_castps_si256(big), 31));
+#else
+    return vuint8(convert_elements_to<unsigned int>(vfloat4(from.vl)),
+                  convert_elements_to<unsigned int>(vfloat4(from.vh)));
+#endif
+  }
+
+#if defined(__AVX512DQ__)
+  template <>
+  TSIMD_INLINE vdouble8 convert_elements_to<double>(const vullong8 &from)
+  {
+    return _mm512_cvtepu64_pd(from);
+  }
+
+  template <>
+  TSIMD_INLINE vullong8 convert_elements_to<unsigned long long>(
+      const vdouble8 &from)
+  {
+    return _mm512_cvttpd_epu64(from);
+  }
+#endif
+
+  // 16-wide //
+
+  template <>
+  TSIMD_INLINE vfloat16 convert_elements_to<float>(const vuint16 &from)
+  {
+#if defined(__AVX512F__)
+    return _mm512_cvtepu32_ps(from);
+#else
+    return vfloat16(convert_elements_to<float>(vuint8(from.vl)),
+                    convert_elements_to<float>(vuint8(from.vh)));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vuint16 convert_elements_to<unsigned int>(const vfloat16 &from)
+  {
+#if defined(__AVX512F__)
+    return _mm512_cvttps_epu32(from);
+#else
+    return vuint16(convert_elements_to<unsigned int>(vfloat8(from.vl)),
+                   convert_elements_to<unsigned int>(vfloat8(from.vh)));
+#endif
+  }
+
+TSIMD_NAMESPACE_END  // namespace tsimd
+
+#include "vector_ext.h"
@@ -27,7 +27,7 @@
 #include "bool_t.h"
 #include "config.h"
 
-namespace tsimd {
+TSIMD_NAMESPACE_BEGIN
   namespace traits {
 
     // C++14 traits for C++11 /////////////////////////////////////////////////
@@ -80,19 +80,28 @@ namespace tsimd {
     {
       static const bool value =
           std::is_same<T, float>::value || std::is_same<T, int>::value ||
+          std::is_same<T, unsigned int>::value ||
           std::is_same<T, bool32_t>::value || std::is_same<T, double>::value ||
-          std::is_same<T, long long>::value || std::is_same<T, bool64_t>::value;
+          std::is_same<T, long long>::value ||
+          std::is_same<T, unsigned long long>::value ||
+          std::is_same<T, bool64_t>::value ||
+          std::is_same<T, signed char>::value ||
+          std::is_same<T, unsigned char>::value ||
+          std::is_same<T, bool8_t>::value || std::is_same<T, short>::value ||
+          std::is_same<T, unsigned short>::value ||
+          std::is_same<T, bool16_t>::value;
     };
 
     template <typename T>
     using valid_type_for_pack_t = enable_if_t<valid_type_for_pack<T>::value>;
 
-    // If given type is a bool32_t or bool64_t ////////////////////////////////
+    // If given type is a bool8_t, bool16_t, bool32_t or bool64_t /////////////
 
     template <typename T>
     struct is_bool
     {
       static const bool value =
+          std::is_same<T, bool8_t>::value || std::is_same<T, bool16_t>::value ||
           std::is_same<T, bool32_t>::value || std::is_same<T, bool64_t>::value;
     };
 
@@ -129,308 +138,1092 @@ namespace tsimd {
     template <typename T>
     using is_not_floating_point_t = enable_if_t<!is_floating_point<T>::value>;
 
+    // If given type is an unsigned integer type (uchar/ushort/uint/ullong) ///
+
+    template <typename T>
+    struct is_unsigned
+    {
+      static const bool value = std::is_same<T, unsigned char>::value ||
+                                std::is_same<T, unsigned short>::value ||
+                                std::is_same<T, unsigned int>::value ||
+                                std::is_same<T, unsigned long long>::value;
+    };
+
+    template <typename T>
+    using is_unsigned_t = enable_if_t<is_unsigned<T>::value>;
+
+    // If a pack<T, W> is wider than any native register set ////////////////
+
+    // example: pack<float, 32> is stored as 2 x pack<float, 16>, and every
+    //          operation is unrolled over the two halves
+
+    template <typename T, int W>
+    struct is_wide_pack
+    {
+      static const bool value = (W > 16) && (sizeof(T) >= 4);
+    };
+
+    template <typename T, int W>
+    using is_wide_pack_t = enable_if_t<is_wide_pack<T, W>::value>;
+
+    template <typename T, int W>
+    using is_not_wide_pack_t = enable_if_t<!is_wide_pack<T, W>::value>;
+
+    // NOTE: 1-wide packs already have generic operators for all types, wide
+    //       packs forward to their unsigned halves
+    template <typename T, int W>
+    using is_unsigned_pack_t = enable_if_t<is_unsigned<T>::value && (W > 1) &&
+                                           !is_wide_pack<T, W>::value>;
+
+    // Signed/unsigned integer type of the same size //////////////////////////
+
+    template <typename T>
+    struct signed_type_for
+    {
+      using type = T;
+    };
+
+    template <>
+    struct signed_type_for<unsigned char>
+    {
+      using type = signed char;
+    };
+
+    template <>
+    struct signed_type_for<unsigned short>
+    {
+      using type = short;
+    };
+
+    template <>
+    struct signed_type_for<unsigned int>
+    {
+      using type = int;
+    };
+
+    template <>
+    struct signed_type_for<unsigned long long>
+    {
+      using type = long long;
+    };
+
+    template <typename T>
+    struct unsigned_type_for
+    {
+      using type = T;
+    };
+
+    template <>
+    struct unsigned_type_for<signed char>
+    {
+      using type = unsigned char;
+    };
+
+    template <>
+    struct unsigned_type_for<short>
+    {
+      using type = unsigned short;
+    };
+
+    template <>
+    struct unsigned_type_for<int>
+    {
+      using type = unsigned int;
+    };
+
+    template <>
+    struct unsigned_type_for<long long>
+    {
+      using type = unsigned long long;
+    };
+
+    // Integer type twice the size of the given one (for widening ops) ////////
+
+    template <typename T>
+    struct undefined_wide_type
+    {
+    };
+
+    template <typename T>
+    struct wide_type_for
+    {
+      using type = undefined_wide_type<T>;
+    };
+
+    template <>
+    struct wide_type_for<signed char>
+    {
+      using type = short;
+    };
+
+    template <>
+    struct wide_type_for<unsigned char>
+    {
+      using type = unsigned short;
+    };
+
+    template <>
+    struct wide_type_for<short>
+    {
+      using type = int;
+    };
+
+    template <>
+    struct wide_type_for<unsigned short>
+    {
+      using type = unsigned int;
+    };
+
+    template <>
+    struct wide_type_for<int>
+    {
+      using type = long long;
+    };
+
+    template <>
+    struct wide_type_for<unsigned int>
+    {
+      using type = unsigned long long;
+    };
+
     // If given types are the same size ///////////////////////////////////////
 
-    template <typename T1, typename T2>
-    struct same_size
+    template <typename T1, typename T2>
+    struct same_size
+    {
+      static const bool value = (sizeof(T1) == sizeof(T2));
+    };
+
+    template <typename T1, typename T2>
+    using same_size_t = enable_if_t<same_size<T1, T2>::value>;
+
+    // GCC/Clang vector extension type for a given SIMD width ////////////////
+
+    // NOTE: mask lanes use the signed integer of the same size, which is what
+    //       vector comparisons produce (all bits set for 'true')
+
+    template <typename T>
+    struct vector_ext_lane
+    {
+      using type = T;
+    };
+
+    template <>
+    struct vector_ext_lane<bool8_t>
+    {
+      using type = signed char;
+    };
+
+    template <>
+    struct vector_ext_lane<bool16_t>
+    {
+      using type = short;
+    };
+
+    template <>
+    struct vector_ext_lane<bool32_t>
+    {
+      using type = int;
+    };
+
+    template <>
+    struct vector_ext_lane<bool64_t>
+    {
+      using type = long long;
+    };
+
+#if TSIMD_VECTOR_EXTENSIONS
+    template <typename T, int W>
+    struct vector_ext_type
+    {
+      using lane_t = typename vector_ext_lane<T>::type;
+      typedef lane_t type __attribute__((vector_size(sizeof(lane_t) * W)));
+    };
+#endif
+
+    // NOTE: only pack widths get vector types (1-wide packs stay scalars),
+    //       and wide packs keep their two halves
+    template <typename T, int W>
+    struct has_vector_ext
+    {
+      static const bool value = TSIMD_VECTOR_EXTENSIONS && W >= 4 &&
+                                !is_wide_pack<T, W>::value &&
+                                valid_type_for_pack<T>::value;
+    };
+
+    // Provide intrinsic type given a SIMD width //////////////////////////////
+
+    template <typename T, int W>
+    struct simd_undefined_type
+    {
+    };
+
+    // NOTE: without a native type, packs are either plain arrays or (with
+    //       TSIMD_VECTOR_EXTENSIONS) compiler vector types
+    template <typename T, int W, bool VECTOR_EXT = has_vector_ext<T, W>::value>
+    struct default_simd_type
+    {
+      using type = simd_undefined_type<T, W>;
+    };
+
+#if TSIMD_VECTOR_EXTENSIONS
+    template <typename T, int W>
+    struct default_simd_type<T, W, true>
+    {
+      using type = typename vector_ext_type<T, W>::type;
+    };
+#endif
+
+    template <typename T, int W>
+    struct simd_type
+    {
+      using type = typename default_simd_type<T, W>::type;
+    };
+
+    // bool types all widths //
+
+    template <int W>
+    struct simd_type<bool32_t, W>
+    {
+      using type = typename simd_type<float, W>::type;
+    };
+
+    template <int W>
+    struct simd_type<bool64_t, W>
+    {
+      using type = typename simd_type<double, W>::type;
+    };
+
+    // 1-wide //
+
+    template <>
+    struct simd_type<float, 1>
+    {
+      using type = float;
+    };
+
+    template <>
+    struct simd_type<int, 1>
+    {
+      using type = int;
+    };
+
+    template <>
+    struct simd_type<double, 1>
+    {
+      using type = double;
+    };
+
+    template <>
+    struct simd_type<long long, 1>
+    {
+      using type = long long;
+    };
+
+    // 4-wide //
+
+#if defined(__SSE__)
+    template <>
+    struct simd_type<float, 4>
+    {
+      using type = __m128;
+    };
+
+    template <>
+    struct simd_type<int, 4>
+    {
+      using type = __m128i;
+    };
+
+    template <>
+    struct simd_type<unsigned int, 4>
+    {
+      using type = __m128i;
+    };
+#endif
+
+#if defined(__AVX2__) || defined(__AVX__)
+    template <>
+    struct simd_type<double, 4>
+    {
+      using type = __m256d;
+    };
+#endif
+
+#if defined(__AVX2__) || defined(__AVX__)
+    template <>
+    struct simd_type<long long, 4>
+    {
+      using type = __m256i;
+    };
+
+    template <>
+    struct simd_type<unsigned long long, 4>
+    {
+      using type = __m256i;
+    };
+#endif
+
+#if defined(__AVX512VL__)
+    template <>
+    struct simd_type<bool32_t, 4>
+    {
+      using type = __mmask8;
+    };
+
+    template <>
+    struct simd_type<bool64_t, 4>
+    {
+      using type = __mmask8;
+    };
+#endif
+
+    // 8-wide //
+
+#if defined(__AVX2__) || defined(__AVX__)
+    template <>
+    struct simd_type<float, 8>
+    {
+      using type = __m256;
+    };
+
+    template <>
+    struct simd_type<int, 8>
+    {
+      using type = __m256i;
+    };
+
+    template <>
+    struct simd_type<unsigned int, 8>
+    {
+      using type = __m256i;
+    };
+#endif
+
+#if defined(__AVX512F__)
+    template <>
+    struct simd_type<double, 8>
+    {
+      using type = __m512d;
+    };
+
+    template <>
+    struct simd_type<long long, 8>
+    {
+      using type = __m512i;
+    };
+
+    template <>
+    struct simd_type<unsigned long long, 8>
+    {
+      using type = __m512i;
+    };
+
+    template <>
+    struct simd_type<bool64_t, 8>
+    {
+      using type = __mmask8;
+    };
+#endif
+
+#if defined(__AVX512VL__)
+    template <>
+    struct simd_type<bool32_t, 8>
+    {
+      using type = __mmask8;
+    };
+#endif
+
+    // 16-wide //
+
+#if defined(__AVX512F__)
+    template <>
+    struct simd_type<float, 16>
+    {
+      using type = __m512;
+    };
+
+    template <>
+    struct simd_type<int, 16>
+    {
+      using type = __m512i;
+    };
+
+    template <>
+    struct simd_type<unsigned int, 16>
+    {
+      using type = __m512i;
+    };
+
+    template <>
+    struct simd_type<bool32_t, 16>
+    {
+      using type = __mmask16;
+    };
+
+    // NOTE: vboold16 has no single register, but keeping its two 8-lane
+    //       halves in one __mmask16 lets lane access stay bit-addressable
+    template <>
+    struct simd_type<bool64_t, 16>
+    {
+      using type = __mmask16;
+    };
+#endif
+
+    // 8/16-bit (register-filling widths) //
+
+#if defined(__SSE__)
+    template <>
+    struct simd_type<signed char, 16>
+    {
+      using type = __m128i;
+    };
+
+    template <>
+    struct simd_type<unsigned char, 16>
+    {
+      using type = __m128i;
+    };
+
+    template <>
+    struct simd_type<short, 8>
+    {
+      using type = __m128i;
+    };
+
+    template <>
+    struct simd_type<unsigned short, 8>
+    {
+      using type = __m128i;
+    };
+#endif
+
+#if defined(__AVX__)
+    template <>
+    struct simd_type<signed char, 32>
+    {
+      using type = __m256i;
+    };
+
+    template <>
+    struct simd_type<unsigned char, 32>
+    {
+      using type = __m256i;
+    };
+
+    template <>
+    struct simd_type<short, 16>
+    {
+      using type = __m256i;
+    };
+
+    template <>
+    struct simd_type<unsigned short, 16>
+    {
+      using type = __m256i;
+    };
+#endif
+
+#if defined(__AVX512F__)
+    template <>
+    struct simd_type<signed char, 64>
+    {
+      using type = __m512i;
+    };
+
+    template <>
+    struct simd_type<unsigned char, 64>
+    {
+      using type = __m512i;
+    };
+
+    template <>
+    struct simd_type<short, 32>
+    {
+      using type = __m512i;
+    };
+
+    template <>
+    struct simd_type<unsigned short, 32>
+    {
+      using type = __m512i;
+    };
+#endif
+
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    template <>
+    struct simd_type<bool8_t, 16>
+    {
+      using type = __mmask16;
+    };
+
+    template <>
+    struct simd_type<bool16_t, 8>
+    {
+      using type = __mmask8;
+    };
+#elif defined(__SSE__)
+    template <>
+    struct simd_type<bool8_t, 16>
+    {
+      using type = __m128i;
+    };
+
+    template <>
+    struct simd_type<bool16_t, 8>
+    {
+      using type = __m128i;
+    };
+#endif
+
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    template <>
+    struct simd_type<bool8_t, 32>
+    {
+      using type = __mmask32;
+    };
+
+    template <>
+    struct simd_type<bool16_t, 16>
+    {
+      using type = __mmask16;
+    };
+#elif defined(__AVX__)
+    template <>
+    struct simd_type<bool8_t, 32>
+    {
+      using type = __m256i;
+    };
+
+    template <>
+    struct simd_type<bool16_t, 16>
+    {
+      using type = __m256i;
+    };
+#endif
+
+#if defined(__AVX512BW__)
+    template <>
+    struct simd_type<bool8_t, 64>
+    {
+      using type = __mmask64;
+    };
+
+    template <>
+    struct simd_type<bool16_t, 32>
+    {
+      using type = __mmask32;
+    };
+#elif defined(__AVX512F__)
+    template <>
+    struct simd_type<bool8_t, 64>
+    {
+      using type = __m512i;
+    };
+
+    template <>
+    struct simd_type<bool16_t, 32>
+    {
+      using type = __m512i;
+    };
+#endif
+
+    // Check if a pack<T, W>::intrinsic_t is actually an intrinsic type ///////
+
+    // example: pack<float, 8> on AVX is type __m256, so evaluate to "true"
+
+    template <typename T, int W>
+    using simd_type_is_native = std::integral_constant<
+        bool,
+        !std::is_same<typename simd_type<T, W>::type,
+                      simd_undefined_type<T, W>>::value>;
+
+    template <typename T, int W>
+    using simd_type_is_native_t =
+        enable_if_t<simd_type_is_native<T,W>::value>;
+
+    template <typename T, int W>
+    using simd_type_is_not_native_t =
+        enable_if_t<!simd_type_is_native<T,W>::value>;
+
+    // Check if a mask pack<T, W> is stored as AVX-512 mask bits //////////////
+
+    // example: pack<bool32_t, 16> on AVX-512 is type __mmask16, so each lane is
+    //          a single bit instead of a 32-bit element
+
+    template <typename T, int W>
+    struct is_bitmask
+    {
+      static const bool value =
+          is_bool<T>::value && W > 1 &&
+          std::is_integral<typename simd_type<T, W>::type>::value;
+    };
+
+    template <typename T, int W>
+    using is_bitmask_t = enable_if_t<is_bitmask<T, W>::value>;
+
+    template <typename T, int W>
+    using is_not_bitmask_t = enable_if_t<!is_bitmask<T, W>::value>;
+
+    // Provide a cast (float|int) intrinsic type given a SIMD width ///////////
+
+    template <typename T>
+    struct cast_simd_undefined_type
+    {
+    };
+
+    template <typename T, int W>
+    struct cast_simd_type
+    {
+      using type = cast_simd_undefined_type<T>;
+    };
+
+    // 1-wide //
+
+    template <>
+    struct cast_simd_type<float, 1>
+    {
+      using type = simd_type<int, 1>::type;
+    };
+
+    template <>
+    struct cast_simd_type<int, 1>
+    {
+      using type = simd_type<float, 1>::type;
+    };
+
+    template <>
+    struct cast_simd_type<unsigned int, 1>
+    {
+      using type = simd_type<float, 1>::type;
+    };
+
+    template <>
+    struct cast_simd_type<double, 1>
+    {
+      using type = simd_type<long long, 1>::type;
+    };
+
+    template <>
+    struct cast_simd_type<long long, 1>
+    {
+      using type = simd_type<double, 1>::type;
+    };
+
+    template <>
+    struct cast_simd_type<unsigned long long, 1>
+    {
+      using type = simd_type<double, 1>::type;
+    };
+
+    // 4-wide //
+
+    template <>
+    struct cast_simd_type<float, 4>
+    {
+      using type = simd_type<int, 4>::type;
+    };
+
+    template <>
+    struct cast_simd_type<int, 4>
+    {
+      using type = simd_type<float, 4>::type;
+    };
+
+    template <>
+    struct cast_simd_type<unsigned int, 4>
+    {
+      using type = simd_type<float, 4>::type;
+    };
+
+    template <>
+    struct cast_simd_type<bool32_t, 4>
+    {
+      using type = simd_type<int, 4>::type;
+    };
+
+    template <>
+    struct cast_simd_type<double, 4>
+    {
+      using type = simd_type<long long, 4>::type;
+    };
+
+    template <>
+    struct cast_simd_type<long long, 4>
+    {
+      using type = simd_type<double, 4>::type;
+    };
+
+    template <>
+    struct cast_simd_type<unsigned long long, 4>
+    {
+      using type = simd_type<double, 4>::type;
+    };
+
+    template <>
+    struct cast_simd_type<bool64_t, 4>
+    {
+      using type = simd_type<long long, 4>::type;
+    };
+
+    // 8-wide //
+
+    template <>
+    struct cast_simd_type<float, 8>
+    {
+      using type = simd_type<int, 8>::type;
+    };
+
+    template <>
+    struct cast_simd_type<int, 8>
+    {
+      using type = simd_type<float, 8>::type;
+    };
+
+    template <>
+    struct cast_simd_type<unsigned int, 8>
+    {
+      using type = simd_type<float, 8>::type;
+    };
+
+    template <>
+    struct cast_simd_type<bool32_t, 8>
+    {
+      using type = simd_type<int, 8>::type;
+    };
+
+    template <>
+    struct cast_simd_type<double, 8>
+    {
+      using type = simd_type<long long, 8>::type;
+    };
+
+    template <>
+    struct cast_simd_type<long long, 8>
+    {
+      using type = simd_type<double, 8>::type;
+    };
+
+    template <>
+    struct cast_simd_type<unsigned long long, 8>
+    {
+      using type = simd_type<double, 8>::type;
+    };
+
+    // 16-wide //
+
+    template <>
+    struct cast_simd_type<float, 16>
     {
-      static const bool value = (sizeof(T1) == sizeof(T2));
+      using type = simd_type<int, 16>::type;
     };
 
-    template <typename T1, typename T2>
-    using same_size_t = enable_if_t<same_size<T1, T2>::value>;
+    template <>
+    struct cast_simd_type<int, 16>
+    {
+      using type = simd_type<float, 16>::type;
+    };
 
-    // Provide intrinsic type given a SIMD width //////////////////////////////
+    template <>
+    struct cast_simd_type<unsigned int, 16>
+    {
+      using type = simd_type<float, 16>::type;
+    };
 
-    template <typename T, int W>
-    struct simd_undefined_type
+    // Provide intrinsic type half the size of given width ////////////////////
+
+    template <typename T, int W, bool VECTOR_EXT = has_vector_ext<T, W>::value>
+    struct default_half_simd_type
     {
+      using type = std::array<T, W / 2>;
     };
 
+#if TSIMD_VECTOR_EXTENSIONS
+    // NOTE: use the half-width pack's storage, masks share the lane type of
+    //       their matching value packs (see simd_type<bool32_t, W>)
     template <typename T, int W>
-    struct simd_type
+    struct default_half_simd_type<T, W, true>
     {
-      using type = simd_undefined_type<T, W>;
+      using type = typename std::conditional<
+          W == 4,
+          typename vector_ext_type<T, 2>::type,
+          typename simd_type<T, W / 2>::type>::type;
     };
+#endif
 
-    // bool types all widths //
-
-    template <int W>
-    struct simd_type<bool32_t, W>
+    template <typename T, int W>
+    struct half_simd_type
     {
-      using type = typename simd_type<float, W>::type;
+      using type = typename default_half_simd_type<T, W>::type;
     };
 
-    template <int W>
-    struct simd_type<bool64_t, W>
+    // 1-wide //
+
+    template <typename T>
+    struct half_simd_type<T, 1>
     {
-      using type = typename simd_type<double, W>::type;
+      using type = std::array<T, 1>;
     };
 
-    // 1-wide //
+    // 4-wide //
 
+#if defined(__AVX2__) || defined(__AVX__)
     template <>
-    struct simd_type<float, 1>
+    struct half_simd_type<double, 4>
     {
-      using type = float;
+      using type = __m128d;
     };
 
     template <>
-    struct simd_type<int, 1>
+    struct half_simd_type<long long, 4>
     {
-      using type = int;
+      using type = __m128i;
     };
 
     template <>
-    struct simd_type<double, 1>
+    struct half_simd_type<unsigned long long, 4>
     {
-      using type = double;
+      using type = __m128i;
     };
 
     template <>
-    struct simd_type<long long, 1>
+    struct half_simd_type<bool64_t, 4>
     {
-      using type = long long;
+      using type = half_simd_type<double, 4>::type;
     };
+#endif
 
-    // 4-wide //
+    // 8-wide //
 
 #if defined(__SSE__)
     template <>
-    struct simd_type<float, 4>
+    struct half_simd_type<float, 8>
     {
-      using type = __m128;
+      using type = simd_type<float, 4>::type;
     };
 
     template <>
-    struct simd_type<int, 4>
+    struct half_simd_type<int, 8>
     {
-      using type = __m128i;
+      using type = simd_type<int, 4>::type;
     };
-#endif
 
-#if defined(__AVX2__) || defined(__AVX__)
     template <>
-    struct simd_type<double, 4>
+    struct half_simd_type<unsigned int, 8>
     {
-      using type = __m256d;
+      using type = simd_type<unsigned int, 4>::type;
     };
-#endif
 
-#if defined(__AVX2__)
     template <>
-    struct simd_type<long long, 4>
+    struct half_simd_type<bool32_t, 8>
     {
-      using type = __m256i;
+      using type = half_simd_type<float, 8>::type;
     };
 #endif
 
-    // 8-wide //
-
 #if defined(__AVX2__) || defined(__AVX__)
     template <>
-    struct simd_type<float, 8>
+    struct half_simd_type<double, 8>
     {
-      using type = __m256;
+      using type = simd_type<double, 4>::type;
     };
 
     template <>
-    struct simd_type<int, 8>
+    struct half_simd_type<long long, 8>
     {
-      using type = __m256i;
+      using type = simd_type<long long, 4>::type;
+    };
+
+    template <>
+    struct half_simd_type<unsigned long long, 8>
+    {
+      using type = simd_type<unsigned long long, 4>::type;
+    };
+
+    template <>
+    struct half_simd_type<bool64_t, 8>
+    {
+      using type = half_simd_type<double, 8>::type;
     };
 #endif
 
     // 16-wide //
 
-#if defined(__AVX512F__)
+#if defined(__AVX2__) || defined(__AVX__)
     template <>
-    struct simd_type<float, 16>
+    struct half_simd_type<float, 16>
     {
-      using type = __m512;
+      using type = simd_type<float, 8>::type;
     };
+#endif
 
+#if defined(__AVX512VL__)
     template <>
-    struct simd_type<int, 16>
+    struct half_simd_type<bool32_t, 16>
     {
-      using type = __m512i;
+      using type = simd_type<bool32_t, 8>::type;
     };
-
+#elif defined(__AVX2__) || defined(__AVX__)
     template <>
-    struct simd_type<bool32_t, 16>
+    struct half_simd_type<bool32_t, 16>
     {
-      using type = __mmask16;
+      using type = half_simd_type<float, 16>::type;
     };
 #endif
 
-    // Check if a pack<T, W>::intrinsic_t is actually an intrinsic type ///////
-
-    // example: pack<float, 8> on AVX is type __m256, so evaluate to "true"
-
-    template <typename T, int W>
-    using simd_type_is_native =
-        std::is_same<simd_type<T,W>, simd_undefined_type<T,W>>;
-
-    template <typename T, int W>
-    using simd_type_is_native_t =
-        enable_if_t<simd_type_is_native<T,W>::value>;
-
-    template <typename T, int W>
-    using simd_type_is_not_native_t =
-        enable_if_t<!simd_type_is_native<T,W>::value>;
-
-    // Provide a cast (float|int) intrinsic type given a SIMD width ///////////
-
-    template <typename T>
-    struct cast_simd_undefined_type
+#if defined(__AVX__)
+    template <>
+    struct half_simd_type<int, 16>
     {
+      using type = simd_type<int, 8>::type;
     };
 
-    template <typename T, int W>
-    struct cast_simd_type
+    template <>
+    struct half_simd_type<unsigned int, 16>
     {
-      using type = cast_simd_undefined_type<T>;
+      using type = simd_type<unsigned int, 8>::type;
     };
+#endif
 
-    // 1-wide //
-
+#if defined(__AVX512F__)
     template <>
-    struct cast_simd_type<float, 1>
+    struct half_simd_type<double, 16>
     {
-      using type = simd_type<int, 1>::type;
+      using type = simd_type<double, 8>::type;
     };
 
     template <>
-    struct cast_simd_type<int, 1>
+    struct half_simd_type<long long, 16>
     {
-      using type = simd_type<float, 1>::type;
+      using type = simd_type<long long, 8>::type;
     };
 
     template <>
-    struct cast_simd_type<double, 1>
+    struct half_simd_type<unsigned long long, 16>
     {
-      using type = simd_type<long long, 1>::type;
+      using type = simd_type<unsigned long long, 8>::type;
     };
 
     template <>
-    struct cast_simd_type<long long, 1>
+    struct half_simd_type<bool64_t, 16>
     {
-      using type = simd_type<double, 1>::type;
+      using type = simd_type<bool64_t, 8>::type;
     };
+#endif
 
-    // 4-wide //
+    // 8/16-bit (register-filling widths) //
 
+#if defined(__SSE__)
     template <>
-    struct cast_simd_type<float, 4>
+    struct half_simd_type<signed char, 32>
     {
-      using type = simd_type<int, 4>::type;
+      using type = __m128i;
     };
 
     template <>
-    struct cast_simd_type<int, 4>
+    struct half_simd_type<unsigned char, 32>
     {
-      using type = simd_type<float, 4>::type;
+      using type = __m128i;
     };
 
     template <>
-    struct cast_simd_type<bool32_t, 4>
+    struct half_simd_type<short, 16>
     {
-      using type = simd_type<int, 4>::type;
+      using type = __m128i;
     };
 
-    // 8-wide //
-
     template <>
-    struct cast_simd_type<float, 8>
+    struct half_simd_type<unsigned short, 16>
     {
-      using type = simd_type<int, 8>::type;
+      using type = __m128i;
     };
+#endif
 
+#if defined(__AVX__)
     template <>
-    struct cast_simd_type<int, 8>
+    struct half_simd_type<signed char, 64>
     {
-      using type = simd_type<float, 8>::type;
+      using type = __m256i;
     };
 
     template <>
-    struct cast_simd_type<bool32_t, 8>
+    struct half_simd_type<unsigned char, 64>
     {
-      using type = simd_type<int, 8>::type;
+      using type = __m256i;
     };
 
-    // 16-wide //
-
     template <>
-    struct cast_simd_type<float, 16>
+    struct half_simd_type<short, 32>
     {
-      using type = simd_type<int, 16>::type;
+      using type = __m256i;
     };
 
     template <>
-    struct cast_simd_type<int, 16>
+    struct half_simd_type<unsigned short, 32>
     {
-      using type = simd_type<float, 16>::type;
+      using type = __m256i;
     };
+#endif
 
-    // Provide intrinsic type half the size of given width ////////////////////
-
-    template <typename T, int W>
-    struct half_simd_type
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    template <>
+    struct half_simd_type<bool8_t, 32>
     {
-      using type = std::array<T, W / 2>;
+      using type = simd_type<bool8_t, 16>::type;
     };
 
-    // 1-wide //
-
-    template <typename T>
-    struct half_simd_type<T, 1>
+    template <>
+    struct half_simd_type<bool8_t, 64>
     {
-      using type = std::array<T, 1>;
+      using type = simd_type<bool8_t, 32>::type;
     };
 
-    // 8-wide //
-
-#if defined(__SSE__)
     template <>
-    struct half_simd_type<float, 8>
+    struct half_simd_type<bool16_t, 16>
     {
-      using type = simd_type<float, 4>::type;
+      using type = simd_type<bool16_t, 8>::type;
     };
 
     template <>
-    struct half_simd_type<int, 8>
+    struct half_simd_type<bool16_t, 32>
     {
-      using type = simd_type<int, 4>::type;
+      using type = simd_type<bool16_t, 16>::type;
     };
-
+#elif defined(__AVX__)
     template <>
-    struct half_simd_type<bool32_t, 8>
+    struct half_simd_type<bool8_t, 32>
     {
-      using type = half_simd_type<float, 8>::type;
+      using type = __m128i;
     };
-#endif
 
-    // 16-wide //
+    template <>
+    struct half_simd_type<bool8_t, 64>
+    {
+      using type = __m256i;
+    };
 
-#if defined(__AVX2__) || defined(__AVX__)
     template <>
-    struct half_simd_type<float, 16>
+    struct half_simd_type<bool16_t, 16>
     {
-      using type = simd_type<float, 8>::type;
+      using type = __m128i;
     };
 
     template <>
-    struct half_simd_type<bool32_t, 16>
+    struct half_simd_type<bool16_t, 32>
     {
-      using type = half_simd_type<float, 16>::type;
+      using type = __m256i;
+    };
+#elif defined(__SSE__)
+    template <>
+    struct half_simd_type<bool8_t, 32>
+    {
+      using type = __m128i;
     };
-#endif
 
-#if defined(__AVX__)
     template <>
-    struct half_simd_type<int, 16>
+    struct half_simd_type<bool16_t, 16>
     {
-      using type = simd_type<int, 8>::type;
+      using type = __m128i;
     };
 #endif
 
@@ -465,6 +1258,46 @@ namespace tsimd {
       using type = bool_undefined_type<T>;
     };
 
+    // 8-bit //
+
+    template <>
+    struct bool_type_for<signed char>
+    {
+      using type = bool8_t;
+    };
+
+    template <>
+    struct bool_type_for<unsigned char>
+    {
+      using type = bool8_t;
+    };
+
+    template <>
+    struct bool_type_for<bool8_t>
+    {
+      using type = bool8_t;
+    };
+
+    // 16-bit //
+
+    template <>
+    struct bool_type_for<short>
+    {
+      using type = bool16_t;
+    };
+
+    template <>
+    struct bool_type_for<unsigned short>
+    {
+      using type = bool16_t;
+    };
+
+    template <>
+    struct bool_type_for<bool16_t>
+    {
+      using type = bool16_t;
+    };
+
     // 32-bit //
 
     template <>
@@ -479,6 +1312,12 @@ namespace tsimd {
       using type = bool32_t;
     };
 
+    template <>
+    struct bool_type_for<unsigned int>
+    {
+      using type = bool32_t;
+    };
+
     template <>
     struct bool_type_for<bool32_t>
     {
@@ -499,6 +1338,12 @@ namespace tsimd {
       using type = bool64_t;
     };
 
+    template <>
+    struct bool_type_for<unsigned long long>
+    {
+      using type = bool64_t;
+    };
+
     template <>
     struct bool_type_for<bool64_t>
     {
@@ -506,4 +1351,4 @@ namespace tsimd {
     };
 
   }  // namespace traits
-}  // namespace tsimd
+TSIMD_NAMESPACE_END  // namespace tsimd
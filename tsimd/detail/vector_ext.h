@@ -0,0 +1,117 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Intel Corporation                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+
+#pragma once
+
+#include <cstring>
+#include <type_traits>
+
+#include "pack.h"
+
+#if TSIMD_VECTOR_EXTENSIONS
+
+TSIMD_NAMESPACE_BEGIN
+
+  namespace detail {
+
+    // NOTE: a pack's own storage can be a native type with other lanes (e.g.
+    //       __m128i for a vint4 when an op needs a newer ISA) or mask bits,
+    //       so lanes always go through a copy to the typed vector, which the
+    //       compiler drops whenever the storage already matches
+
+    template <typename T, int W>
+    using vext_t = typename traits::vector_ext_type<T, W>::type;
+
+    template <typename T, int W>
+    using vext_same_size_t =
+        std::integral_constant<bool, sizeof(vext_t<T, W>) == sizeof(pack<T, W>)>;
+
+    template <typename T, int W>
+    TSIMD_INLINE vext_t<T, W> vext(const pack<T, W> &p, std::true_type)
+    {
+      vext_t<T, W> v;
+      std::memcpy(&v, &p, sizeof(v));
+      return v;
+    }
+
+    // NOTE: masks stored as AVX-512 mask bits, expand to all-ones lanes
+    template <typename T, int W>
+    TSIMD_INLINE vext_t<T, W> vext(const pack<T, W> &p, std::false_type)
+    {
+      vext_t<T, W> v;
+
+      for (int i = 0; i < W; ++i)
+        v[i] = static_cast<bool>(p[i]) ? -1 : 0;
+
+      return v;
+    }
+
+    template <typename T, int W>
+    TSIMD_INLINE vext_t<T, W> vext(const pack<T, W> &p)
+    {
+      return vext(p, vext_same_size_t<T, W>());
+    }
+
+    template <typename PACK_T>
+    TSIMD_INLINE PACK_T from_vext(
+        const vext_t<typename PACK_T::value_t, PACK_T::static_size> &v,
+        std::true_type)
+    {
+      PACK_T p;
+      std::memcpy(&p, &v, sizeof(v));
+      return p;
+    }
+
+    template <typename PACK_T>
+    TSIMD_INLINE PACK_T from_vext(
+        const vext_t<typename PACK_T::value_t, PACK_T::static_size> &v,
+        std::false_type)
+    {
+      PACK_T p;
+
+      for (int i = 0; i < PACK_T::static_size; ++i)
+        p[i] = (v[i] != 0);
+
+      return p;
+    }
+
+    // NOTE: any vector with the same lane count and lane size converts, so
+    //       comparison results (signed integer lanes) become masks directly
+    template <typename PACK_T, typename V>
+    TSIMD_INLINE PACK_T from_vext(const V &v)
+    {
+      using T = typename PACK_T::value_t;
+      constexpr int W = PACK_T::static_size;
+      static_assert(sizeof(V) == sizeof(vext_t<T, W>),
+                    "vector and pack must have the same size!");
+      return from_vext<PACK_T>(vext_t<T, W>(v),
+                               vext_same_size_t<T, W>());
+    }
+
+  }  // namespace detail
+
+TSIMD_NAMESPACE_END  // namespace tsimd
+
+#endif
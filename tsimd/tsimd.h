@@ -24,12 +24,15 @@
 
 #pragma once
 
+#include "detail/dispatch.h"
 #include "detail/pack.h"
 
 #include "detail/functions/algorithm.h"
+#include "detail/functions/convert.h"
 #include "detail/functions/math.h"
 #include "detail/functions/memory.h"
 #include "detail/functions/random.h"
+#include "detail/functions/shuffle.h"
 
 #include "detail/operators/arithmetic.h"
 #include "detail/operators/bitwise.h"